@@ -1,5 +1,7 @@
 const fs = require('fs');
 const Path = require('path');
+const zlib = require('zlib');
+const crypto = require('crypto');
 const UglifyJS = require('uglify-js');
 const HTMLMinify = require('html-minifier').minify;
 
@@ -30,7 +32,7 @@ function compressJs(fileName) {
     let uglyScript = UglifyJS.minify(originScript, {
         mangle: {
             toplevel: true,
-            reserved: ['WifiConfig','TimeConfig', 'OptionConfig', 'MqttConfig', 'FinishView']
+            reserved: ['WifiConfig','TimeConfig', 'OptionConfig', 'MqttConfig', 'FinishView', 'Router']
         },
         compress: true
     });
@@ -69,28 +71,70 @@ function compressCSS(fileName) {
     fs.writeFileSync(destFile, resultHtml,{encoding: 'utf-8'} );
 }
 
-function makeResourceHpp() {
-    let ajaxJs = fs.readFileSync(Path.join(buildJsPath, 'ajax.js'), 'utf-8').replace(/\"/ig, '\\\"').replace(/[.]html/ig, '');
-    let appJs = fs.readFileSync(Path.join(buildJsPath, 'app.js'), 'utf-8').replace(/\"/ig, '\\\"').replace(/[.]html/ig, '');
-    let envJs = "let DEV_URL = ''";
-    let mainCss = fs.readFileSync(Path.join(buildCssPath, 'main.css'), 'utf-8').replace(/\"/ig, '\\\"').replace(/[.]html/ig, '');
-    let finishHtml = fs.readFileSync(Path.join(buildPath, 'finish.html'), 'utf-8').replace(/\"/ig, '\\\"').replace(/[.]html/ig, '');
-    let mqttHtml = fs.readFileSync(Path.join(buildPath, 'mqtt.html'), 'utf-8').replace(/\"/ig, '\\\"').replace(/[.]html/ig, '');
-    let optionHtml = fs.readFileSync(Path.join(buildPath, 'option.html'), 'utf-8').replace(/\"/ig, '\\\"').replace(/[.]html/ig, '');
-    let wifiHtml = fs.readFileSync(Path.join(buildPath, 'wifi.html'), 'utf-8').replace(/\"/ig, '\\\"').replace(/[.]html/ig, '');
-    let timeHtml = fs.readFileSync(Path.join(buildPath, 'time.html'), 'utf-8').replace(/\"/ig, '\\\"').replace(/[.]html/ig, '');
+function readResource(path) {
+    return fs.readFileSync(path, 'utf-8').replace(/[.]html/ig, '');
+}
+
+// 리소스를 flash(PROGMEM) 에 두는 byte 배열로 만든다. 길이는 RES_*_LEN 으로 정의한다.
+function makeProgmemArray(name, bytes) {
+    let lines = [];
+    for (let i = 0; i < bytes.length; i += 16) {
+        lines.push(Array.from(bytes.subarray(i, i + 16), (b) => '0x' + b.toString(16).padStart(2, '0')).join(','));
+    }
+    let src = "";
+    src += "#define " + name + "_LEN " + bytes.length + "\n";
+    src += "static const uint8_t " + name + "[] PROGMEM = {\n" + lines.join(",\n") + "\n};\n";
+    return src;
+}
+
+function contentHash(content) {
+    return crypto.createHash('sha1').update(content, 'utf-8').digest('hex').substring(0, 12);
+}
 
+function makeProgmemString(name, value) {
+    return "static const char " + name + "[] PROGMEM = \"" + value.replace(/\"/g, '\\"') + "\";\n";
+}
+
+// 원본과 gzip 으로 압축한 배열을 만든다. WIZARD_RESOURCE_GZIP_ONLY 가 정의되면 원본은 빌드에서 빠진다.
+// 두 배열과 content type, ETag 는 RES_*_RESOURCE (WebResource) 로 묶는다.
+function makeResource(name, contentType, content) {
+    let bytes = Buffer.from(content, 'utf-8');
+    let gzipBytes = zlib.gzipSync(bytes, {level: zlib.constants.Z_BEST_COMPRESSION});
+    let hash = contentHash(content);
     let src = "";
-    src +=  "#define RES_WIFI_HTML \"" + wifiHtml + "\"\n";
-    src +=  "#define RES_TIME_HTML \"" + timeHtml + "\"\n";
-    src +=  "#define RES_MQTT_HTML \"" + mqttHtml + "\"\n";
-    src +=  "#define RES_OPTION_HTML \"" + optionHtml + "\"\n";
-    src +=  "#define RES_FINISH_HTML \"" + finishHtml + "\"\n";
-    src +=  "#define RES_MAIN_CSS \"" + mainCss + "\"\n";
-    src +=  "#define RES_ENV_JS \"" + envJs + "\"\n";
-    src +=  "#define RES_APP_JS \"" + appJs + "\"\n";
-    src +=  "#define RES_AJAX_JS \"" + ajaxJs + "\"\n";
+    src += "#ifndef WIZARD_RESOURCE_GZIP_ONLY\n";
+    src += makeProgmemArray(name, bytes);
+    src += "#else\n";
+    src += "#define " + name + "_LEN 0\n";
+    src += "#define " + name + " ((const uint8_t*)NULL)\n";
+    src += "#endif\n";
+    src += makeProgmemArray(name + "_GZ", gzipBytes);
+    src += makeProgmemString(name + "_TYPE", contentType);
+    src += makeProgmemString(name + "_ETAG", '"' + hash + '"');
+    src += makeProgmemString(name + "_GZ_ETAG", '"' + hash + '-gz"');
+    src += "static const WebResource " + name + "_RESOURCE PROGMEM = { " +
+        [name + "_TYPE", name, name + "_LEN", name + "_GZ", name + "_GZ_LEN", name + "_ETAG", name + "_GZ_ETAG"].join(", ") + " };\n";
+    return src;
+}
+
+// 페이지가 참조하는 css, js 를 페이지 안에 넣어서 설정 마법사 전체를 한 번의 요청으로 받게 한다.
+function inlineAssets(html, assets) {
+    html = html.replace(/<link[^>]*href='(css\/[\w.]+)'[^>]*>/g, (tag, path) => '<style>' + assets[path] + '</style>');
+    html = html.replace(/<script[^>]*src='(js\/[\w.]+)'[^>]*><\/script>/g, (tag, path) => '<script>' + assets[path] + '</script>');
+    return html;
+}
+
+function makeResourceHpp() {
+    let assets = {
+        'css/main.css': readResource(Path.join(buildCssPath, 'main.css')),
+        'js/env.js': "let DEV_URL = ''",
+        'js/app.js': readResource(Path.join(buildJsPath, 'app.js')),
+        'js/ajax.js': readResource(Path.join(buildJsPath, 'ajax.js'))
+    };
+    let indexHtml = inlineAssets(readResource(Path.join(buildPath, 'index.html')), assets);
 
+    let src = "// .res/build.js 로 생성된 파일. 직접 수정하지 말 것.\n#pragma once\n\n#include \"WebResource.hpp\"\n\n";
+    src += makeResource('RES_INDEX_HTML', 'text/html', indexHtml);
 
     fs.writeFileSync(Path.join(buildPath,'Resources.hpp'), src, 'utf-8');
 
@@ -101,11 +145,7 @@ fs.copyFileSync(Path.join(defJsPath, 'ajax.js'),Path.join(buildJsPath, 'ajax.js'
 fs.copyFileSync(Path.join(defJsPath, 'env.js'),Path.join(buildJsPath, 'env.js'));
 
 
-compressHTML('wifi.html');
-compressHTML('finish.html');
-compressHTML('mqtt.html');
-compressHTML('option.html');
-compressHTML('time.html');
+compressHTML('index.html');
 compressJs('app.js');
 compressCSS('main.css');
 
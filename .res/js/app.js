@@ -3,7 +3,9 @@
 class Commons {
 
 
-	constructor() {
+	// 모든 단계가 한 페이지에 있으므로 결과, 버튼 엘리먼트는 각 단계의 view 안에서 찾는다.
+	constructor(viewId) {
+		this.viewId = viewId;
 		this.eleResult;
 		this.eleBtnNext;
 		this.eleBtnCommit;
@@ -11,9 +13,10 @@ class Commons {
 	
 
 	initCommonEles = () => {
-		this.eleResult = document.getElementsByClassName('result')[0];
-		this.eleBtnNext = document.getElementById('btn-next');
-		this.eleBtnCommit = document.getElementById('btn-commit');
+		let eleView = document.getElementById(this.viewId);
+		this.eleResult = eleView.getElementsByClassName('result')[0];
+		this.eleBtnNext = eleView.getElementsByClassName('btn-next')[0];
+		this.eleBtnCommit = eleView.getElementsByClassName('btn-commit')[0];
 		this.eleBtnNext.disabled = true;
 	}
 
@@ -73,60 +76,102 @@ class Client  {
 	static _retry  = 0;
 	static MAX_RETRY = 3;
 
-    static scanWifi(result) {
+	static SCAN_POLL_INTERVAL = 500;
+	static JOB_POLL_INTERVAL = 500;
+	// 장치가 알려준 작업 제한 시간(timeout)에 더해 기다리는 시간. MQTT 연결 중에는 장치가 응답하지 못한다.
+	static JOB_TIMEOUT_MARGIN = 3000;
+
+	// 장치는 백그라운드에서 스캔하므로 결과가 준비될 때까지 상태를 확인한다.
+    static scanWifi(result, refresh) {
         this._retry = 0;
-		let wifiList = [];
-        let count = 0;
         ajax({
-            url: `${DEV_URL}/api/wifi/scan/count`,
+            url: `${DEV_URL}/api/wifi/scan${refresh ? '?refresh=1' : ''}`,
             complete: function(res) {
-                count = res.data.count;
-                Client._readWifiItem(count, 0, wifiList, result);
+                Client._onScanResponse(res.data, result);
             },
             error: function(e) {
 				console.log(e);
-                if (this._retry >= MAX_RETRY) {
+                if (Client._retry >= Client.MAX_RETRY) {
 					result(false, undefined, e);
 					return;
                 }
-				++this._retry;
-                Client.scanWifi(result)
+				++Client._retry;
+                Client.scanWifi(result, refresh);
             }
         });
     }
 
-    static _readWifiItem(max, currentCount, wifiList, result) {
+    static _onScanResponse(data, result) {
+        // 목록은 장치에서 SSID 별로 합치고 신호 세기 순서로 정렬해서 보낸다.
+        if (data.state == 'done' && data.list) {
+            result(true, data.list);
+            return;
+        }
+        if (data.state == 'failed') {
+            result(false, undefined, data);
+            return;
+        }
+        setTimeout(() => Client._pollScanStatus(result), Client.SCAN_POLL_INTERVAL);
+    }
+
+    static _pollScanStatus(result) {
         ajax({
-            url: `${DEV_URL}/api/wifi/scan/item?count=${currentCount}`,
+            url: `${DEV_URL}/api/wifi/scan/status`,
             complete: function(res) {
-                ++currentCount;
-                if (max <= currentCount) {
-                    result(true,wifiList);
-                    return
+                if (res.data.state == 'done') {
+                    Client.scanWifi(result);
+                    return;
                 }
-                let isDuple = false; 
-                for(let data of wifiList) {
-                    if(data.ssid == res.data.ssid) {						
-                        isDuple = true;
-                    }
-                }
-                if(!isDuple)	{
-                    wifiList.push(res.data);
-                }
-                Client._readWifiItem(max, currentCount,wifiList, result)
+                Client._onScanResponse(res.data, result);
             },
             error: function(e) {
 				console.log(e);
-                if (this._retry > MAX_RETRY) {
+                if (Client._retry >= Client.MAX_RETRY) {
 					result(false, undefined, e);
 					return;
                 }
-				++this._retry
-                Client.scanWifi(result);
+				++Client._retry;
+                setTimeout(() => Client._pollScanStatus(result), Client.SCAN_POLL_INTERVAL);
             }
         });
     }
 
+	// WiFi, NTP, MQTT 연결은 장치에서 작업으로 실행되므로 끝날 때까지 상태를 확인한다.
+	// WiFi 에 연결하는 동안 AP 가 잠시 끊길 수 있으므로 요청 실패는 MAX_RETRY 까지 다시 시도한다.
+	// 작업 제한 시간이 지나도 running 이면 실패로 본다.
+	static _waitJob(data, result, retry) {
+		if (!data.success) {
+			result(false, data, undefined);
+			return;
+		}
+		let limit = data.timeout + Client.JOB_TIMEOUT_MARGIN;
+		ajax({
+			url: `${DEV_URL}/api/job/status?id=${data.job}`,
+			timeout: limit,
+			complete: function(res) {
+				let state = res.data.state;
+				if (state == 'running' && res.data.elapsed >= limit) {
+					result(false, res.data, undefined);
+					return;
+				}
+				if (state == 'running') {
+					setTimeout(() => Client._waitJob(data, result, 0), Client.JOB_POLL_INTERVAL);
+					return;
+				}
+				result(state == 'done', res.data, undefined);
+			},
+			error: function(e) {
+				console.error(e);
+				retry = retry ? retry : 0;
+				if (retry >= Client.MAX_RETRY) {
+					result(false, undefined, e);
+					return;
+				}
+				setTimeout(() => Client._waitJob(data, result, retry + 1), Client.JOB_POLL_INTERVAL);
+			}
+		});
+	}
+
 	static connectWifi(ssid, password, result) {
 		ajax({
 			type: "POST",
@@ -136,7 +181,7 @@ class Client  {
 				password: password ? password : ''
 			},
 			complete: function(res) {
-				result(res.data.success, res.data, undefined);
+				Client._waitJob(res.data, result);
 			},
 			error: function(e) {
 				console.error(e);
@@ -168,8 +213,7 @@ class Client  {
 				offset: offset
 			},
 			complete: function(res) {
-				let data = res.data;
-				result(data.success, data);
+				Client._waitJob(res.data, result);
 			},
 			error: function(e) {
 				console.error(e);
@@ -203,7 +247,7 @@ class Client  {
 			},
 			url: `${DEV_URL}/api/mqtt/connect`,
 			complete: function(res) {
-				result(res.data.success, res.data, undefined)
+				Client._waitJob(res.data, result);
 			},
 			error: function(e) {
 				result(false, undefined, e);
@@ -213,17 +257,11 @@ class Client  {
 
 	
 	static getOptionList(result) {
-		let optionList = [];
 		ajax({
 			type: 'GET',
-			url: `${DEV_URL}/api/option/count`,
+			url: `${DEV_URL}/api/option/list`,
 			complete: function(res) {
-				let optionCount = res.data.cnt; 
-				if(optionCount == 0) {
-					result(true, optionList,undefined);
-					return;
-				}
-				Client._loadOption(optionCount, optionCount, optionList, result);
+				result(true, res.data.list, undefined);
 			},
 			error: function(e) {
 				console.error(e);
@@ -232,50 +270,27 @@ class Client  {
 		});
 	}
 
-	
-	
-	static _loadOption(optionCount, leftCount, optionList, result) {
-		ajax({
-			type: 'GET',
-			url: `${DEV_URL}/api/option/get`,
-			complete: function(res) {
-				optionList.push(res.data); 
-				if(--leftCount > 0) {
-					Client._loadOption(optionCount, leftCount, optionList, result);
-				} else {
-					
-					result(true, optionList,undefined);
-				}
-			},
-			error: function(e) {
-				console.error(e);
-				loadOptionCount(result);
-			}
-		});
-	}
-
 	/**
-	 * 
-	 * @param {string} name 
-	 * @param {string} value 
-	 * @param {(boolean, message, error)} resultEvent(isSuccess, error message, error object)
+	 * 모든 옵션을 한 번에 설정한다. 하나라도 실패하면 장치는 아무것도 바꾸지 않는다.
+	 * @param {[{name, value}]} options 
+	 * @param {(boolean, errors, error)} result(isSuccess, [{name, msg}], error object)
 	 */
-	static updateOption(name, value, result) {
+	static updateOptions(options, result) {
+		let data = { count: options.length };
+		for(let i = 0; i < options.length; ++i) {
+			data[`name${i}`] = options[i].name;
+			data[`value${i}`] = options[i].value;
+		}
 		ajax({
 			type: 'POST',
-			data: {name: name, value: value },
-			url: `${DEV_URL}/api/option/set`,
+			data: data,
+			url: `${DEV_URL}/api/option/batch`,
 			complete: function(res) {
-				if(!res.data.success) {
-					console.log(res.data.msg);
-					result(false, res.data.msg);
-				} else {
-					result(true, '');
-				}
+				result(res.data.success, res.data.errors);
 			}, 
 			error: function(e) {
 				console.error(e);
-				result(true, undefined, e);
+				result(false, [], e);
 			}
 		});
 	}
@@ -319,7 +334,7 @@ let WifiConfig = new function() {
 
     let _wifiList = [];
 	let _selectedWifi = {};
-	let _commons = new Commons();
+	let _commons = new Commons('view-wifi');
 	let _timeoutInterval = -1;
 	let _connectTimeout = 60;
 	this.init = ()=> {
@@ -332,7 +347,7 @@ let WifiConfig = new function() {
 	function setEvents() {
 		_commons.setCommitButtonClickEvent(()=> { connectWifi(); });
 		_commons.setNextButtonClickEvent(() => {
-			location.href = "time.html";
+			Router.go('time');
 		});
 	}
 
@@ -389,6 +404,7 @@ let WifiConfig = new function() {
 
 	function scanWifi() {
 		_commons.showLoading();
+		_commons.changeLoadingMessage(`Scanning...`, false);
 		_wifiList = [];
 		Client.scanWifi((isSuccess,wifiList) => {
 			if(!isSuccess) {
@@ -468,7 +484,7 @@ let TimeConfig = new function() {
 	let _eleInputManuallyUtc;
 	let _eleBlockTimeOffset;
 	let _intervalID;
-	let _commons = new Commons();
+	let _commons = new Commons('view-time');
 
 	/** Date **/
 	let _date;
@@ -513,7 +529,7 @@ let TimeConfig = new function() {
 		_eleSelectUtc.addEventListener('change',onChangeSelectTimezone);
 		_commons.setCommitButtonClickEvent(()=>  { setConfig();});
 		_commons.setNextButtonClickEvent(() => {
-			location.href = "mqtt.html";
+			Router.go('mqtt');
 		});
 	}
 
@@ -620,7 +636,7 @@ let MqttConfig = new function() {
 	let _eleInputClientID;
 	let _eleInputUser;
 	let _eleInputPassword;
-	let _commons = new Commons();
+	let _commons = new Commons('view-mqtt');
 
 
 	this.init = () => {
@@ -634,7 +650,7 @@ let MqttConfig = new function() {
 	function setEvents() {
 		_commons.setCommitButtonClickEvent(()=>  { setConfig();});
 		_commons.setNextButtonClickEvent(() => {
-			location.href = "option.html";
+			Router.go('option');
 		});
 	}
 	  
@@ -707,9 +723,7 @@ let OptionConfig = new function() {
 	
 	let _eleOptions;
 	let _optionList = [];
-	let _uploadedOptionCount = -1;
-	let _isSuccess = true;
-	let _commons = new Commons();
+	let _commons = new Commons('view-option');
 
 	this.init = () => {
 		initEleValue();
@@ -722,7 +736,7 @@ let OptionConfig = new function() {
 			setOption();
 		});
 		_commons.setNextButtonClickEvent(() => {
-			location.href = "finish.html";
+			Router.go('finish');
 		});
 	}
 
@@ -734,56 +748,43 @@ let OptionConfig = new function() {
 
 
 	function setOption() {
-		_commons.showLoading();
-		_isSuccess = true; 
-		_uploadedOptionCount = _optionList.length;
 		let labels = document.getElementsByClassName('label-option-name');
 		let inputValueEles = document.getElementsByClassName('input-option-value');
 		let errorMsgEles = document.getElementsByClassName('error-msg');
+		let options = [];
+		let isValid = true;
 		for(let i = 0; i < inputValueEles.length; ++i) {
 			errorMsgEles[i].textContent = '';
 			labels[i].style.color = 'black';   
 			if(!isNull(inputValueEles[i].name) && inputValueEles[i].value == '') {
 				errorMsgEles[i].textContent = 'Empty values ​​are not allowed.';
 				labels[i].style.color = 'red';
-				--_uploadedOptionCount;
-				_isSuccess = false; 
+				isValid = false; 
 				continue;
 			}
-			uploadOption(inputValueEles[i].name,inputValueEles[i].value,labels[i],errorMsgEles[i]);
+			options.push({name: inputValueEles[i].name, value: inputValueEles[i].value});
 		}
-
-
-	}
-
-	function uploadOption(name, value,lebelEle, eleResultMsg) {
-
-		Client.updateOption(name, value, (success, message, error) => {
-			try {
-				console.log(message)
-
-				if(message && message != '') {
-					eleResultMsg.textContent = (message ? message : 'Invalid value.');
-					lebelEle.style.color = 'red';
-					_isSuccess = false; 
-				} else if(!success) {
-					console.log('쉴패!!')
-					console.log(message)
-					console.log(error)
-					if(error && error.status == 404) {
-						_commons.showConnectionError();
-					}
-					_isSuccess = false; 
+		if(!isValid) {
+			_commons.showResult(false, 'Invalid option value.');
+			return;
+		}
+		_commons.showLoading();
+		Client.updateOptions(options, (success, errors, error) => {
+			_commons.hideLoading();
+			if(error) {
+				if(error.status == 404) _commons.showConnectionError();
+				else _commons.showResult(false, 'Invalid option value.');
+				return;
+			}
+			for(let err of (errors || [])) {
+				for(let i = 0; i < inputValueEles.length; ++i) {
+					if(inputValueEles[i].name != err.name) continue;
+					errorMsgEles[i].textContent = err.msg ? err.msg : 'Invalid value.';
+					labels[i].style.color = 'red';
 				}
-
-				if(--_uploadedOptionCount == 0) {				
-					_commons.hideLoading();
-					if(_isSuccess) _commons.showResult(true, 'Options applied.');
-					else _commons.showResult(false, 'Invalid option value.');
-				} 
-			} catch(e) {
-				console.error(e);
 			}
+			if(success) _commons.showResult(true, 'Options applied.');
+			else _commons.showResult(false, 'Invalid option value.');
 		});
 	}
 
@@ -859,13 +860,11 @@ let OptionConfig = new function() {
 let FinishView = new function() {
 	let _eleConfigInfo;
 	let _tag = '';
-	let _commons = new Commons();
+	let _commons = new Commons('view-finish');
 
 	this.init = () => {
-		_tag = '';
 		_eleConfigInfo = document.getElementById('config-info');
 		_commons.initCommonEles();
-		_commons.showLoading();
 		_commons.setCommitButtonClickEvent(() => {
 			_commons.showLoading();
 			Client.commit((success) => {
@@ -881,8 +880,14 @@ let FinishView = new function() {
 			
 			
 		});
-		loadConfigInfo();
+		this.show();
+	}
 
+	// 다른 단계에서 바꾼 값을 보여주기 위해 이 단계로 올 때마다 다시 읽는다.
+	this.show = () => {
+		_tag = '';
+		_commons.showLoading();
+		loadConfigInfo();
 	}
 
 	function loadConfigInfo() {
@@ -951,3 +956,42 @@ let FinishView = new function() {
 	}
 
 }
+
+
+
+// 주소의 hash (#wifi, #time ...) 로 단계를 바꾼다. 각 단계는 처음 보일 때 한 번만 init() 한다.
+let Router = new function() {
+	let _views = {
+		wifi: WifiConfig,
+		time: TimeConfig,
+		mqtt: MqttConfig,
+		option: OptionConfig,
+		finish: FinishView
+	};
+	let _initialized = {};
+
+	this.init = () => {
+		window.addEventListener('hashchange', onHashChange);
+		onHashChange();
+	}
+
+	this.go = (name) => {
+		location.hash = name;
+	}
+
+	function onHashChange() {
+		let name = location.hash.replace('#', '');
+		if(!_views[name]) {
+			name = 'wifi';
+		}
+		for(let key in _views) {
+			document.getElementById(`view-${key}`).hidden = key != name;
+		}
+		if(!_initialized[name]) {
+			_initialized[name] = true;
+			_views[name].init();
+		} else if(_views[name].show) {
+			_views[name].show();
+		}
+	}
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * 재연결 간격 계산. (Exponential backoff with full jitter)
+ * 실패할 때마다 대기 시간의 상한을 base * 2^n 으로 늘리고 (cap 을 넘지 않는다), 실제 대기 시간은 0 ~ 상한 사이에서 무작위로 정한다.
+ * 브로커나 AP 가 재시작되어 여러 장치가 동시에 끊어져도 재연결 시점이 흩어진다.
+ * random() 은 Config::randomID() 가 부팅 직후 randomSeed(millis()) 로 초기화하므로 모든 장치에서 같은 값이 나온다.
+ * 그래서 하드웨어 난수 생성기(ESP.random())를 사용한다.
+ *
+ *   if(backoff.ready()) {
+ *     if(tryConnect()) backoff.reset();
+ *     else backoff.fail();
+ *   }
+ */
+
+// 지수가 이 값보다 커지면 어차피 cap 에 걸리므로 shift overflow 만 막는다.
+#define BACKOFF_MAX_EXPONENT 16
+
+
+class Backoff {
+  private :
+    unsigned long _base;
+    unsigned long _cap;
+    uint16_t _attempts;
+    unsigned long _failedMillis;
+    unsigned long _delay;
+
+  public :
+    Backoff(unsigned long base, unsigned long cap);
+
+    bool ready() const;
+    void fail();
+    void reset();
+
+    uint16_t attempts() const;
+    unsigned long nextRetryIn() const;
+    unsigned long nextRetryMillis() const;
+};
+
+
+Backoff::Backoff(unsigned long base, unsigned long cap) : _base(base), _cap(cap), _attempts(0), _failedMillis(0), _delay(0) {
+}
+
+// 실패한 적이 없거나 대기 시간이 지났으면 true.
+bool Backoff::ready() const {
+  return _attempts == 0 || millis() - _failedMillis >= _delay;
+}
+
+void Backoff::fail() {
+  unsigned long limit = _base << (_attempts < BACKOFF_MAX_EXPONENT ? _attempts : BACKOFF_MAX_EXPONENT);
+  if(limit > _cap || limit < _base) limit = _cap;
+  if(_attempts < 0xFFFF) ++_attempts;
+  _failedMillis = millis();
+  _delay = limit + 1 == 0 ? ESP.random() : ESP.random() % (limit + 1);
+  #ifdef _DEBUG_
+  Serial.print("backoff: ");
+  Serial.print(_attempts);
+  Serial.print(" / ");
+  Serial.println(_delay);
+  #endif
+}
+
+void Backoff::reset() {
+  _attempts = 0;
+  _delay = 0;
+}
+
+// 연속으로 실패한 횟수. 성공하면 0 이 된다.
+uint16_t Backoff::attempts() const {
+  return _attempts;
+}
+
+// 다음 시도까지 남은 시간. (ms)
+unsigned long Backoff::nextRetryIn() const {
+  if(ready()) return 0;
+  return _delay - (millis() - _failedMillis);
+}
+
+// 다음 시도가 가능한 millis() 값.
+unsigned long Backoff::nextRetryMillis() const {
+  if(_attempts == 0) return millis();
+  return _failedMillis + _delay;
+}
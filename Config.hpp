@@ -3,14 +3,16 @@
 #define CONFIG_WIZARD_CONFIG.HPP
 
 
-#include "LinkedList.hpp"
 #include "UserOption.hpp"
+#include "OptionTable.hpp"
+#include "OptionSchema.hpp"
 
 #define CONFIG_OFFSET 64
 #define BUFF_SIZE 64
 
 
 class Config {
+ friend class ConfigFile;
  private : 
   String _version;
   String _deviceName;
@@ -29,7 +31,8 @@ class Config {
   String _ntpServer;
   long _timeOffset;
   uint16_t _ntpUpdateInterval;
-  LinkedList<UserOption*> *_userOptionList;
+  OptionTable _options;
+  mutable int _optionCursor;
 
 
   public : 
@@ -62,9 +65,26 @@ class Config {
     const char* getMQTTUser();
     void setMQTTPassword(String mqttPass);
     const char* getMQTTPassword();
-    UserOption* addOption(String name, String defaultValue,bool isNull);
-	const char* getOption(String name);
+    int addOption(String name, String defaultValue,bool isNull);
+    int addOption(String name, String defaultValue,bool isNull, uint8_t type, PGM_P choices = NULL);
+    int addOptionSchema(const OptionSpec* schema, int count);
+    template<size_t N> int addOptionSchema(const OptionSpec (&schema)[N]) { return addOptionSchema(schema, (int)N); }
+    int getOptionHandle(const char* name) const;
+    UserOption* getUserOption(int handle) const;
+	const char* getOption(const char* name);
+	const char* getOption(const String& name);
+	const char* getOption(int handle);
+	size_t getOption(int handle, char* buffer, size_t size);
+    long getOptionInt(int handle) const;
+    long getOptionInt(const char* name) const;
+    float getOptionFloat(int handle) const;
+    float getOptionFloat(const char* name) const;
+    bool getOptionBool(int handle) const;
+    bool getOptionBool(const char* name) const;
+    int getOptionEnum(int handle) const;
+    int getOptionEnum(const char* name) const;
     bool setOptionValue(String name, String value);
+    bool setOptionValue(int handle, const char* value);
     int getOptionCount() const;
     void beginOption() const;
     UserOption* nextOption() const;
@@ -77,7 +97,7 @@ class Config {
     private: 
 
     void copy(const Config& conf);
-    UserOption* findOption(String name);
+    UserOption* findOption(const char* name);
 	char* randomID(char* buffer, int length);
 	  
 
@@ -85,8 +105,7 @@ class Config {
 
 
 
-Config::Config() : _ssid(""), _pass(""), _mqttAddress(""),_ntpServer("")   {
-  _userOptionList = new LinkedList<UserOption*>();
+Config::Config() : _ssid(""), _pass(""), _mqttAddress(""),_ntpServer(""), _optionCursor(0)   {
   _version = "0.0.0";
   _deviceName = "My Device";
 
@@ -109,15 +128,13 @@ Config::Config() : _ssid(""), _pass(""), _mqttAddress(""),_ntpServer("")   {
   _ntpUpdateInterval = 1440;
 }
 
-Config::Config(const Config& conf) {
-    _userOptionList = new LinkedList<UserOption*>();
+Config::Config(const Config& conf) : _optionCursor(0) {
     copy(conf);
 }
 
 Config::~Config() {
   
   clearOptions();
-  delete _userOptionList;
 }
 
 Config& Config::operator=(const Config& conf) {
@@ -232,48 +249,87 @@ const char* Config::getMQTTPassword() {
   return _mqttPass.c_str();
 }
 
-UserOption* Config::addOption(String name, String defaultValue,bool isNull) {
-  UserOption* userOption = findOption(name);  
-  if(userOption == NULL) {
-      userOption = new UserOption(name, defaultValue, isNull);
-      _userOptionList->Append(userOption);
-  } else {
+// 옵션 handle 을 반환한다. (이전 버전은 UserOption* 를 반환했다. UserOption 은 getUserOption(handle) 로 얻는다)
+int Config::addOption(String name, String defaultValue,bool isNull) {
+  return addOption(name, defaultValue, isNull, OPTION_TYPE_STRING, NULL);
+}
+
+int Config::addOption(String name, String defaultValue,bool isNull, uint8_t type, PGM_P choices) {
+  int handle = _options.add(name.c_str());
+  UserOption* userOption = _options.get(handle);
+  if(userOption != NULL) {
+    userOption->setType(type, choices);
     userOption->setDefaultValue(defaultValue);
     userOption->setIsNull(isNull);
-    
-	
   }
-  return userOption;
+  return handle;
+}
+
+int Config::addOptionSchema(const OptionSpec* schema, int count) {
+  int firstHandle = OPTION_INVALID_HANDLE;
+  for(int i = 0; i < count; ++i) {
+    OptionSpec spec;
+    memcpy_P(&spec, &schema[i], sizeof(OptionSpec));
+    int handle = _options.add_P(spec.name, spec.hash);
+    UserOption* userOption = _options.get(handle);
+    if(userOption == NULL) continue;
+    userOption->setType(spec.type, pgm_read_byte(spec.choices) == '\0' ? NULL : spec.choices);
+    userOption->setDefaultValue_P(spec.defaultValue);
+    userOption->setIsNull(spec.isNull);
+    if(i == 0) firstHandle = handle;
+  }
+  return firstHandle;
+}
+
+int Config::getOptionHandle(const char* name) const {
+  return _options.find(name);
+}
+
+UserOption* Config::getUserOption(int handle) const {
+  return _options.get(handle);
 }
 
 bool Config::setOptionValue(String name, String value) {
-  UserOption* option = findOption(name);
+  return setOptionValue(_options.find(name.c_str()), value.c_str());
+}
+
+bool Config::setOptionValue(int handle, const char* value) {
+  UserOption* option = _options.get(handle);
   
 
-  if(option == NULL || (value.isEmpty() && !option->isNull()) ) {
+  if(option == NULL || (strlen(value) == 0 && !option->isNull()) || strlen(value) > OPTION_VALUE_MAX_LENGTH) {
+    return false;
+  }
+  // 타입에 맞지 않는 값은 저장하지 않는다. 빈 값은 기본값을 의미한다.
+  if(strlen(value) > 0 && !option->isValidValue(value)) {
     return false;
   }
-  option->setValue(value);
+  // 기본값과 같은 값은 따로 보관하지 않는다.
+  if(option->equalsDefaultValue(value)) option->resetValue();
+  else option->setValue(value);
   return true; 
 }
 
 int Config::getOptionCount() const  {
-  return _userOptionList->getLength();
+  return _options.count();
 }
 
 
 void Config::beginOption() const  {
-  _userOptionList->moveToStart();
+  _optionCursor = 0;
 }
 
 UserOption* Config::nextOption() const {
-  if(_userOptionList->getLength() == 0) return NULL;
-  UserOption* option = _userOptionList->getCurrent();
-  _userOptionList->next();
+  UserOption* option = _options.get(_optionCursor);
+  if(option != NULL) ++_optionCursor;
   
   return option;
 }
 
+bool Config::hasMoreOption() const {
+  return _optionCursor < _options.count();
+}
+
 
 void Config::printConfig() {
     Serial.print("version: ");
@@ -321,9 +377,9 @@ void Config::printConfig() {
     for(int i = 0, n = getOptionCount(); i < n; ++i) {        
         UserOption* userOption = nextOption();
         Serial.print("    ");
-        Serial.print(userOption->getName());
+        userOption->printName(Serial);
         Serial.print(": ");
-        Serial.print(userOption->getValue());
+        userOption->printValue(Serial);
         Serial.println();
     }
 }
@@ -353,24 +409,13 @@ void Config::copy(const Config& conf) {
     _timeOffset = conf._timeOffset;
     _ntpUpdateInterval = conf._ntpUpdateInterval;
 
-    conf.beginOption();
-    for(int i = 0, n = conf.getOptionCount(); i < n; ++i) {        
-        UserOption* userOption = conf.nextOption();
-        UserOption* cpyUserOption = new UserOption(userOption->getName(), userOption->getDefaultValue(), userOption->isNull()); 
-        cpyUserOption->setValue(userOption->getValue());
-        _userOptionList->Append(cpyUserOption);
-    }
+    _options = conf._options;
+    _optionCursor = 0;
 }
 
 void Config::clearOptions() {
-    if(_userOptionList->getLength() == 0) return;
-    _userOptionList->moveToStart();
-    for(int i = 0, n = getOptionCount(); i < n; ++i) {
-        UserOption* userOption = nextOption();
-        delete userOption;
-    }
-    _userOptionList->Clear();
-    
+    _options.clear();
+    _optionCursor = 0;
 }
 
 char* Config::randomID(char* buffer, int length) {
@@ -389,22 +434,70 @@ char* Config::randomID(char* buffer, int length) {
   return buffer;
 }
 
-const char* Config::getOption(String name) {
+// 반환값은 옵션이 없어질 때까지 유효하다. 스키마 옵션의 기본값은 처음 읽을 때 RAM 으로 복사되므로 RAM 을 아끼려면 getOption(handle, buffer, size) 를 사용한다.
+const char* Config::getOption(const char* name) {
 	UserOption* option = findOption(name);
 	if(option == NULL) return NULL;
 	return option->getValue();
 }
 
-UserOption* Config::findOption(String name) {
-  if(_userOptionList->getLength() == 0) return NULL;
-    _userOptionList->moveToStart();
-    for(int i = 0, n = getOptionCount(); i < n; ++i) {
-        UserOption* userOption =  nextOption();
-        if(strcmp(name.c_str(), userOption->getName()) == 0) {
-          return userOption;
-        }  
-    }
-    return NULL;
+size_t Config::getOption(int handle, char* buffer, size_t size) {
+	UserOption* option = _options.get(handle);
+	if(option == NULL) {
+		if(size > 0) buffer[0] = '\0';
+		return 0;
+	}
+	return option->copyValue(buffer, size);
+}
+
+const char* Config::getOption(const String& name) {
+	return getOption(name.c_str());
+}
+
+const char* Config::getOption(int handle) {
+	UserOption* option = _options.get(handle);
+	if(option == NULL) return NULL;
+	return option->getValue();
+}
+
+long Config::getOptionInt(int handle) const {
+  UserOption* option = _options.get(handle);
+  return option == NULL ? 0 : option->getInt();
+}
+
+long Config::getOptionInt(const char* name) const {
+  return getOptionInt(_options.find(name));
+}
+
+float Config::getOptionFloat(int handle) const {
+  UserOption* option = _options.get(handle);
+  return option == NULL ? 0 : option->getFloat();
+}
+
+float Config::getOptionFloat(const char* name) const {
+  return getOptionFloat(_options.find(name));
+}
+
+bool Config::getOptionBool(int handle) const {
+  UserOption* option = _options.get(handle);
+  return option == NULL ? false : option->getBool();
+}
+
+bool Config::getOptionBool(const char* name) const {
+  return getOptionBool(_options.find(name));
+}
+
+int Config::getOptionEnum(int handle) const {
+  UserOption* option = _options.get(handle);
+  return option == NULL ? -1 : option->getEnum();
+}
+
+int Config::getOptionEnum(const char* name) const {
+  return getOptionEnum(_options.find(name));
+}
+
+UserOption* Config::findOption(const char* name) {
+  return _options.get(_options.find(name));
 }
 
 
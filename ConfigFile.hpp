@@ -0,0 +1,844 @@
+#pragma once
+
+#include <LittleFS.h>
+#include "Config.hpp"
+
+/**
+ * 설정 파일 포맷. (Config file format, little-endian)
+ *
+ *  header  : magic(u32) format(u8) field count(u8) option count(u16) generation(u32) payload length(u32)
+ *  fields  : field count 만큼 [length(u16)][data][\0]  (CONFIG_FIELD_* 순서)
+ *  options : option count 만큼 [name hash(u32)][name length(u8)][name][\0][value length(u16)][value][\0]
+ *  crc32   : header + payload 의 CRC32
+ *
+ * 파일은 한 번에 읽어서 버퍼 위에서 바로 파싱한다. 문자열 뒤에 '\0' 을 저장하므로 String 임시 객체가 필요 없다.
+ * 기본값을 그대로 쓰는 옵션은 저장하지 않는다.
+ *
+ * 설정은 두 개의 슬롯(A/B) 파일에 번갈아 저장한다. 저장할 때는 항상 현재 사용하지 않는 슬롯에 쓰고,
+ * 읽을 때는 CRC 가 맞는 슬롯 중 generation 이 가장 큰 것을 사용한다.
+ * 쓰는 도중 전원이 꺼져도 이전 슬롯이 그대로 남아 있으므로 설정을 잃지 않는다.
+ * 내용이 바뀌지 않았으면 아무것도 쓰지 않는다. (flash 지우기 횟수를 줄이기 위해)
+ *
+ * 슬롯에 저장된 설정(snapshot) 이후에 바뀐 필드와 옵션은 journal 파일 뒤에 레코드로 덧붙인다.
+ *  journal : magic(u32) base generation(u32) 뒤로 레코드가 이어진다.
+ *  record  : [kind(u8)][key(u32)][length(u16)][data][\0][crc32(u32)]
+ *            field 의 key 는 CONFIG_FIELD_*, data 는 snapshot 과 같다.
+ *            option 의 key 는 이름의 해시값, data 는 [name][\0][value] 이다. 빈 값은 기본값으로 되돌린다.
+ * 읽을 때는 snapshot 의 generation 과 같은 journal 만 CRC 가 맞는 레코드까지 적용한다.
+ * journal 이 CONFIG_JOURNAL_MAX_SIZE 를 넘으면 전체를 새 슬롯에 저장(compaction)하고 journal 을 지운다.
+ *
+ * OPTION_TYPE_BLOB 옵션의 값은 CONFIG_BLOB_DIRECTORY 아래 "<이름의 해시값>-<crc32>" 파일에 따로 저장한다.
+ * 설정에는 "<크기>:<crc32>" descriptor 만 남고, 값은 openOption() 이 반환하는 File 로 필요할 때 읽는다.
+ * 새 값은 다른 이름의 파일에 쓰므로 descriptor 가 저장되기 전까지 이전 값의 파일은 그대로 남는다.
+ * 설정이 저장(혹은 읽기)된 뒤에 descriptor 가 가리키지 않는 파일을 지운다.
+ */
+
+#define CONFIG_FILE_MAGIC 0x46435745UL // "EWCF"
+#define CONFIG_FILE_FORMAT 2
+#define CONFIG_FILE_HEADER_SIZE 16
+// format 1 은 generation 이 없는 12 byte 헤더를 사용한다.
+#define CONFIG_FILE_HEADER_SIZE_V1 12
+#define CONFIG_FILE_MAX_SIZE 8192
+
+// 이전 버전의 텍스트 설정 파일. 첫 줄이 이 버전이면 텍스트 포맷으로 읽는다.
+#define CONFIG_FILE_LEGACY_VERSION "0.9.0"
+
+#define CONFIG_FIELD_VERSION 0
+#define CONFIG_FIELD_DEVICE_NAME 1
+#define CONFIG_FIELD_WIFI_SSID 2
+#define CONFIG_FIELD_WIFI_PASSWORD 3
+#define CONFIG_FIELD_NTP_SERVER 4
+#define CONFIG_FIELD_NTP_UPDATE_INTERVAL 5
+#define CONFIG_FIELD_TIME_OFFSET 6
+#define CONFIG_FIELD_MQTT_ADDRESS 7
+#define CONFIG_FIELD_MQTT_PORT 8
+#define CONFIG_FIELD_MQTT_CLIENT_ID 9
+#define CONFIG_FIELD_MQTT_USER 10
+#define CONFIG_FIELD_MQTT_PASSWORD 11
+#define CONFIG_FIELD_COUNT 12
+
+#define CONFIG_SLOT_UNKNOWN -2
+#define CONFIG_SLOT_NONE -1
+
+#define CONFIG_JOURNAL_MAGIC 0x4A435745UL // "EWCJ"
+#define CONFIG_JOURNAL_HEADER_SIZE 8
+#define CONFIG_JOURNAL_MAX_SIZE 2048
+#define CONFIG_RECORD_FIELD 1
+#define CONFIG_RECORD_OPTION 2
+// kind(1) + key(4) + length(2) + '\0'(1) + crc(4)
+#define CONFIG_RECORD_OVERHEAD 12
+
+#define CONFIG_BLOB_DIRECTORY "/opt"
+#define CONFIG_BLOB_PATH_SIZE 24
+#define CONFIG_BLOB_BUFFER_SIZE 128
+
+
+class ConfigFile {
+  private :
+    const char* _paths[2];
+    const char* _journalPath;
+    int8_t _activeSlot;
+    uint32_t _generation;
+    // 현재 슬롯의 payload CRC. 저장할 내용이 같으면 쓰지 않는다.
+    uint32_t _payloadCrc;
+    // 0 이면 journal 을 새로 만든다.
+    size_t _journalSize;
+    // 마지막으로 저장(혹은 읽은) 값의 CRC. 이 값과 다른 필드와 옵션만 journal 에 기록한다.
+    uint32_t _fieldCrcs[CONFIG_FIELD_COUNT];
+    uint32_t* _optionCrcs;
+    int _optionCrcCount;
+
+  public :
+    ConfigFile(const char* path, const char* backupPath, const char* journalPath);
+    ConfigFile(const ConfigFile&) = delete;
+    ConfigFile& operator=(const ConfigFile&) = delete;
+    ~ConfigFile();
+    bool save(Config& config);
+    bool compact(Config& config);
+    bool load(Config& config);
+    int getActiveSlot() const;
+    uint32_t getGeneration() const;
+
+    bool writeOption(Config& config, int handle, Stream& in, size_t length);
+    bool writeOption(Config& config, int handle, const uint8_t* data, size_t length);
+    File openOption(Config& config, int handle);
+    void removeUnusedBlobs(Config& config);
+
+    static uint32_t crc32(const uint8_t* data, size_t length, uint32_t crc = 0);
+
+  private :
+    uint8_t* readActiveSlot(size_t* size);
+    void replayJournal(Config& config);
+    bool applyRecord(Config& config, uint8_t kind, uint32_t key, const uint8_t* data, uint16_t length);
+    size_t serializeChanges(Config& config, uint8_t* buffer);
+    size_t serializeRecord(uint8_t* buffer, size_t offset, uint8_t kind, uint32_t key, UserOption* option, const uint8_t* data, uint16_t length);
+    void rememberState(Config& config);
+    uint32_t optionCrc(UserOption* option, bool useValue);
+    const uint8_t* fieldData(Config& config, int field, int32_t* number, uint16_t* length);
+    bool writeBlob(Config& config, int handle, Stream* in, const uint8_t* data, size_t length);
+    static bool isUnusedBlob(Config& config, const char* name);
+    static void blobPath(uint32_t hash, uint32_t crc, char* path);
+    static uint32_t blobCrc(UserOption* option);
+    static uint32_t crc32(File& file);
+    uint8_t* readSlot(int slot, size_t* size);
+    bool verify(const uint8_t* buffer, size_t size, uint32_t* generation);
+    size_t serialize(Config& config, uint8_t* buffer, uint32_t generation);
+    size_t serializeField(Config& config, int field, uint8_t* buffer, size_t offset);
+    bool parse(Config& config, uint8_t* buffer, size_t size);
+    bool parseField(Config& config, int field, const uint8_t* data, uint16_t length);
+    bool parseLegacy(Config& config, char* buffer, size_t size);
+
+    static size_t put(uint8_t* buffer, size_t offset, const void* data, size_t length);
+    static size_t putString(uint8_t* buffer, size_t offset, const char* value, size_t length);
+};
+
+
+static const uint32_t CONFIG_CRC32_TABLE[16] PROGMEM = {
+  0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+  0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+
+ConfigFile::ConfigFile(const char* path, const char* backupPath, const char* journalPath) : _journalPath(journalPath), _activeSlot(CONFIG_SLOT_UNKNOWN), _generation(0), _payloadCrc(0), _journalSize(0), _optionCrcs(NULL), _optionCrcCount(0) {
+  _paths[0] = path;
+  _paths[1] = backupPath;
+  memset(_fieldCrcs, 0, sizeof(_fieldCrcs));
+}
+
+ConfigFile::~ConfigFile() {
+  free(_optionCrcs);
+}
+
+int ConfigFile::getActiveSlot() const {
+  return _activeSlot;
+}
+
+uint32_t ConfigFile::getGeneration() const {
+  return _generation;
+}
+
+bool ConfigFile::writeOption(Config& config, int handle, Stream& in, size_t length) {
+  return writeBlob(config, handle, &in, NULL, length);
+}
+
+bool ConfigFile::writeOption(Config& config, int handle, const uint8_t* data, size_t length) {
+  return writeBlob(config, handle, NULL, data, length);
+}
+
+// 파일의 크기나 CRC 가 descriptor 와 다르면 (flash 의 내용이 손상된 경우) 열지 않는다.
+File ConfigFile::openOption(Config& config, int handle) {
+  UserOption* option = config.getUserOption(handle);
+  if(option == NULL || option->getType() != OPTION_TYPE_BLOB || !option->hasValue()) {
+    return File();
+  }
+  char path[CONFIG_BLOB_PATH_SIZE];
+  uint32_t crc = blobCrc(option);
+  blobPath(option->getHash(), crc, path);
+  File file = LittleFS.open(path, "r");
+  if(file && (file.size() != option->getBlobSize() || crc32(file) != crc || !file.seek(0))) {
+    #ifdef _DEBUG_
+    Serial.print("Option file mismatch : ");
+    Serial.println(path);
+    #endif
+    file.close();
+    return File();
+  }
+  return file;
+}
+
+uint32_t ConfigFile::crc32(const uint8_t* data, size_t length, uint32_t crc) {
+  crc = ~crc;
+  for(size_t i = 0; i < length; ++i) {
+    crc = pgm_read_dword(&CONFIG_CRC32_TABLE[(crc ^ data[i]) & 0x0F]) ^ (crc >> 4);
+    crc = pgm_read_dword(&CONFIG_CRC32_TABLE[(crc ^ (data[i] >> 4)) & 0x0F]) ^ (crc >> 4);
+  }
+  return ~crc;
+}
+
+bool ConfigFile::save(Config& config) {
+  // 읽은 적이 없거나 snapshot 이 없으면 바뀐 값을 알 수 없으므로 전체를 저장한다.
+  if(_activeSlot < 0) {
+    return compact(config);
+  }
+  size_t size = serializeChanges(config, NULL);
+  if(size == 0) {
+    return true;
+  }
+  size_t headerSize = _journalSize == 0 ? CONFIG_JOURNAL_HEADER_SIZE : 0;
+  if(_journalSize + headerSize + size > CONFIG_JOURNAL_MAX_SIZE) {
+    return compact(config);
+  }
+  uint8_t* buffer = (uint8_t*)malloc(headerSize + size);
+  if(buffer == NULL) {
+    return false;
+  }
+  if(headerSize > 0) {
+    uint32_t magic = CONFIG_JOURNAL_MAGIC;
+    put(buffer, put(buffer, 0, &magic, sizeof(magic)), &_generation, sizeof(_generation));
+  }
+  serializeChanges(config, buffer + headerSize);
+
+  File file = LittleFS.open(_journalPath, _journalSize == 0 ? "w" : "a");
+  if(!file) {
+    #ifdef _DEBUG_
+    Serial.println("Failed to open config journal for writing");
+    #endif
+    free(buffer);
+    return false;
+  }
+  size_t written = file.write(buffer, headerSize + size);
+  file.close();
+  free(buffer);
+  if(written != headerSize + size) {
+    // 일부만 쓰였을 수 있으므로 다음 저장에서 compaction 한다.
+    _journalSize = CONFIG_JOURNAL_MAX_SIZE;
+    return false;
+  }
+  _journalSize += headerSize + size;
+  rememberState(config);
+  return true;
+}
+
+bool ConfigFile::compact(Config& config) {
+  // 한 번도 읽지 않았다면 어느 슬롯이 최신인지 먼저 확인한다.
+  if(_activeSlot == CONFIG_SLOT_UNKNOWN) {
+    size_t size;
+    free(readActiveSlot(&size));
+  }
+  uint32_t generation = _generation + 1;
+  size_t size = serialize(config, NULL, generation);
+  if(size > CONFIG_FILE_MAX_SIZE) {
+    return false;
+  }
+  uint8_t* buffer = (uint8_t*)malloc(size);
+  if(buffer == NULL) {
+    return false;
+  }
+  serialize(config, buffer, generation);
+
+  uint32_t payloadCrc = crc32(buffer + CONFIG_FILE_HEADER_SIZE, size - CONFIG_FILE_HEADER_SIZE - sizeof(uint32_t));
+  if(_activeSlot != CONFIG_SLOT_NONE && payloadCrc == _payloadCrc) {
+    #ifdef _DEBUG_
+    Serial.println("Config not changed. skip writing");
+    #endif
+    free(buffer);
+    if(_journalSize > 0) LittleFS.remove(_journalPath);
+    _journalSize = 0;
+    rememberState(config);
+    return true;
+  }
+
+  // 현재 슬롯은 건드리지 않는다. 처음 저장할 때는 B 슬롯부터 쓴다. (A 에 남아있는 이전 텍스트 포맷 보존)
+  int slot = _activeSlot == 1 ? 0 : 1;
+  File file = LittleFS.open(_paths[slot], "w");
+  if(!file) {
+    #ifdef _DEBUG_
+    Serial.println("Failed to open config file for writing");
+    #endif
+    free(buffer);
+    return false;
+  }
+  size_t written = file.write(buffer, size);
+  file.close();
+  free(buffer);
+  if(written != size) {
+    return false;
+  }
+  _activeSlot = slot;
+  _generation = generation;
+  _payloadCrc = payloadCrc;
+  // generation 이 바뀌었으므로 지우지 못해도 이전 journal 은 적용되지 않는다.
+  LittleFS.remove(_journalPath);
+  _journalSize = 0;
+  rememberState(config);
+  return true;
+}
+
+bool ConfigFile::load(Config& config) {
+  size_t size;
+  uint8_t* buffer = readActiveSlot(&size);
+  if(buffer != NULL) {
+    bool result = parse(config, buffer, size);
+    free(buffer);
+    if(result) {
+      replayJournal(config);
+      rememberState(config);
+    }
+    return result;
+  }
+  // 사용할 수 있는 슬롯이 없으면 이전 버전의 텍스트 설정 파일인지 확인한다.
+  buffer = readSlot(0, &size);
+  if(buffer == NULL) {
+    return false;
+  }
+  bool result = parseLegacy(config, (char*)buffer, size);
+  free(buffer);
+  return result;
+}
+
+uint8_t* ConfigFile::readActiveSlot(size_t* size) {
+  uint8_t* image = NULL;
+  _activeSlot = CONFIG_SLOT_NONE;
+  _generation = 0;
+  _payloadCrc = 0;
+  for(int slot = 0; slot < 2; ++slot) {
+    size_t slotSize;
+    uint32_t generation;
+    uint8_t* buffer = readSlot(slot, &slotSize);
+    if(buffer == NULL) continue;
+    // generation 이 한 바퀴 돌아도 비교할 수 있도록 차이의 부호로 판단한다.
+    if(!verify(buffer, slotSize, &generation) || (image != NULL && (int32_t)(generation - _generation) <= 0)) {
+      free(buffer);
+      continue;
+    }
+    free(image);
+    image = buffer;
+    *size = slotSize;
+    _activeSlot = slot;
+    _generation = generation;
+  }
+  if(image != NULL) {
+    size_t headerSize = image[4] == 1 ? CONFIG_FILE_HEADER_SIZE_V1 : CONFIG_FILE_HEADER_SIZE;
+    _payloadCrc = crc32(image + headerSize, *size - headerSize - sizeof(uint32_t));
+  }
+  return image;
+}
+
+void ConfigFile::replayJournal(Config& config) {
+  _journalSize = 0;
+  File file = LittleFS.open(_journalPath, "r");
+  if(!file) {
+    return;
+  }
+  size_t size = file.size();
+  if(size < CONFIG_JOURNAL_HEADER_SIZE || size > CONFIG_JOURNAL_MAX_SIZE) {
+    file.close();
+    return;
+  }
+  uint8_t* buffer = (uint8_t*)malloc(size);
+  if(buffer == NULL) {
+    file.close();
+    return;
+  }
+  size_t readSize = file.read(buffer, size);
+  file.close();
+
+  uint32_t magic;
+  uint32_t generation;
+  memcpy(&magic, buffer, sizeof(magic));
+  memcpy(&generation, buffer + sizeof(magic), sizeof(generation));
+  // 다른 snapshot 의 journal 은 무시한다. 다음 저장에서 새로 만든다.
+  if(readSize != size || magic != CONFIG_JOURNAL_MAGIC || generation != _generation) {
+    free(buffer);
+    return;
+  }
+
+  const uint8_t* pos = buffer + CONFIG_JOURNAL_HEADER_SIZE;
+  const uint8_t* end = buffer + size;
+  while(pos + CONFIG_RECORD_OVERHEAD <= end) {
+    uint32_t key;
+    uint16_t length;
+    uint32_t crc;
+    memcpy(&key, pos + 1, sizeof(key));
+    memcpy(&length, pos + 5, sizeof(length));
+    if(pos + CONFIG_RECORD_OVERHEAD + length > end) break;
+    const uint8_t* data = pos + 7;
+    memcpy(&crc, data + length + 1, sizeof(crc));
+    if(data[length] != '\0' || crc32(pos, 7 + length + 1) != crc) break;
+    applyRecord(config, pos[0], key, data, length);
+    pos += CONFIG_RECORD_OVERHEAD + length;
+  }
+  #ifdef _DEBUG_
+  Serial.print("Config journal replayed : ");
+  Serial.println((int)(pos - buffer));
+  #endif
+  // 마지막 레코드가 깨졌다면 (쓰는 도중 전원이 꺼진 경우) 그 뒤에 덧붙일 수 없으므로 다음 저장에서 compaction 한다.
+  _journalSize = pos == end ? size : CONFIG_JOURNAL_MAX_SIZE;
+  free(buffer);
+}
+
+bool ConfigFile::applyRecord(Config& config, uint8_t kind, uint32_t key, const uint8_t* data, uint16_t length) {
+  if(kind == CONFIG_RECORD_FIELD) {
+    return key < CONFIG_FIELD_COUNT && parseField(config, key, data, length);
+  }
+  if(kind != CONFIG_RECORD_OPTION) {
+    return false;
+  }
+  const char* name = (const char*)data;
+  size_t nameLength = strlen(name);
+  if(nameLength >= length) return false;
+  const char* value = name + nameLength + 1;
+  int handle = config._options.find(name, key);
+  UserOption* option = config._options.get(handle);
+  if(option == NULL) return false;
+  if(*value == '\0') {
+    option->resetValue();
+    return true;
+  }
+  return config.setOptionValue(handle, value);
+}
+
+size_t ConfigFile::serializeChanges(Config& config, uint8_t* buffer) {
+  size_t offset = 0;
+  for(int field = 0; field < CONFIG_FIELD_COUNT; ++field) {
+    int32_t number;
+    uint16_t length;
+    const uint8_t* data = fieldData(config, field, &number, &length);
+    if(crc32(data, length, field) != _fieldCrcs[field]) {
+      offset = serializeRecord(buffer, offset, CONFIG_RECORD_FIELD, field, NULL, data, length);
+    }
+  }
+  for(int handle = 0, n = config.getOptionCount(); handle < n; ++handle) {
+    UserOption* option = config.getUserOption(handle);
+    if(option->getNameLength() > UINT8_MAX) continue;
+    // 마지막으로 저장한 뒤에 추가된 옵션은 기본값이었던 것으로 본다.
+    uint32_t previous = handle < _optionCrcCount ? _optionCrcs[handle] : optionCrc(option, false);
+    if(optionCrc(option, true) != previous) {
+      const char* value = option->hasValue() ? option->getValue() : "";
+      offset = serializeRecord(buffer, offset, CONFIG_RECORD_OPTION, option->getHash(), option, (const uint8_t*)value, strlen(value));
+    }
+  }
+  return offset;
+}
+
+size_t ConfigFile::serializeRecord(uint8_t* buffer, size_t offset, uint8_t kind, uint32_t key, UserOption* option, const uint8_t* data, uint16_t length) {
+  size_t start = offset;
+  uint16_t recordLength = option == NULL ? length : option->getNameLength() + 1 + length;
+  offset = put(buffer, offset, &kind, sizeof(kind));
+  offset = put(buffer, offset, &key, sizeof(key));
+  offset = put(buffer, offset, &recordLength, sizeof(recordLength));
+  if(option != NULL) {
+    if(buffer != NULL) option->copyName((char*)buffer + offset);
+    offset += option->getNameLength() + 1;
+  }
+  offset = putString(buffer, offset, (const char*)data, length);
+  if(buffer != NULL) {
+    uint32_t crc = crc32(buffer + start, offset - start);
+    put(buffer, offset, &crc, sizeof(crc));
+  }
+  return offset + sizeof(uint32_t);
+}
+
+// 저장(혹은 읽은) 내용과 config 가 같아졌을 때 호출된다.
+void ConfigFile::rememberState(Config& config) {
+  removeUnusedBlobs(config);
+  for(int field = 0; field < CONFIG_FIELD_COUNT; ++field) {
+    int32_t number;
+    uint16_t length;
+    const uint8_t* data = fieldData(config, field, &number, &length);
+    _fieldCrcs[field] = crc32(data, length, field);
+  }
+  int count = config.getOptionCount();
+  if(count != _optionCrcCount) {
+    uint32_t* optionCrcs = (uint32_t*)realloc(_optionCrcs, count * sizeof(uint32_t));
+    if(optionCrcs == NULL && count > 0) {
+      // 비교할 값이 없으면 모든 옵션을 기본값이었던 것으로 본다.
+      _optionCrcCount = 0;
+      return;
+    }
+    _optionCrcs = optionCrcs;
+    _optionCrcCount = count;
+  }
+  for(int handle = 0; handle < count; ++handle) {
+    _optionCrcs[handle] = optionCrc(config.getUserOption(handle), true);
+  }
+}
+
+// 해시값을 함께 넣어서 handle 이 다른 옵션을 가리키게 되어도 같은 값으로 보지 않게 한다.
+uint32_t ConfigFile::optionCrc(UserOption* option, bool useValue) {
+  uint32_t hash = option->getHash();
+  const char* value = useValue && option->hasValue() ? option->getValue() : "";
+  return crc32((const uint8_t*)value, strlen(value), crc32((const uint8_t*)&hash, sizeof(hash)));
+}
+
+// 임시 파일에 모두 쓴 뒤 CRC 로 만든 이름으로 rename 한다. 이전 값의 파일은 설정이 저장된 뒤에 지워진다.
+bool ConfigFile::writeBlob(Config& config, int handle, Stream* in, const uint8_t* data, size_t length) {
+  UserOption* option = config.getUserOption(handle);
+  if(option == NULL || option->getType() != OPTION_TYPE_BLOB) {
+    return false;
+  }
+  if(length == 0) {
+    option->resetValue();
+    return true;
+  }
+  char path[CONFIG_BLOB_PATH_SIZE];
+  char tempPath[CONFIG_BLOB_PATH_SIZE];
+  snprintf(tempPath, CONFIG_BLOB_PATH_SIZE, CONFIG_BLOB_DIRECTORY "/%08lx.tmp", (unsigned long)option->getHash());
+  File file = LittleFS.open(tempPath, "w");
+  if(!file) {
+    return false;
+  }
+  uint8_t buffer[CONFIG_BLOB_BUFFER_SIZE];
+  uint32_t crc = 0;
+  size_t remain = length;
+  while(remain > 0) {
+    size_t size = remain < CONFIG_BLOB_BUFFER_SIZE ? remain : CONFIG_BLOB_BUFFER_SIZE;
+    const uint8_t* chunk = data + (length - remain);
+    if(in != NULL) {
+      size = in->readBytes((char*)buffer, size);
+      chunk = buffer;
+    }
+    if(size == 0 || file.write(chunk, size) != size) break;
+    crc = crc32(chunk, size, crc);
+    remain -= size;
+  }
+  file.close();
+  if(remain == 0) blobPath(option->getHash(), crc, path);
+  if(remain > 0 || !LittleFS.rename(tempPath, path)) {
+    LittleFS.remove(tempPath);
+    return false;
+  }
+  char descriptor[OPTION_BLOB_DESCRIPTOR_SIZE];
+  snprintf(descriptor, OPTION_BLOB_DESCRIPTOR_SIZE, "%lu:%08lx", (unsigned long)length, (unsigned long)crc);
+  return config.setOptionValue(handle, descriptor);
+}
+
+// config 가 가리키지 않는 값 파일을 지운다. 설정을 저장하거나 읽은 뒤에는 자동으로 호출된다.
+// Dir 로 읽는 도중에는 파일을 지우지 않고, 하나를 지울 때마다 처음부터 다시 찾는다.
+void ConfigFile::removeUnusedBlobs(Config& config) {
+  char path[CONFIG_BLOB_PATH_SIZE];
+  while(true) {
+    bool found = false;
+    Dir dir = LittleFS.openDir(CONFIG_BLOB_DIRECTORY);
+    while(dir.next()) {
+      String name = dir.fileName();
+      if(!isUnusedBlob(config, name.c_str())) continue;
+      snprintf(path, CONFIG_BLOB_PATH_SIZE, CONFIG_BLOB_DIRECTORY "/%s", name.c_str());
+      found = true;
+      break;
+    }
+    if(!found || !LittleFS.remove(path)) return;
+    #ifdef _DEBUG_
+    Serial.print("Remove unused option file : ");
+    Serial.println(path);
+    #endif
+  }
+}
+
+// 등록된 OPTION_TYPE_BLOB 옵션의 파일 중 descriptor 가 가리키지 않는 파일. (이전 값, 저장하지 못한 값, 임시 파일)
+bool ConfigFile::isUnusedBlob(Config& config, const char* name) {
+  char path[CONFIG_BLOB_PATH_SIZE];
+  uint32_t hash = strtoul(name, NULL, 16);
+  for(int handle = 0, n = config.getOptionCount(); handle < n; ++handle) {
+    UserOption* option = config.getUserOption(handle);
+    if(option->getType() != OPTION_TYPE_BLOB || option->getHash() != hash) continue;
+    if(!option->hasValue()) return true;
+    blobPath(hash, blobCrc(option), path);
+    return strcmp(path + sizeof(CONFIG_BLOB_DIRECTORY), name) != 0;
+  }
+  return false;
+}
+
+void ConfigFile::blobPath(uint32_t hash, uint32_t crc, char* path) {
+  snprintf(path, CONFIG_BLOB_PATH_SIZE, CONFIG_BLOB_DIRECTORY "/%08lx-%08lx", (unsigned long)hash, (unsigned long)crc);
+}
+
+// descriptor("<크기>:<crc32>")의 crc32.
+uint32_t ConfigFile::blobCrc(UserOption* option) {
+  const char* separator = strchr(option->getValue(), ':');
+  return separator == NULL ? 0 : strtoul(separator + 1, NULL, 16);
+}
+
+uint32_t ConfigFile::crc32(File& file) {
+  uint8_t buffer[CONFIG_BLOB_BUFFER_SIZE];
+  uint32_t crc = 0;
+  size_t size;
+  while((size = file.read(buffer, CONFIG_BLOB_BUFFER_SIZE)) > 0) {
+    crc = crc32(buffer, size, crc);
+  }
+  return crc;
+}
+
+uint8_t* ConfigFile::readSlot(int slot, size_t* size) {
+  File file = LittleFS.open(_paths[slot], "r");
+  if(!file) {
+    #ifdef _DEBUG_
+    Serial.print("Failed to open config file : ");
+    Serial.println(_paths[slot]);
+    #endif
+    return NULL;
+  }
+  *size = file.size();
+  if(*size == 0 || *size > CONFIG_FILE_MAX_SIZE) {
+    file.close();
+    return NULL;
+  }
+  // 텍스트 포맷을 위해 마지막에 '\0' 을 붙일 한 바이트를 더 잡는다.
+  uint8_t* buffer = (uint8_t*)malloc(*size + 1);
+  if(buffer == NULL) {
+    file.close();
+    return NULL;
+  }
+  size_t readSize = file.read(buffer, *size);
+  file.close();
+  if(readSize != *size) {
+    free(buffer);
+    return NULL;
+  }
+  buffer[*size] = '\0';
+  return buffer;
+}
+
+bool ConfigFile::verify(const uint8_t* buffer, size_t size, uint32_t* generation) {
+  uint32_t magic;
+  if(size < CONFIG_FILE_HEADER_SIZE_V1 + sizeof(uint32_t)) return false;
+  memcpy(&magic, buffer, sizeof(magic));
+  if(magic != CONFIG_FILE_MAGIC) return false;
+  uint8_t format = buffer[4];
+  size_t headerSize = format == 1 ? CONFIG_FILE_HEADER_SIZE_V1 : CONFIG_FILE_HEADER_SIZE;
+  if((format != 1 && format != CONFIG_FILE_FORMAT) || size < headerSize + sizeof(uint32_t)) return false;
+
+  uint32_t crc;
+  uint32_t payloadLength;
+  memcpy(&crc, buffer + size - sizeof(crc), sizeof(crc));
+  if(crc32(buffer, size - sizeof(crc)) != crc) {
+    #ifdef _DEBUG_
+    Serial.println("Config file CRC mismatch");
+    #endif
+    return false;
+  }
+  memcpy(&payloadLength, buffer + headerSize - sizeof(payloadLength), sizeof(payloadLength));
+  if(payloadLength != size - headerSize - sizeof(crc)) return false;
+  *generation = 0;
+  if(format != 1) memcpy(generation, buffer + 8, sizeof(*generation));
+  return true;
+}
+
+size_t ConfigFile::serialize(Config& config, uint8_t* buffer, uint32_t generation) {
+  size_t offset = CONFIG_FILE_HEADER_SIZE;
+  for(int field = 0; field < CONFIG_FIELD_COUNT; ++field) {
+    offset = serializeField(config, field, buffer, offset);
+  }
+
+  uint16_t optionCount = 0;
+  for(int handle = 0, n = config.getOptionCount(); handle < n; ++handle) {
+    UserOption* option = config.getUserOption(handle);
+    if(!option->hasValue() || option->getNameLength() > UINT8_MAX) continue;
+    uint32_t hash = option->getHash();
+    uint8_t nameLength = (uint8_t)option->getNameLength();
+    const char* value = option->getValue();
+    uint16_t valueLength = (uint16_t)strlen(value);
+    offset = put(buffer, offset, &hash, sizeof(hash));
+    offset = put(buffer, offset, &nameLength, sizeof(nameLength));
+    if(buffer != NULL) option->copyName((char*)buffer + offset);
+    offset += nameLength + 1;
+    offset = put(buffer, offset, &valueLength, sizeof(valueLength));
+    offset = putString(buffer, offset, value, valueLength);
+    ++optionCount;
+  }
+
+  if(buffer != NULL) {
+    uint32_t magic = CONFIG_FILE_MAGIC;
+    uint8_t format = CONFIG_FILE_FORMAT;
+    uint8_t fieldCount = CONFIG_FIELD_COUNT;
+    uint32_t payloadLength = offset - CONFIG_FILE_HEADER_SIZE;
+    size_t header = put(buffer, 0, &magic, sizeof(magic));
+    header = put(buffer, header, &format, sizeof(format));
+    header = put(buffer, header, &fieldCount, sizeof(fieldCount));
+    header = put(buffer, header, &optionCount, sizeof(optionCount));
+    header = put(buffer, header, &generation, sizeof(generation));
+    put(buffer, header, &payloadLength, sizeof(payloadLength));
+    uint32_t crc = crc32(buffer, offset);
+    put(buffer, offset, &crc, sizeof(crc));
+  }
+  return offset + sizeof(uint32_t);
+}
+
+size_t ConfigFile::serializeField(Config& config, int field, uint8_t* buffer, size_t offset) {
+  int32_t number;
+  uint16_t length;
+  const uint8_t* data = fieldData(config, field, &number, &length);
+  offset = put(buffer, offset, &length, sizeof(length));
+  return putString(buffer, offset, (const char*)data, length);
+}
+
+// 숫자 필드는 number 에 담아서 그 주소를 반환한다.
+const uint8_t* ConfigFile::fieldData(Config& config, int field, int32_t* number, uint16_t* length) {
+  const char* value = "";
+  *number = 0;
+  switch(field) {
+    case CONFIG_FIELD_VERSION: value = config._version.c_str(); break;
+    case CONFIG_FIELD_DEVICE_NAME: value = config._deviceName.c_str(); break;
+    case CONFIG_FIELD_WIFI_SSID: value = config._ssid.c_str(); break;
+    case CONFIG_FIELD_WIFI_PASSWORD: value = config._pass.c_str(); break;
+    case CONFIG_FIELD_NTP_SERVER: value = config._ntpServer.c_str(); break;
+    case CONFIG_FIELD_NTP_UPDATE_INTERVAL: *number = config._ntpUpdateInterval; value = NULL; break;
+    case CONFIG_FIELD_TIME_OFFSET: *number = config._timeOffset; value = NULL; break;
+    case CONFIG_FIELD_MQTT_ADDRESS: value = config._mqttAddress.c_str(); break;
+    case CONFIG_FIELD_MQTT_PORT: *number = config._mqttPort; value = NULL; break;
+    case CONFIG_FIELD_MQTT_CLIENT_ID: value = config._mqttClientID.c_str(); break;
+    case CONFIG_FIELD_MQTT_USER: value = config._mqttUser.c_str(); break;
+    case CONFIG_FIELD_MQTT_PASSWORD: value = config._mqttPass.c_str(); break;
+  }
+  if(value == NULL) {
+    *length = sizeof(*number);
+    return (const uint8_t*)number;
+  }
+  *length = strlen(value);
+  return (const uint8_t*)value;
+}
+
+// buffer 는 verify() 를 통과한 이미지여야 한다.
+bool ConfigFile::parse(Config& config, uint8_t* buffer, size_t size) {
+  uint8_t format = buffer[4];
+  uint8_t fieldCount = buffer[5];
+  uint16_t optionCount;
+  memcpy(&optionCount, buffer + 6, sizeof(optionCount));
+
+  const uint8_t* pos = buffer + (format == 1 ? CONFIG_FILE_HEADER_SIZE_V1 : CONFIG_FILE_HEADER_SIZE);
+  const uint8_t* end = buffer + size - sizeof(uint32_t);
+  for(int field = 0; field < fieldCount; ++field) {
+    uint16_t length;
+    if(pos + sizeof(length) > end) return false;
+    memcpy(&length, pos, sizeof(length));
+    pos += sizeof(length);
+    if(pos + length + 1 > end || pos[length] != '\0') return false;
+    // 이후 버전에서 추가된 필드는 무시한다.
+    if(field < CONFIG_FIELD_COUNT && !parseField(config, field, pos, length)) return false;
+    pos += length + 1;
+  }
+
+  for(int i = 0; i < optionCount; ++i) {
+    uint32_t hash;
+    uint8_t nameLength;
+    uint16_t valueLength;
+    if(pos + sizeof(hash) + sizeof(nameLength) > end) return false;
+    memcpy(&hash, pos, sizeof(hash));
+    nameLength = pos[sizeof(hash)];
+    pos += sizeof(hash) + sizeof(nameLength);
+    const char* name = (const char*)pos;
+    if(pos + nameLength + 1 + sizeof(valueLength) > end || pos[nameLength] != '\0') return false;
+    pos += nameLength + 1;
+    memcpy(&valueLength, pos, sizeof(valueLength));
+    pos += sizeof(valueLength);
+    const char* value = (const char*)pos;
+    if(pos + valueLength + 1 > end || pos[valueLength] != '\0') return false;
+    pos += valueLength + 1;
+    config.setOptionValue(config._options.find(name, hash), value);
+  }
+  #ifdef _DEBUG_
+  Serial.println("loadConfig()...OK!");
+  #endif
+  return true;
+}
+
+bool ConfigFile::parseField(Config& config, int field, const uint8_t* data, uint16_t length) {
+  int32_t number = 0;
+  if(field == CONFIG_FIELD_NTP_UPDATE_INTERVAL || field == CONFIG_FIELD_TIME_OFFSET || field == CONFIG_FIELD_MQTT_PORT) {
+    if(length != sizeof(number)) return false;
+    memcpy(&number, data, sizeof(number));
+  }
+  const char* value = (const char*)data;
+  switch(field) {
+    case CONFIG_FIELD_VERSION: config._version = value; break;
+    case CONFIG_FIELD_DEVICE_NAME: config._deviceName = value; break;
+    case CONFIG_FIELD_WIFI_SSID: config._ssid = value; break;
+    case CONFIG_FIELD_WIFI_PASSWORD: config._pass = value; break;
+    case CONFIG_FIELD_NTP_SERVER: config._ntpServer = value; break;
+    case CONFIG_FIELD_NTP_UPDATE_INTERVAL: config._ntpUpdateInterval = (uint16_t)number; break;
+    case CONFIG_FIELD_TIME_OFFSET: config._timeOffset = number; break;
+    case CONFIG_FIELD_MQTT_ADDRESS: config._mqttAddress = value; break;
+    case CONFIG_FIELD_MQTT_PORT: config._mqttPort = number; break;
+    case CONFIG_FIELD_MQTT_CLIENT_ID: config._mqttClientID = value; break;
+    case CONFIG_FIELD_MQTT_USER: config._mqttUser = value; break;
+    case CONFIG_FIELD_MQTT_PASSWORD: config._mqttPass = value; break;
+  }
+  return true;
+}
+
+bool ConfigFile::parseLegacy(Config& config, char* buffer, size_t size) {
+  // 줄바꿈을 '\0' 으로 바꿔서 한 줄씩 읽는다.
+  char* lines[CONFIG_FIELD_COUNT + 2];
+  char* pos = buffer;
+  char* end = buffer + size;
+  int lineCount = 0;
+  while(lineCount < CONFIG_FIELD_COUNT + 2) {
+    char* newLine = (char*)memchr(pos, '\n', end - pos);
+    if(newLine == NULL) return false;
+    *newLine = '\0';
+    lines[lineCount++] = pos;
+    pos = newLine + 1;
+  }
+  if(strcmp(lines[0], CONFIG_FILE_LEGACY_VERSION) != 0) {
+    return false;
+  }
+  for(int field = 0; field < CONFIG_FIELD_COUNT; ++field) {
+    const char* value = lines[field + 1];
+    if(field == CONFIG_FIELD_NTP_UPDATE_INTERVAL || field == CONFIG_FIELD_TIME_OFFSET || field == CONFIG_FIELD_MQTT_PORT) {
+      int32_t number = atol(value);
+      parseField(config, field, (const uint8_t*)&number, sizeof(number));
+    } else if(field == CONFIG_FIELD_MQTT_ADDRESS) {
+      // 이전 버전은 setter 로 읽었으므로 setter 가 하던 trim() 을 그대로 적용한다. (CR 이나 공백이 남으면 주소를 찾지 못한다)
+      config.setMQTTddress(value);
+    } else if(field == CONFIG_FIELD_MQTT_USER) {
+      config.setMQTTUser(value);
+    } else {
+      parseField(config, field, (const uint8_t*)value, strlen(value));
+    }
+  }
+  int optionCount = atoi(lines[CONFIG_FIELD_COUNT + 1]);
+  for(int i = 0; i < optionCount; ++i) {
+    char* name = pos;
+    char* newLine = (char*)memchr(pos, '\n', end - pos);
+    if(newLine == NULL) return false;
+    *newLine = '\0';
+    char* value = newLine + 1;
+    newLine = (char*)memchr(value, '\n', end - value);
+    if(newLine == NULL) return false;
+    *newLine = '\0';
+    pos = newLine + 1;
+    config.setOptionValue(config._options.find(name), value);
+  }
+  return true;
+}
+
+size_t ConfigFile::put(uint8_t* buffer, size_t offset, const void* data, size_t length) {
+  if(buffer != NULL) memcpy(buffer + offset, data, length);
+  return offset + length;
+}
+
+size_t ConfigFile::putString(uint8_t* buffer, size_t offset, const char* value, size_t length) {
+  offset = put(buffer, offset, value, length);
+  if(buffer != NULL) buffer[offset] = '\0';
+  return offset + 1;
+}
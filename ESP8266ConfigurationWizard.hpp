@@ -5,33 +5,64 @@
 
 #include <ESP8266WebServer.h>
 #include <WiFiClient.h>
-#include <WiFiUdp.h>
 #include <WifiServer.h>
 #include <PubSubClient.h>
 #include <LittleFS.h>
-#include <NTPClient.h>
+#include <time.h>
+#include <coredecls.h>
+#include <core_version.h>
 #include "Config.hpp"
+#include "ConfigFile.hpp"
 #include "Resources.hpp"
+#include "WiFiScanner.hpp"
+#include "JsonWriter.hpp"
+#include "Backoff.hpp"
+#include "MqttQueue.hpp"
+#include "TopicTrie.hpp"
+#include "Telemetry.hpp"
 #include "LinkedList.hpp"
 
 // PubSubClient >= 2.8.0
 
+// publish_P(), publish(File&), publishStream() 이 payload 를 나누어 보낼 때 사용하는 buffer 크기.
+#define PUBLISH_STREAM_CHUNK_SIZE 64
+
+// publishStream() 의 payload 생성 함수. offset 부터 최대 size byte 를 buffer 에 쓰고 쓴 크기를 반환한다.
+typedef size_t (*publish_generator)(uint8_t* buffer, size_t size, size_t offset, void* context);
+
 #define ESP_CONFIGURATION_WIZARD_VERSION "0.9.0\0"
 
 #define CONFIG_FILENAME "/config.dat"
+#define CONFIG_BACKUP_FILENAME "/config.bak"
+#define CONFIG_JOURNAL_FILENAME "/config.log"
+
+// /api/option/batch 의 인자 이름(name0, value0 ...) buffer 크기.
+#define OPTION_BATCH_KEY_SIZE 16
 
-#define VALUE_BUFFER_SIZE 512
+// js, css 가 모두 들어있는 페이지 하나를 매번 ETag 로 확인한다.
+#define RESOURCE_CACHE_PAGE "no-cache"
 
 
-#define MQTT_RECONNECT_INTERVAL 5000
-#define MQTT_SOCKET_TIMEOUT 5
+// 재연결 간격은 실패할 때마다 두 배까지 늘어나며 (Backoff.hpp), MAX 를 넘지 않는다.
+#define MQTT_RECONNECT_INTERVAL 5000 //ms
+#define MQTT_RECONNECT_MAX_INTERVAL 300000 //ms
 #define MQTT_KEPP_ALIVE 5
 
-#define NTP_RECONNECT_INTERVAL 500
+// SNTP 응답을 기다리는 시간과 실패한 뒤 다시 시도할 때까지의 시간.
+#define NTP_TIMEOUT 10000 //ms
+#define NTP_RETRY_INTERVAL 10000 //ms
+#define NTP_RETRY_MAX_INTERVAL 3600000 //ms
+
+// connect(), loop() 한 번이 네트워크 때문에 멈출 수 있는 최대 시간. (MQTT 연결, DNS 조회)
+// PubSubClient 는 CONNACK 을 초 단위로 기다리므로 1초보다 짧게 할 수 없다.
+#define CONNECT_TIME_BUDGET 1000 //ms
+#define CONNECT_TIME_BUDGET_MIN 1000 //ms
 
 
 
 #define WIFI_TIMEOUT 60000 //ms
+#define WIFI_RETRY_INTERVAL 5000 //ms
+#define WIFI_RETRY_MAX_INTERVAL 300000 //ms
 
 
 #define MODE_PREPARE 0
@@ -61,24 +92,75 @@
 #define STATUS_CONFIGURATION 7
 
 
+// 설정 모드에서 오래 걸리는 연결 확인은 작업(job)으로 시작하고, 웹 페이지는 /api/job/status 로 결과를 확인한다.
+#define JOB_NONE 0
+#define JOB_WIFI 1
+#define JOB_MQTT 2
+#define JOB_NTP 3
+
+#define JOB_STATE_IDLE 0
+#define JOB_STATE_RUNNING 1
+#define JOB_STATE_DONE 2
+#define JOB_STATE_FAILED 3
+
+struct WizardJob {
+  uint16_t id = 0;
+  uint8_t type = JOB_NONE;
+  uint8_t state = JOB_STATE_IDLE;
+  unsigned long startMillis = 0;
+  String host;       // SSID, MQTT 주소, NTP 서버
+  String user;       // MQTT user
+  String password;   // WiFi, MQTT password
+  String clientID;   // MQTT client ID
+  long number = 0;   // MQTT port, time offset
+  long interval = 0; // NTP 업데이트 간격 (분)
+};
+
+// subscribe() 로 등록한 topic. MQTT 가 연결될 때마다 다시 구독한다.
+struct MqttSubscription {
+  String topic;
+  uint8_t qos = 0;
+  bool subscribed = false; // 현재 연결에서 SUBSCRIBE 를 보냈는지
+
+  bool operator==(const MqttSubscription& other) const {
+    return topic == other.topic;
+  }
+};
+
+
 class ESP8266ConfigurationWizard {
 
   private :
 
-    WiFiUDP _udp;
     WiFiClient _wifiClient; 
     ESP8266WebServer* _webServer;
-    NTPClient* _ntpClient;
 	PubSubClient _mqtt;
     Config _config;
+    ConfigFile _configFile;
     String _ipAddress = "0.0.0.0";
-    uint16_t _wifiCount = 0;
+    WiFiScanner _wifiScanner;
+    WizardJob _job;
     uint8_t _mode = MODE_PREPARE;
     int _status = STATUS_PRE;
+    int _ntpStatus = STATUS_PRE;
+    int _mqttStatus = STATUS_PRE;
     
-    LinkedList<String> _subscribeList;
-
-    IPAddress _timeServerIP;
+    LinkedList<MqttSubscription> _subscribeList;
+    bool _subscriptionsPending = false;
+    TopicTrie _topicHandlers;
+    TelemetryBatch _telemetry;
+    String _telemetryTopic;
+
+    // WiFi 연결 상태는 이벤트에서만 바뀐다. 이벤트를 등록하기 전에는 WiFi.status() 를 사용한다.
+    volatile bool _wifiConnected = false;
+    WiFiEventHandler _wifiGotIPHandler;
+    WiFiEventHandler _wifiDisconnectedHandler;
+
+    volatile bool _timeSynced = false;
+    bool _timeSyncCallbackSet = false;
+    unsigned long _ntpStartMillis = 0;
+    unsigned long _ntpInterval = 0;
+    unsigned long _timeBudget = CONNECT_TIME_BUDGET;
 
     typedef const char* (*option_filter)(const char* name,const char* value);
     typedef void (*status_callback)(int);
@@ -87,7 +169,10 @@ class ESP8266ConfigurationWizard {
     status_callback _onStatusCallback = NULL;
 
     long _startWiFiConnectMillis;
-	unsigned long _lastRetried = 0;
+    Backoff _wifiBackoff = Backoff(WIFI_RETRY_INTERVAL, WIFI_RETRY_MAX_INTERVAL);
+    Backoff _ntpBackoff = Backoff(NTP_RETRY_INTERVAL, NTP_RETRY_MAX_INTERVAL);
+    Backoff _mqttBackoff = Backoff(MQTT_RECONNECT_INTERVAL, MQTT_RECONNECT_MAX_INTERVAL);
+    MqttQueue _publishQueue;
     
 
 
@@ -102,10 +187,32 @@ class ESP8266ConfigurationWizard {
     bool availableWifi();
     bool availableNTP();
     bool availableMqtt();
+    int getNTPStatus();
+    int getMqttStatus();
+    const Backoff& getWiFiBackoff();
+    const Backoff& getNTPBackoff();
+    const Backoff& getMqttBackoff();
     void connect();
+    void setTimeBudget(unsigned long ms);
     void startConfigurationMode();
     bool isConfigurationMode();
     PubSubClient* pubSubClient();
+    bool publish(const char* topic, const char* payload, bool retained = false);
+    bool publish(const char* topic, const uint8_t* payload, unsigned int length, bool retained = false);
+    bool publish_P(const char* topic, PGM_P payload, size_t length, bool retained = false);
+    bool publish(const char* topic, File& file, bool retained = false);
+    bool publishStream(const char* topic, size_t length, publish_generator generator, void* context = NULL, bool retained = false);
+    void setPublishRate(uint16_t messagesPerSecond);
+    void setTelemetryTopic(const char* topic);
+    void setTelemetryInterval(unsigned long ms);
+    bool addTelemetry(uint8_t channel, float value);
+    bool flushTelemetry();
+    bool subscribe(const char* topic, uint8_t qos = 0);
+    bool subscribe(const char* topic, uint8_t qos, topic_handler handler);
+    bool unsubscribe(const char* topic);
+    bool isSubscribed(const char* topic);
+    const MqttQueue& getPublishQueue();
+    const TelemetryBatch& getTelemetry();
     void loop();
     int getHours();
     int getMinutes();
@@ -114,33 +221,56 @@ class ESP8266ConfigurationWizard {
     unsigned long getEpochTime();
 
     bool loadConfig();
+    bool commitConfig();
+    void setWiFiScanCacheTTL(unsigned long ttl);
+
+    bool writeOption(int handle, Stream& in, size_t length);
+    bool writeOption(int handle, const uint8_t* data, size_t length);
+    bool writeOption(const char* name, Stream& in, size_t length);
+    bool writeOption(const char* name, const uint8_t* data, size_t length);
+    File openOption(int handle);
+    File openOption(const char* name);
 
   private :
 
   void setStatus(int status);
+  void setServiceStatus(int& serviceStatus, int status);
+  void loopNTP();
+  void loopMQTT();
+  void onMqttConnected();
+  void resetServices();
   void connectWiFi();
+  void registerWiFiEvents();
+  MqttSubscription* findSubscription(const char* topic);
+  void sendSubscriptions();
+  static size_t readProgmemChunk(uint8_t* buffer, size_t size, size_t offset, void* context);
+  static size_t readFileChunk(uint8_t* buffer, size_t size, size_t offset, void* context);
   bool connectMQTT();
+  bool connectMQTT(const char* server, int port, const char* id, const char* user, const char* password);
+  bool connectMQTTWithin(const char* server, int port, const char* id, const char* user, const char* password, unsigned long startMillis);
+  unsigned long remainingTimeBudget(unsigned long startMillis);
   
-  bool connectNTP(const char* ntpServer,long timeOffset, unsigned long interval );
+  void startNTP(const char* ntpServer,long timeOffset, unsigned long interval );
   void releaseWebServer();
   
   void initConfigurationMode();
 
-  String resultStringFromEncryptionType(int thisType);
+  const char* resultStringFromEncryptionType(int thisType);
     
   void sendBadRequest();
-  void onHttpRequestScanWifiCount();
-  void onHttpRequestScanWifiItem();
+  void sendResource(const WebResource* resource, const char* cacheControl);
   void onHttpRequestScanWifi();
-  void onHttpRequestWifiHtml();
-  void onHttpRequestTimeHtml();
-  void onHttpRequestMqttHtml();
-  void onHttpRequestOptionHtml();
-  void onHttpRequestFinishHtml();
-  void onHttpRequestAppJs();
-  void onHttpRequestEnvJs();
-  void onHttpRequestAjaxJs();
-  void onHttpRequestMainCss();
+  void onHttpRequestScanWifiStatus();
+  void sendWifiScanStatus();
+  void sendSuccess(bool success, int code = 200);
+  void startJob(uint8_t type);
+  void processJob();
+  void finishJob(bool success);
+  unsigned long jobTimeout();
+  static bool isWiFiConnectFailed(int status);
+  void sendJob();
+  void onHttpRequestJobStatus();
+  void onHttpRequestIndexHtml();
   void onHttpRequestInfo();
   void onHttpRequestWifiConnect();
   void onHttpRequestMqttConnect();
@@ -149,17 +279,13 @@ class ESP8266ConfigurationWizard {
   
   void onHttpRequestNTPInfo();
   void onHttpRequestSetNTP();
-  void onHttpRequestOptionCount();
+  void onHttpRequestOptionList();
   void onHttpRequestSetOption();
-  void onHttpRequestGetOption();
+  void onHttpRequestSetOptions();
+  const char* checkOptionValue(const char* name, const char* value);
   void onHttpRequestCommit();
 
   bool saveConfig();
-  void writeLineInConfigFile(File* file,const char* value);
-  char* readLineInConfigFile(File* file,char* buffer);
-  
-  bool saveConfigOptions(File* file);
-  bool loadConfigOptions(File* file,char* buffer);
   
 
 };
@@ -169,7 +295,7 @@ class ESP8266ConfigurationWizard {
 
 
 
-ESP8266ConfigurationWizard::ESP8266ConfigurationWizard() : _webServer(NULL), _ntpClient(NULL)
+ESP8266ConfigurationWizard::ESP8266ConfigurationWizard() : _webServer(NULL), _configFile(CONFIG_FILENAME, CONFIG_BACKUP_FILENAME, CONFIG_JOURNAL_FILENAME)
 {
 	_mqtt.setClient(_wifiClient);
   
@@ -201,7 +327,30 @@ bool ESP8266ConfigurationWizard::available() {
 }
 
 bool ESP8266ConfigurationWizard::availableNTP() {
-  return _ntpClient != NULL && _ntpClient->isTimeSet();
+  return _timeSynced;
+}
+
+// NTP_CONNECT_TRY, NTP_ERROR, NTP_CONNECTED 중 하나. 아직 시작하지 않았으면 STATUS_PRE.
+int ESP8266ConfigurationWizard::getNTPStatus() {
+  return _ntpStatus;
+}
+
+// MQTT_CONNECT_TRY, MQTT_ERROR, MQTT_CONNECTED 중 하나. 아직 시작하지 않았거나 WiFi 가 끊어졌으면 STATUS_PRE.
+int ESP8266ConfigurationWizard::getMqttStatus() {
+  return _mqttStatus;
+}
+
+// 재연결 진단용. 연속 실패 횟수와 다음 시도까지 남은 시간을 확인할 수 있다.
+const Backoff& ESP8266ConfigurationWizard::getWiFiBackoff() {
+  return _wifiBackoff;
+}
+
+const Backoff& ESP8266ConfigurationWizard::getNTPBackoff() {
+  return _ntpBackoff;
+}
+
+const Backoff& ESP8266ConfigurationWizard::getMqttBackoff() {
+  return _mqttBackoff;
 }
 
 bool ESP8266ConfigurationWizard::availableMqtt() {
@@ -209,6 +358,9 @@ bool ESP8266ConfigurationWizard::availableMqtt() {
 }
 
 bool ESP8266ConfigurationWizard::availableWifi() {
+  if(_wifiGotIPHandler) {
+    return _wifiConnected;
+  }
   if(WiFi.status() == WL_CONNECTED) {
     return true;  
   }
@@ -216,6 +368,8 @@ bool ESP8266ConfigurationWizard::availableWifi() {
 }
 
 
+// 설정을 읽고 WiFi 연결을 시작한 뒤 바로 반환한다. 이후의 연결 과정은 loop() 에서 진행된다.
+// 호출하지 않아도 첫 loop() 에서 호출된다.
 void ESP8266ConfigurationWizard::connect() {
   
   if(!loadConfig()) {
@@ -225,45 +379,17 @@ void ESP8266ConfigurationWizard::connect() {
   
   releaseWebServer();
   _mode = MODE_RUN;
-  _mqtt.setSocketTimeout(MQTT_SOCKET_TIMEOUT);
   _mqtt.setKeepAlive(MQTT_KEEPALIVE);
+  registerWiFiEvents();
+  _publishQueue.begin();
 
   setStatus(WIFI_CONNECT_TRY);
   connectWiFi();
+}
 
-  while ((WiFi.status() != WL_CONNECTED) && millis() - _startWiFiConnectMillis < WIFI_TIMEOUT) {
-    delay(500);
-  }
-  if(WiFi.status() != WL_CONNECTED) {
-      setStatus(WIFI_ERROR);
-      return;
-  } 
-  setStatus(WIFI_CONNECTED);
-  
-  
-  
-  if(!availableNTP()) {
-    setStatus(NTP_CONNECT_TRY);
-    delay(100);
-    connectNTP(_config.getNTPServer(), _config.getTimeOffset(), (long)_config.getNTPUpdateInterval() * 60000L);
-    if(!availableNTP()) {
-      setStatus(NTP_ERROR);
-      return;
-    }
-  }
-  setStatus(NTP_CONNECTED);
-  if(!availableMqtt()) {
-    setStatus(MQTT_CONNECT_TRY);
-    connectMQTT();
-    if(!availableMqtt()) {
-      setStatus(MQTT_ERROR);
-      return;
-    }
-	delay(100);
-  }
-  setStatus(MQTT_CONNECTED); 
-  setStatus(STATUS_OK);
-  
+// loop() 한 번이 연결 때문에 멈출 수 있는 시간. (ms) CONNECT_TIME_BUDGET_MIN 보다 작은 값은 CONNECT_TIME_BUDGET_MIN 으로 바뀐다.
+void ESP8266ConfigurationWizard::setTimeBudget(unsigned long ms) {
+  _timeBudget = ms < CONNECT_TIME_BUDGET_MIN ? CONNECT_TIME_BUDGET_MIN : ms;
 }
 
 void ESP8266ConfigurationWizard::startConfigurationMode() {
@@ -280,94 +406,370 @@ PubSubClient* ESP8266ConfigurationWizard::pubSubClient() {
     return &_mqtt;
 }
 
+bool ESP8266ConfigurationWizard::publish(const char* topic, const char* payload, bool retained) {
+    return publish(topic, (const uint8_t*)payload, strlen(payload), retained);
+}
+
+// 연결되어 있고 보관 중인 메시지가 없으면 바로 보내고, 아니면 queue 에 넣어 두었다가 연결된 뒤 순서대로 보낸다.
+// 바로 보내지도, 보관하지도 못한 경우에만 false 를 반환한다.
+bool ESP8266ConfigurationWizard::publish(const char* topic, const uint8_t* payload, unsigned int length, bool retained) {
+    if(_mqttStatus == MQTT_CONNECTED && _publishQueue.isEmpty() && _mqtt.publish(topic, payload, length, retained)) {
+        return true;
+    }
+    return _publishQueue.push(topic, payload, length, retained);
+}
+
+size_t ESP8266ConfigurationWizard::readProgmemChunk(uint8_t* buffer, size_t size, size_t offset, void* context) {
+    memcpy_P(buffer, (PGM_P)context + offset, size);
+    return size;
+}
+
+size_t ESP8266ConfigurationWizard::readFileChunk(uint8_t* buffer, size_t size, size_t offset, void* context) {
+    return ((File*)context)->read(buffer, size);
+}
+
+// PROGMEM 의 payload 를 PUBLISH_STREAM_CHUNK_SIZE 씩 복사해 보낸다. PubSubClient 의 buffer 크기와 관계없다.
+bool ESP8266ConfigurationWizard::publish_P(const char* topic, PGM_P payload, size_t length, bool retained) {
+    return publishStream(topic, length, readProgmemChunk, (void*)payload, retained);
+}
+
+// 파일의 현재 위치부터 끝까지 보낸다.
+bool ESP8266ConfigurationWizard::publish(const char* topic, File& file, bool retained) {
+    if(!file) {
+        return false;
+    }
+    return publishStream(topic, file.size() - file.position(), readFileChunk, &file, retained);
+}
+
+// length 만큼 generator 가 만든 payload 를 보낸다. 메시지 크기와 관계없이 stack 의 chunk buffer 하나만 사용한다.
+// 큰 payload 는 queue 에 보관하지 않으므로, 연결되어 있지 않거나 queue 에 아직 보내지 못한 메시지가 남아 있으면
+// 순서가 바뀌지 않도록 보내지 않고 false 를 반환한다.
+// generator 가 length 보다 적게 만들면 이미 보낸 packet 의 길이가 맞지 않으므로 연결을 끊는다.
+bool ESP8266ConfigurationWizard::publishStream(const char* topic, size_t length, publish_generator generator, void* context, bool retained) {
+    if(_mqttStatus != MQTT_CONNECTED || !_publishQueue.isEmpty() || generator == NULL || !_mqtt.beginPublish(topic, length, retained)) {
+        return false;
+    }
+    uint8_t buffer[PUBLISH_STREAM_CHUNK_SIZE];
+    size_t offset = 0;
+    while(offset < length) {
+        size_t size = length - offset < sizeof(buffer) ? length - offset : sizeof(buffer);
+        size_t read = generator(buffer, size, offset, context);
+        if(read == 0 || read > size || _mqtt.write(buffer, read) != read) {
+            _mqtt.disconnect();
+            return false;
+        }
+        offset += read;
+    }
+    return _mqtt.endPublish();
+}
+
+// queue 에 보관된 메시지를 다시 보내는 속도. 0 이면 loop() 마다 하나씩 보낸다.
+// queue 가 비어 있지 않으면 순서를 지키기 위해 새로 publish 한 메시지도 queue 를 거친다. 이 속도보다 빠르게 publish 하면
+// queue 가 줄지 않으므로, 쌓인 메시지가 많아지면 (MqttQueue::isBacklogged()) 속도와 관계없이 loop() 마다 여러 개를 보낸다.
+void ESP8266ConfigurationWizard::setPublishRate(uint16_t messagesPerSecond) {
+    _publishQueue.setRate(messagesPerSecond);
+}
+
+const MqttQueue& ESP8266ConfigurationWizard::getPublishQueue() {
+    return _publishQueue;
+}
+
+const TelemetryBatch& ESP8266ConfigurationWizard::getTelemetry() {
+    return _telemetry;
+}
+
+// 측정값을 모아 보낼 topic. 설정하지 않으면 addTelemetry() 는 false 를 반환한다.
+void ESP8266ConfigurationWizard::setTelemetryTopic(const char* topic) {
+    _telemetryTopic = topic;
+}
+
+// 첫 측정값을 추가한 뒤 이 시간이 지나면 frame 이 가득 차지 않아도 보낸다.
+void ESP8266ConfigurationWizard::setTelemetryInterval(unsigned long ms) {
+    _telemetry.setInterval(ms);
+}
+
+// 측정값은 바로 보내지 않고 frame 에 모은다. 보내는 것은 loop() 가 한다. (frame 형식은 Telemetry.hpp)
+// frame 이 loop() 에서 보내지기 전에 더 받을 수 없으면 측정값을 버리고 false 를 반환한다. 버린 수는 getTelemetry().dropped()
+bool ESP8266ConfigurationWizard::addTelemetry(uint8_t channel, float value) {
+    if(_telemetryTopic.length() == 0) {
+        return false;
+    }
+    bool epoch = availableNTP();
+    uint32_t seconds = epoch ? (uint32_t)getEpochTime() : (uint32_t)(millis() / 1000);
+    return _telemetry.add(channel, value, seconds, epoch);
+}
+
+// 모은 측정값을 지금 보낸다. 연결되어 있지 않으면 queue 에 보관된다.
+// 시간 기준이 바뀌어 봉인된 frame 이 있으면 먼저 보낸다.
+bool ESP8266ConfigurationWizard::flushTelemetry() {
+    bool result = true;
+    if(_telemetry.sealedData() != NULL) {
+        result = publish(_telemetryTopic.c_str(), _telemetry.sealedData(), _telemetry.sealedSize());
+        _telemetry.releaseSealed();
+    }
+    if(_telemetry.count() > 0) {
+        result = publish(_telemetryTopic.c_str(), _telemetry.data(), _telemetry.size()) && result;
+        _telemetry.reset();
+    }
+    return result;
+}
+
+// topic 을 구독 목록에 추가한다. 연결되어 있지 않으면 연결된 뒤 구독하며, 다시 연결될 때마다 자동으로 다시 구독한다.
+// PubSubClient 가 지원하는 QoS 는 0, 1 뿐이다.
+bool ESP8266ConfigurationWizard::subscribe(const char* topic, uint8_t qos) {
+    if(topic == NULL || topic[0] == '\0' || qos > 1) {
+        return false;
+    }
+    MqttSubscription* subscription = findSubscription(topic);
+    if(subscription == NULL) {
+        MqttSubscription item;
+        item.topic = topic;
+        item.qos = qos;
+        _subscribeList.Append(item);
+        subscription = &_subscribeList.Last();
+    } else if(subscription->qos != qos) {
+        subscription->qos = qos;
+        subscription->subscribed = false;
+    }
+    if(!subscription->subscribed) {
+        _subscriptionsPending = true;
+        if(_mqttStatus == MQTT_CONNECTED) sendSubscriptions();
+    }
+    return true;
+}
+
+// topic filter 에 맞는 메시지를 handler 로 받는다. ('+', '#' 사용 가능)
+// handler 를 등록하면 PubSubClient 의 callback 은 wizard 가 사용하므로 pubSubClient()->setCallback() 을 호출하면 안 된다.
+bool ESP8266ConfigurationWizard::subscribe(const char* topic, uint8_t qos, topic_handler handler) {
+    if(qos > 1 || !_topicHandlers.add(topic, handler)) {
+        return false;
+    }
+    _mqtt.setCallback([this](char* topic, uint8_t* payload, unsigned int length) {
+        _topicHandlers.dispatch(topic, payload, length);
+    });
+    return subscribe(topic, qos);
+}
+
+bool ESP8266ConfigurationWizard::unsubscribe(const char* topic) {
+    _topicHandlers.remove(topic);
+    MqttSubscription* subscription = findSubscription(topic);
+    if(subscription == NULL) {
+        return false;
+    }
+    if(subscription->subscribed && _mqttStatus == MQTT_CONNECTED) {
+        _mqtt.unsubscribe(topic);
+    }
+    // findSubscription() 이 찾은 항목이 현재 위치다.
+    _subscribeList.DeleteCurrent();
+    return true;
+}
+
+// 현재 연결에서 SUBSCRIBE 를 보냈으면 true. PubSubClient 는 SUBACK 을 알려주지 않으므로 전송 여부로 판단한다.
+bool ESP8266ConfigurationWizard::isSubscribed(const char* topic) {
+    MqttSubscription* subscription = findSubscription(topic);
+    return subscription != NULL && subscription->subscribed && _mqttStatus == MQTT_CONNECTED;
+}
+
+MqttSubscription* ESP8266ConfigurationWizard::findSubscription(const char* topic) {
+    if(topic == NULL || !_subscribeList.moveToStart()) {
+        return NULL;
+    }
+    do {
+        if(_subscribeList.getCurrent().topic == topic) {
+            return &_subscribeList.getCurrent();
+        }
+    } while(_subscribeList.next());
+    return NULL;
+}
+
+// 아직 보내지 않은 SUBSCRIBE 를 응답을 기다리지 않고 이어서 보낸다. 보내지 못한 topic 은 다음 loop() 에서 다시 보낸다.
+void ESP8266ConfigurationWizard::sendSubscriptions() {
+    _subscriptionsPending = false;
+    if(!_subscribeList.moveToStart()) {
+        return;
+    }
+    do {
+        MqttSubscription& subscription = _subscribeList.getCurrent();
+        if(subscription.subscribed) continue;
+        subscription.subscribed = _mqtt.subscribe(subscription.topic.c_str(), subscription.qos);
+        if(!subscription.subscribed) _subscriptionsPending = true;
+    } while(_subscribeList.next());
+}
+
+// WiFi 연결을 확인하고, IP 를 받은 뒤에는 NTP 와 MQTT 를 함께 진행한다. MQTT 는 시간이 필요 없으므로 NTP 를 기다리지 않는다.
+// 각 단계는 기다리지 않고 다음 loop() 에서 결과를 확인하므로 loop() 는 setTimeBudget() 이상 멈추지 않는다.
 void ESP8266ConfigurationWizard::loop() {
 
+	// WiFi 와 MQTT 가 연결되어 있는 동안은 여기서 끝난다. WiFi 가 끊어지면 이벤트가, MQTT 가 끊어지면 _mqtt.loop() 가 알려준다.
+	// NTP 는 MQTT 와 따로 진행되므로 NTP 가 실패해도 이 경로에서 다시 시도한다.
+	if(_mode == MODE_RUN && _wifiConnected && _mqttStatus == MQTT_CONNECTED && _mqtt.loop()) {
+		if(_subscriptionsPending) sendSubscriptions();
+		loopNTP();
+		if(_ntpStatus == NTP_CONNECTED) setStatus(STATUS_OK);
+		if(_telemetry.isDue()) flushTelemetry();
+		if(!_publishQueue.isEmpty()) _publishQueue.drain(_mqtt);
+		return;
+	}
+
 	if(_mode == MODE_CONFIGURATION) {
+		_wifiScanner.loop();
+		processJob();
 		_webServer->handleClient();
 		return;
 	}
 
-	if(_status == WIFI_CONNECT_TRY && !availableWifi()) {
-		if(millis() - _startWiFiConnectMillis < WIFI_TIMEOUT) {
-		  return;
-		} else {
-		  setStatus(WIFI_ERROR);
-		  return;
-		}   	
-	} else if(!availableWifi()) {
-		setStatus(WIFI_CONNECT_TRY);
-		connectWiFi();
+	if(_mode == MODE_PREPARE) {
+		connect();
+		return;
+	}
+
+	if(_telemetry.isDue()) {
+		flushTelemetry();
+	}
+
+	if(!availableWifi()) {
+		if(_status == WIFI_CONNECT_TRY) {
+			if(millis() - _startWiFiConnectMillis >= WIFI_TIMEOUT) {
+				_wifiBackoff.fail();
+				setStatus(WIFI_ERROR);
+			}
+		} else if(_status != WIFI_ERROR) {
+			// 연결이 끊어진 경우. AP 가 재시작되면 모든 장치가 함께 끊어지므로 첫 재시도부터 간격을 둔다.
+			resetServices();
+			_wifiBackoff.fail();
+			setStatus(WIFI_ERROR);
+		} else if(_wifiBackoff.ready()) {
+			setStatus(WIFI_CONNECT_TRY);
+			connectWiFi();
+		}
 		return;
 	}
 
-	if(_status == WIFI_CONNECT_TRY) {
+	if(_status == WIFI_CONNECT_TRY || _status == WIFI_ERROR) {
 		setStatus(WIFI_CONNECTED);
+		_wifiBackoff.reset();
+		// WiFi 재연결 시점이 이미 흩어져 있으므로 NTP 와 MQTT 는 남은 대기 시간을 기다리지 않는다.
+		_ntpBackoff.reset();
+		_mqttBackoff.reset();
 	}
 
+	loopNTP();
+	loopMQTT();
 
+	if(_ntpStatus == NTP_CONNECTED && _mqttStatus == MQTT_CONNECTED) {
+		setStatus(STATUS_OK);
+	}
 
+	if(_mqttStatus == MQTT_CONNECTED) {
+		_mqtt.loop();
+		if(!_publishQueue.isEmpty()) _publishQueue.drain(_mqtt);
+	}
+}
+
+void ESP8266ConfigurationWizard::loopNTP() {
 	if(!availableNTP()) {
-	  setStatus(NTP_CONNECT_TRY);
-	  connectNTP(_config.getNTPServer(), _config.getTimeOffset(), (long)_config.getNTPUpdateInterval() * 60000L);
-	  delay(1000);
-	  if(!availableNTP()) {
-		setStatus(NTP_ERROR);
+		if(_ntpStatus == NTP_CONNECT_TRY) {
+			if(millis() - _ntpStartMillis >= NTP_TIMEOUT) {
+				_ntpBackoff.fail();
+				setServiceStatus(_ntpStatus, NTP_ERROR);
+			}
+		} else if(_ntpBackoff.ready()) {
+			setServiceStatus(_ntpStatus, NTP_CONNECT_TRY);
+			startNTP(_config.getNTPServer(), _config.getTimeOffset(), (long)_config.getNTPUpdateInterval() * 60000L);
+		}
 		return;
-	  }
 	}
 
-
-	if(_status == NTP_CONNECT_TRY) {
-		setStatus(NTP_CONNECTED);
+	if(_ntpStatus != NTP_CONNECTED) {
+		_ntpBackoff.reset();
+		setServiceStatus(_ntpStatus, NTP_CONNECTED);
 	}
 
+	// SNTP 는 백그라운드에서 동작한다. 설정한 간격이 지나면 다시 동기화를 요청한다.
+	if(_ntpInterval > 0 && millis() - _ntpStartMillis >= _ntpInterval) {
+		startNTP(_config.getNTPServer(), _config.getTimeOffset(), _ntpInterval);
+	}
+}
 
-	_ntpClient->update();
+// 새 연결은 clean session 이므로 broker 는 이전 구독을 기억하지 않는다. 상태 콜백에서 subscribe() 한 topic 은 바로 전송된다.
+void ESP8266ConfigurationWizard::onMqttConnected() {
+	_mqttBackoff.reset();
+	if(_subscribeList.moveToStart()) {
+		do {
+			_subscribeList.getCurrent().subscribed = false;
+		} while(_subscribeList.next());
+	}
+	setServiceStatus(_mqttStatus, MQTT_CONNECTED);
+	sendSubscriptions();
+}
 
+// WiFi 가 끊어지면 NTP 와 MQTT 도 끊어진 것으로 보고 상태 콜백으로 알린다. WiFi 가 다시 연결되면 처음부터 다시 진행한다.
+void ESP8266ConfigurationWizard::resetServices() {
+	_mqtt.disconnect();
+	if(_mqttStatus != STATUS_PRE) {
+		setServiceStatus(_mqttStatus, MQTT_ERROR);
+	}
+	// 이전 동기화 결과로 시간을 알려주지 않도록 다시 동기화될 때까지 기다린다.
+	_timeSynced = false;
+	if(_ntpStatus != STATUS_PRE) {
+		setServiceStatus(_ntpStatus, NTP_ERROR);
+	}
+}
 
-	if(!availableMqtt() && (_lastRetried == 0 || millis() -  _lastRetried >= MQTT_RECONNECT_INTERVAL)) {
-	  setStatus(MQTT_CONNECT_TRY);
-	  _lastRetried = millis();
-	  connectMQTT();
-	  if(!availableMqtt()) {
-		setStatus(MQTT_ERROR);
+void ESP8266ConfigurationWizard::loopMQTT() {
+	if(availableMqtt()) {
+		if(_mqttStatus != MQTT_CONNECTED) {
+			onMqttConnected();
+		}
 		return;
-	  }
 	}
-
-	if(_status == MQTT_CONNECT_TRY) {
-		setStatus(MQTT_CONNECTED);
+	if(_mqttStatus == MQTT_CONNECTED) {
+		// 브로커가 재시작되면 모든 장치가 함께 끊어지므로 첫 재연결부터 간격을 둔다.
+		_mqttBackoff.fail();
+		setServiceStatus(_mqttStatus, MQTT_ERROR);
+	}
+	if(!_mqttBackoff.ready()) {
+		return;
+	}
+	setServiceStatus(_mqttStatus, MQTT_CONNECT_TRY);
+	if(connectMQTT()) {
+		onMqttConnected();
+	} else {
+		_mqttBackoff.fail();
+		setServiceStatus(_mqttStatus, MQTT_ERROR);
 	}
-
-	 if(_mqtt.connected()) {
-		_mqtt.loop();
-	 }
 }
 
 
 int ESP8266ConfigurationWizard::getHours() {
-  if(_ntpClient == NULL) return -1;
-  return _ntpClient->getHours();
+  if(!availableNTP()) return -1;
+  time_t now = time(nullptr);
+  return localtime(&now)->tm_hour;
 }
 
 int ESP8266ConfigurationWizard::getMinutes() {
-  if(_ntpClient == NULL) return -1;
-  return _ntpClient->getMinutes();
+  if(!availableNTP()) return -1;
+  time_t now = time(nullptr);
+  return localtime(&now)->tm_min;
 }
 
 int ESP8266ConfigurationWizard::getSeconds() {
-  if(_ntpClient == NULL) return -1;
-  return _ntpClient->getSeconds();
+  if(!availableNTP()) return -1;
+  time_t now = time(nullptr);
+  return localtime(&now)->tm_sec;
 }
 
+// 0 은 일요일.
 int ESP8266ConfigurationWizard::getDay() {
- if(_ntpClient == NULL) return -1;
-  return _ntpClient->getDay();
+  if(!availableNTP()) return -1;
+  time_t now = time(nullptr);
+  return localtime(&now)->tm_wday;
 }
 
+// 이전 버전(NTPClient)과 같이 time offset 이 더해진 값을 반환한다.
 unsigned long ESP8266ConfigurationWizard::getEpochTime() {
-  if(_ntpClient == NULL) return -1;
-  return _ntpClient->getEpochTime();
+  if(!availableNTP()) return -1;
+  return (unsigned long)time(nullptr) + _config.getTimeOffset();
 }
 
 
@@ -381,6 +783,29 @@ void ESP8266ConfigurationWizard::setStatus(int status) {
   }
 }
 
+// NTP 와 MQTT 는 따로 진행되므로 각자의 상태가 바뀔 때마다 알린다.
+void ESP8266ConfigurationWizard::setServiceStatus(int& serviceStatus, int status) {
+  if(serviceStatus == status) {
+    return;
+  }
+  serviceStatus = status;
+  setStatus(status);
+}
+
+// 이벤트 콜백은 SDK 에서 호출되므로 상태만 바꾸고, 나머지는 loop() 에서 처리한다.
+void ESP8266ConfigurationWizard::registerWiFiEvents() {
+  if(_wifiGotIPHandler) {
+    return;
+  }
+  _wifiGotIPHandler = WiFi.onStationModeGotIP([this](const WiFiEventStationModeGotIP& event) {
+    _wifiConnected = true;
+  });
+  _wifiDisconnectedHandler = WiFi.onStationModeDisconnected([this](const WiFiEventStationModeDisconnected& event) {
+    _wifiConnected = false;
+  });
+  _wifiConnected = WiFi.status() == WL_CONNECTED;
+}
+
 void ESP8266ConfigurationWizard::connectWiFi() {
     _startWiFiConnectMillis = millis();
     WiFi.mode(WIFI_STA);
@@ -389,77 +814,86 @@ void ESP8266ConfigurationWizard::connectWiFi() {
 
 
 bool ESP8266ConfigurationWizard::connectMQTT() {      
-    const char* server = _config.getMQTTAddress();
-    int port = _config.getMQTTPort();
-    const char* id = _config.getMQTTClientID();
-    const char* user = _config.getMQTTUser();
-    const char* password = _config.getMQTTPassword();
-    
+    return connectMQTT(_config.getMQTTAddress(), _config.getMQTTPort(), _config.getMQTTClientID(), _config.getMQTTUser(), _config.getMQTTPassword());
+}
+
+// PubSubClient 는 server 문자열을 복사하지 않으므로 server 는 다음 연결 전까지 유효해야 한다.
+bool ESP8266ConfigurationWizard::connectMQTT(const char* server, int port, const char* id, const char* user, const char* password) {      
+    unsigned long startMillis = millis();
     _mqtt.setServer(server,port);     
     if(!_mqtt.connected()) {
         #ifdef _DEBUG_
 			Serial.print("connect mqtt: ");
 			Serial.println(id);
 			Serial.print("mqtt addr: ");
-			Serial.println(_config.getMQTTAddress());
+			Serial.println(server);
 			Serial.print("mqtt port: ");
-			Serial.println(_config.getMQTTPort());
-			Serial.print("mqtt clinetID: ");
-			Serial.println(_config.getMQTTClientID());
+			Serial.println(port);
 			Serial.print("mqtt user: ");
-			Serial.println(_config.getMQTTUser());
-			Serial.print("mqtt password: ");
-			Serial.println(_config.getMQTTPassword());           
-			Serial.println(strlen(_config.getMQTTUser()));
+			Serial.println(user);
         #endif
 		
-        if(strlen(_config.getMQTTUser()) > 0 && (_mqtt.connect(id,user, password) || _mqtt.connected())) {
+        bool withUser = strlen(user) > 0;
+        if(withUser && connectMQTTWithin(server, port, id, user, password, startMillis)) {
             #ifdef _DEBUG_ 
 			Serial.println("mqtt connected(user)");
 			#endif
             return true;
-        } else if (_mqtt.connect(id) || _mqtt.connected()) {             
+        }
+        // 사용자 인증에 실패하면 id 만으로 다시 시도한다. 남은 시간이 없으면 시도하지 않는다.
+        if(connectMQTTWithin(server, port, id, NULL, NULL, startMillis)) {             
 			#ifdef _DEBUG_
 			Serial.println("mqtt connected(id)");
 			#endif
             return true;
         }
-        else {
-          #ifdef _DEBUG_ 
-          Serial.println("failed connect mqtt");
-		  #endif
-          return false;
-        }
+        #ifdef _DEBUG_ 
+        Serial.println("failed connect mqtt");
+        #endif
+        return false;
     }
     return true;
   }
 
-  bool ESP8266ConfigurationWizard::connectNTP(const char* ntpServer,long timeOffset, unsigned long interval ) {
-    if(_ntpClient != NULL) {
-        _ntpClient->end();
-        delete _ntpClient;
-        _ntpClient = NULL;
+  // startMillis 부터 setTimeBudget() 중 남은 시간. (ms)
+  unsigned long ESP8266ConfigurationWizard::remainingTimeBudget(unsigned long startMillis) {
+    unsigned long elapsed = millis() - startMillis;
+    return elapsed < _timeBudget ? _timeBudget - elapsed : 0;
+  }
+
+  // DNS 조회와 TCP 연결에는 WiFiClient 의 timeout 을, CONNACK 대기에는 socket timeout(초)을 남은 시간으로 준다.
+  // PubSubClient 는 이미 연결된 client 를 그대로 사용하므로 TCP 연결을 먼저 한다.
+  // socket timeout 은 초 단위로 올림하므로 CONNACK 을 기다리는 동안 최대 1초 미만을 더 쓸 수 있다.
+  bool ESP8266ConfigurationWizard::connectMQTTWithin(const char* server, int port, const char* id, const char* user, const char* password, unsigned long startMillis) {
+    unsigned long remaining = remainingTimeBudget(startMillis);
+    if(remaining == 0) return false;
+    if(!_wifiClient.connected()) {
+      _wifiClient.setTimeout(remaining);
+      if(!_wifiClient.connect(server, port)) return false;
+      remaining = remainingTimeBudget(startMillis);
+      if(remaining == 0) {
+        _wifiClient.stop();
+        return false;
+      }
     }
-    //long interval = (long)_config.ntpUpdateInterval() * 60000;
-    int resultNameServer = WiFi.hostByName(_config.getNTPServer(), _timeServerIP);
-    if(resultNameServer == 0) return false;
+    _mqtt.setSocketTimeout((uint16_t)((remaining + 999) / 1000));
+    if(user == NULL) return _mqtt.connect(id) || _mqtt.connected();
+    return _mqtt.connect(id, user, password) || _mqtt.connected();
+  }
 
-    _ntpClient = new NTPClient(_udp, ntpServer, timeOffset, interval);
-    
-    _ntpClient->begin();
-    
-    
-    long startConnectTime = millis();
-    _ntpClient->update();
-    if(!_ntpClient->isTimeSet()) {
-      delay(NTP_RECONNECT_INTERVAL);
-      _ntpClient->setRandomPort();
-      _ntpClient->update();
+  // ESP8266 core 의 SNTP 로 시간 동기화를 시작한다. 응답은 기다리지 않으며, 동기화되면 settimeofday 콜백이 호출된다.
+  void ESP8266ConfigurationWizard::startNTP(const char* ntpServer,long timeOffset, unsigned long interval ) {
+    if(!_timeSyncCallbackSet) {
+      settimeofday_cb([this]() { _timeSynced = true; });
+      _timeSyncCallbackSet = true;
     }
-    
-    
-    return _ntpClient->isTimeSet();
-  
+    _ntpStartMillis = millis();
+    _ntpInterval = interval;
+    configTime(timeOffset, 0, ntpServer);
+    #ifdef _DEBUG_
+    Serial.print("sntp: ");
+    Serial.println(ntpServer);
+    #endif
   }
 
 
@@ -476,16 +910,15 @@ bool ESP8266ConfigurationWizard::connectMQTT() {
 	#ifdef _DEBUG_ 
 	Serial.println("initConfigurationMode()");
 	#endif
-	if(_ntpClient != NULL) {
-        _ntpClient->end();
-        delete _ntpClient;
-        _ntpClient = NULL;
-    }
     releaseWebServer();
     _webServer = new ESP8266WebServer(80);
+    static const char* headerKeys[] = {"Accept-Encoding", "If-None-Match"};
+    _webServer->collectHeaders(headerKeys, sizeof(headerKeys) / sizeof(headerKeys[0]));
 
     WiFi.mode(WIFI_AP_STA);
     WiFi.softAP(_config.getAPName(), "");
+    // 사용자가 페이지를 열기 전에 미리 스캔해 둔다.
+    _wifiScanner.start();
     
     IPAddress myIP = WiFi.softAPIP();
 	#ifdef _DEBUG_ 
@@ -494,17 +927,8 @@ bool ESP8266ConfigurationWizard::connectMQTT() {
 	#endif
 
     
-    _webServer->on("/", HTTP_GET, [&]{ onHttpRequestWifiHtml(); });
-    _webServer->on("/wifi", HTTP_GET, [&]{ onHttpRequestWifiHtml(); });
-    _webServer->on("/time", HTTP_GET, [&]{ onHttpRequestTimeHtml(); });
-    _webServer->on("/mqtt", HTTP_GET, [&]{ onHttpRequestMqttHtml(); });
-    _webServer->on("/option", HTTP_GET, [&]{ onHttpRequestOptionHtml(); });
-    _webServer->on("/finish", HTTP_GET, [&]{ onHttpRequestFinishHtml(); });
-    
-    _webServer->on("/js/ajax.js", HTTP_GET, [&]{ onHttpRequestAjaxJs(); });
-    _webServer->on("/js/app.js", HTTP_GET, [&]{ onHttpRequestAppJs(); });
-    _webServer->on("/js/env.js", HTTP_GET, [&]{ onHttpRequestEnvJs(); });
-    _webServer->on("/css/main.css", HTTP_GET, [&]{ onHttpRequestMainCss(); });
+    // 각 단계는 index 페이지 안에서 #wifi, #time 같은 hash 로 이동한다.
+    _webServer->on("/", HTTP_GET, [&]{ onHttpRequestIndexHtml(); });
     
     
     
@@ -515,21 +939,21 @@ bool ESP8266ConfigurationWizard::connectMQTT() {
     _webServer->on("/api/wifi/connect", HTTP_POST, [&]{ onHttpRequestWifiConnect(); });
     _webServer->on("/api/wifi/info", HTTP_GET, [&]{ onHttpRequestSelectedSSID(); });
 
-    _webServer->on("/api/wifi/scan/count", HTTP_GET, [&]{ onHttpRequestScanWifiCount(); });
-    _webServer->on("/api/wifi/scan/item", HTTP_GET, [&]{ onHttpRequestScanWifiItem(); });
 
 
     _webServer->on("/api/ntp/info", HTTP_GET, [&]{ onHttpRequestNTPInfo(); });
     _webServer->on("/api/ntp/set", HTTP_POST, [&]{  onHttpRequestSetNTP(); });
     
     _webServer->on("/api/wifi/scan", HTTP_GET, [&]{ onHttpRequestScanWifi(); });
+    _webServer->on("/api/wifi/scan/status", HTTP_GET, [&]{ onHttpRequestScanWifiStatus(); });
     _webServer->on("/api/mqtt/connect", HTTP_POST, [&]{ onHttpRequestMqttConnect(); });
     _webServer->on("/api/mqtt/info", HTTP_GET, [&]{ onHttpRequestMqttInfo(); });
+    _webServer->on("/api/job/status", HTTP_GET, [&]{ onHttpRequestJobStatus(); });
 
 
-    _webServer->on("/api/option/count", HTTP_GET, [&]{ onHttpRequestOptionCount(); });
-    _webServer->on("/api/option/get", HTTP_GET, [&]{ onHttpRequestGetOption(); });
+    _webServer->on("/api/option/list", HTTP_GET, [&]{ onHttpRequestOptionList(); });
     _webServer->on("/api/option/set", HTTP_POST, [&]{ onHttpRequestSetOption(); });
+    _webServer->on("/api/option/batch", HTTP_POST, [&]{ onHttpRequestSetOptions(); });
 
     _webServer->on("/api/commit", HTTP_GET, [&]{ onHttpRequestCommit(); });
     
@@ -538,7 +962,7 @@ bool ESP8266ConfigurationWizard::connectMQTT() {
 }
 
 
-String ESP8266ConfigurationWizard::resultStringFromEncryptionType(int thisType) {
+const char* ESP8266ConfigurationWizard::resultStringFromEncryptionType(int thisType) {
   switch (thisType) {
     case ENC_TYPE_WEP:
       return "WEP";
@@ -556,6 +980,7 @@ String ESP8266ConfigurationWizard::resultStringFromEncryptionType(int thisType)
       return "Auto";
       break;
   }
+  return "Unknown";
 }
 
 
@@ -566,135 +991,125 @@ void ESP8266ConfigurationWizard::sendBadRequest()
 }
 
 
-  void ESP8266ConfigurationWizard::onHttpRequestScanWifiCount() {
-    WiFi.mode(WIFI_AP_STA);
-    int n = WiFi.scanNetworks();
-    _wifiCount = n;
-    String result = "";
-    result.concat("{\"count\":");
-    result.concat(String(n));
-    result.concat("}");
-    _webServer->sendHeader("Access-Control-Allow-Origin", "*");
-    _webServer->send(200, "application/json", result);
-}
-
-void ESP8266ConfigurationWizard::onHttpRequestScanWifiItem() {
-    String strCount =  _webServer->arg("count");
-    int count = strCount.toInt();
-    
-    if (count >= _wifiCount) {
-      _webServer->sendHeader("Access-Control-Allow-Origin", "*");
-      _webServer->send(200, "application/json", "{}");
-    }
-    String result = "";
-    result.concat("{\"ssid\":\"");
-    result.concat(String(WiFi.SSID(count)));
-    result.concat("\",\"type\":\"");
-    result.concat(resultStringFromEncryptionType(WiFi.encryptionType(count)));
-    result.concat("\",\"rssi\":");
-    result.concat(String(WiFi.RSSI(count)));
-    result.concat("}");
-
-    
-    _webServer->sendHeader("Access-Control-Allow-Origin", "*");
-    _webServer->send(200, "application/json", result);
-}
-
-
-
+// 캐시가 유효하면 바로 목록을 보내고, 아니면 스캔을 시작하고 상태를 보낸다. 
+// refresh=1 이면 캐시를 무시하고 새로 스캔하고, limit=K 이면 신호가 강한 K 개만 보낸다.
+// 새로 스캔하다 실패해도 이전 목록이 있으면 그 목록을 error 와 함께 보낸다.
 void ESP8266ConfigurationWizard::onHttpRequestScanWifi() {
-    WiFi.mode(WIFI_AP_STA);
-    int n = WiFi.scanNetworks();
-    String result = "";
-    if (n <= 0) {
-      _webServer->sendHeader("Access-Control-Allow-Origin", "*");
-      _webServer->send(200, "application/json", "[]");
+    _wifiScanner.loop();
+    if(_wifiScanner.start(_webServer->arg("refresh") == "1")) {
+      sendWifiScanStatus();
+      return;
     }
-    result.concat("[");
+    if(_wifiScanner.state() != SCAN_STATE_DONE) {
+      sendWifiScanStatus();
+      return;
+    }
+    // 목록은 장치에서 SSID 별로 합치고 RSSI 순서로 정렬해 두었으므로 앞에서부터 limit 개만 보낸다.
+    int n = _wifiScanner.count();
+    int limit = _webServer->arg("limit").toInt();
+    if(limit > 0 && limit < n) n = limit;
+    JsonWriter json(_webServer);
+    json.beginObject();
+    json.add("state", "done");
+    json.add("age", _wifiScanner.age());
+    json.add("error", _wifiScanner.lastScanFailed());
+    json.key("list");
+    json.beginArray();
     for (int i = 0; i < n; ++i) {
-      result.concat("{\"ssid\":\"");
-      result.concat(String(WiFi.SSID(i)));
-      result.concat("\",\"type\":\"");
-      result.concat(resultStringFromEncryptionType(WiFi.encryptionType(i)));
-      result.concat("\",\"rssi\":");
-      result.concat(String(WiFi.RSSI(i)));
-      result.concat("}");
-      if(i != n - 1)  result.concat(",");
+      const WiFiScanResult* item = _wifiScanner.get(i);
+      json.beginObject();
+      json.add("ssid", (const char*)item->ssid);
+      json.add("type", resultStringFromEncryptionType(item->encryptionType));
+      json.add("rssi", (long)item->rssi);
+      json.endObject();
     }
-    result.concat("]");
-    
-    _webServer->sendHeader("Access-Control-Allow-Origin", "*");
-    _webServer->send(200, "application/json", result);
+    json.endArray();
+    json.endObject();
+    json.end();
 }
 
-
-
-void ESP8266ConfigurationWizard::onHttpRequestWifiHtml() {
-  _webServer->sendHeader("Access-Control-Allow-Origin", "*");
-  _webServer->send(200, "text/html", RES_WIFI_HTML); 
+void ESP8266ConfigurationWizard::onHttpRequestScanWifiStatus() {
+    _wifiScanner.loop();
+    sendWifiScanStatus();
 }
 
-
-void ESP8266ConfigurationWizard::onHttpRequestTimeHtml() {
-  _webServer->sendHeader("Access-Control-Allow-Origin", "*");
-  _webServer->send(200, "text/html", RES_TIME_HTML); 
+void ESP8266ConfigurationWizard::sendWifiScanStatus() {
+    JsonWriter json(_webServer);
+    json.beginObject();
+    json.add("state", _wifiScanner.stateName());
+    json.add("elapsed", _wifiScanner.elapsed());
+    json.add("count", (int)_wifiScanner.count());
+    json.add("age", _wifiScanner.age());
+    json.add("error", _wifiScanner.lastScanFailed());
+    json.endObject();
+    json.end();
 }
 
-void ESP8266ConfigurationWizard::onHttpRequestMqttHtml() {
-  _webServer->sendHeader("Access-Control-Allow-Origin", "*");
-  _webServer->send(200, "text/html", RES_MQTT_HTML); 
+void ESP8266ConfigurationWizard::sendSuccess(bool success, int code) {
+    JsonWriter json(_webServer, code);
+    json.beginObject();
+    json.add("success", success);
+    json.endObject();
+    json.end();
 }
 
-void ESP8266ConfigurationWizard::onHttpRequestOptionHtml() {
-  _webServer->sendHeader("Access-Control-Allow-Origin", "*");
-  _webServer->send(200, "text/html", RES_OPTION_HTML); 
-}
 
-void ESP8266ConfigurationWizard::onHttpRequestFinishHtml() {
-  _webServer->sendHeader("Access-Control-Allow-Origin", "*");
-  _webServer->send(200, "text/html", RES_FINISH_HTML); 
-}
-
-void ESP8266ConfigurationWizard::onHttpRequestAppJs() {
-  _webServer->sendHeader("Access-Control-Allow-Origin", "*");
-  _webServer->send(200, "text/javascript", RES_APP_JS); 
-}
 
-void ESP8266ConfigurationWizard::onHttpRequestEnvJs() {
+// 리소스는 flash 에 있으므로 RAM 으로 복사하지 않고 바로 보낸다.
+// gzip 을 받을 수 있는 클라이언트에는 압축된 리소스를 보낸다.
+// 그 외의 클라이언트에는 원본을 보낸다. WIZARD_RESOURCE_GZIP_ONLY 로 원본을 빼고 빌드한 경우에는 406 으로 응답한다.
+// 클라이언트가 가진 리소스의 ETag 가 같으면 내용 없이 304 로 응답한다.
+void ESP8266ConfigurationWizard::sendResource(const WebResource* resourceP, const char* cacheControl) {
+  WebResource resource;
+  memcpy_P(&resource, resourceP, sizeof(resource));
+  bool gzip = _webServer->header("Accept-Encoding").indexOf("gzip") >= 0;
   _webServer->sendHeader("Access-Control-Allow-Origin", "*");
-  _webServer->send(200, "text/javascript", RES_ENV_JS); 
-}
-
-void ESP8266ConfigurationWizard::onHttpRequestAjaxJs() {
-  _webServer->sendHeader("Access-Control-Allow-Origin", "*");
-  _webServer->send(200, "text/javascript", RES_AJAX_JS); 
+  _webServer->sendHeader("Vary", "Accept-Encoding");
+  if(!gzip && resource.content == NULL) {
+    _webServer->send(406, "text/plain", "gzip encoding required");
+    return;
+  }
+  String etag = FPSTR(gzip ? resource.gzipEtag : resource.etag);
+  _webServer->sendHeader("Cache-Control", cacheControl);
+  _webServer->sendHeader("ETag", etag);
+  if(_webServer->header("If-None-Match").indexOf(etag) >= 0) {
+    _webServer->send(304);
+    return;
+  }
+  if(!gzip) {
+    _webServer->send_P(200, resource.contentType, (PGM_P)resource.content, resource.length);
+    return;
+  }
+  _webServer->sendHeader("Content-Encoding", "gzip");
+  _webServer->send_P(200, resource.contentType, (PGM_P)resource.gzipContent, resource.gzipLength);
 }
 
-void ESP8266ConfigurationWizard::onHttpRequestMainCss() {
-  _webServer->sendHeader("Access-Control-Allow-Origin", "*");
-  _webServer->send(200, "text/css", RES_MAIN_CSS); 
+void ESP8266ConfigurationWizard::onHttpRequestIndexHtml() {
+  sendResource(&RES_INDEX_HTML_RESOURCE, RESOURCE_CACHE_PAGE); 
 }
 
 
 void ESP8266ConfigurationWizard::onHttpRequestInfo() {
-  IPAddress myIP = WiFi.localIP();
-  _webServer->sendHeader("Access-Control-Allow-Origin", "*");
-  _webServer->send(200, "application/json", String("{\"connected\":") +  ( (WiFi.status() != WL_CONNECTED) ? "false" : "true" )  +  ",\"ip\":\"" + myIP.toString()  + "\",\"version\":\"" + _config.version()  + "\",\"ssid\":\"" + _config.getWiFiSSID() + "\",\"device\":\"" + _config.getDeviceName() + "\"}"); 
+  JsonWriter json(_webServer);
+  json.beginObject();
+  json.add("connected", WiFi.status() == WL_CONNECTED);
+  json.add("ip", WiFi.localIP());
+  json.add("version", _config.version());
+  json.add("ssid", _config.getWiFiSSID());
+  json.add("device", _config.getDeviceName());
+  json.endObject();
+  json.end();
 }
 
 void ESP8266ConfigurationWizard::onHttpRequestCommit() {
-  _webServer->sendHeader("Access-Control-Allow-Origin", "*");
-  if(saveConfig()) {
-      _webServer->send(200, "application/json", "{\"success\":true}");
-  } else {
-      _webServer->send(200, "application/json", "{\"success\":false}");
-  }
+  sendSuccess(saveConfig());
   delay(1000);
   ESP.restart();
 }
 
 
 
+// 연결은 processJob() 에서 확인하고, 여기서는 작업 id 만 바로 응답한다.
 void ESP8266ConfigurationWizard::onHttpRequestWifiConnect()  {
   
   String ssid = _webServer->arg("ssid");
@@ -702,7 +1117,6 @@ void ESP8266ConfigurationWizard::onHttpRequestWifiConnect()  {
   #ifdef _DEBUG_ 
   Serial.print("ssid : ");
   Serial.println(ssid);
-  Serial.print("password : ");
   #endif
   
   if (ssid.length() <= 0) {
@@ -710,84 +1124,53 @@ void ESP8266ConfigurationWizard::onHttpRequestWifiConnect()  {
       return;
   }
   
+  startJob(JOB_WIFI);
+  _job.host = ssid;
+  _job.password = password;
   if(password.length() <= 0)  WiFi.begin(ssid);
   else WiFi.begin(ssid, password);
-  
-  
-  long current = millis();
-  delay(1000);
-  while (WiFi.status() != WL_CONNECTED) {
-      delay(1);
-      if(millis() - current > WIFI_TIMEOUT) {       
-  
-        _webServer->sendHeader("Access-Control-Allow-Origin", "*");
-        _webServer->send(400, "application/json", "{\"success\":false}");
-        return;
-      }
-  }
-  _config.setWiFiSSID(ssid);
-  _config.setWiFiPassword(password);
-  
-  
-  
-  IPAddress myIP = WiFi.localIP();
-  _webServer->sendHeader("Access-Control-Allow-Origin", "*");
-  return _webServer->send(200, "application/json", String("{\"success\":true,\"ip\":\"") + myIP.toString()  + "\"}");
+  sendJob();
 }
 
 
 
 void ESP8266ConfigurationWizard::onHttpRequestMqttConnect()  {
-    String server = _webServer->arg("url");
-    String portStr = _webServer->arg("port");
-    String user = _webServer->arg("muser");
-    String pass = _webServer->arg("mpass");
-    String clientID = _webServer->arg("mid");
-
-    int port = portStr.toInt();
-    bool connected = false; 
+    int port = _webServer->arg("port").toInt();
     if(port <= 0) port = 1883;
 
-
-    if(_mqtt.connected()) {
-      _mqtt.disconnect();
-    }
-    _mqtt.setServer(server.c_str(), port);
-    if (user.isEmpty() && pass.isEmpty() ) {
-      if(_mqtt.connect(clientID.c_str())) {
-        connected = true;
-        _config.setMQTTddress(server);
-        _config.setMQTTPort(port);
-        _config.setMQTTClientID(clientID);
-        _config.setMQTTUser("");
-        _config.setMQTTPassword("");
-      }
-    }
-    else if(_mqtt.connect(clientID.c_str(), user.c_str(), pass.c_str())) {
-      connected = true;
-      _config.setMQTTddress(server);
-      _config.setMQTTPort(port);
-      _config.setMQTTClientID(clientID);
-      _config.setMQTTUser(user);
-      _config.setMQTTPassword(pass);
-    } 
-
-    _webServer->sendHeader("Access-Control-Allow-Origin", "*");
-    _webServer->send(200, "application/json", String("{\"success\":") + (connected ? "true" : "false")  + "}");
+    startJob(JOB_MQTT);
+    _job.host = _webServer->arg("url");
+    _job.number = port;
+    _job.user = _webServer->arg("muser");
+    _job.password = _webServer->arg("mpass");
+    _job.clientID = _webServer->arg("mid");
+    sendJob();
 }
 
 
   void ESP8266ConfigurationWizard::onHttpRequestMqttInfo()  {
-    _webServer->sendHeader("Access-Control-Allow-Origin", "*");
-    _webServer->send(200, "application/json", String("{\"success\":true, \"url\":\"") +  _config.getMQTTAddress() + "\", \"port\":" + _config.getMQTTPort() +  ",\"muser\":\"" + _config.getMQTTUser() + "\",\"mpass\":\"" + _config.getMQTTPassword() + "\",\"mid\":\"" + _config.getMQTTClientID() +  "\"  }");
+    JsonWriter json(_webServer);
+    json.beginObject();
+    json.add("success", true);
+    json.add("url", _config.getMQTTAddress());
+    json.add("port", _config.getMQTTPort());
+    json.add("muser", _config.getMQTTUser());
+    json.add("mpass", _config.getMQTTPassword());
+    json.add("mid", _config.getMQTTClientID());
+    json.endObject();
+    json.end();
 }
 
 
 
 
 void ESP8266ConfigurationWizard::onHttpRequestSelectedSSID() {
-  _webServer->sendHeader("Access-Control-Allow-Origin", "*");
-  _webServer->send(200, "application/json", String("{\"success\":true, \"ssid\":\"") +  _config.getWiFiSSID() + "\"}" );
+  JsonWriter json(_webServer);
+  json.beginObject();
+  json.add("success", true);
+  json.add("ssid", _config.getWiFiSSID());
+  json.endObject();
+  json.end();
 }
 
 
@@ -796,8 +1179,14 @@ void ESP8266ConfigurationWizard::onHttpRequestSelectedSSID() {
 
 
 void ESP8266ConfigurationWizard::onHttpRequestNTPInfo() {
-  _webServer->sendHeader("Access-Control-Allow-Origin", "*");
-  _webServer->send(200, "application/json", String("{\"success\":true, \"ntp\":\"") +  _config.getNTPServer() + "\", \"interval\":" + _config.getNTPUpdateInterval() +  ",\"offset\":" + _config.getTimeOffset() + "}");
+  JsonWriter json(_webServer);
+  json.beginObject();
+  json.add("success", true);
+  json.add("ntp", _config.getNTPServer());
+  json.add("interval", (int)_config.getNTPUpdateInterval());
+  json.add("offset", _config.getTimeOffset());
+  json.endObject();
+  json.end();
 }
 
 void ESP8266ConfigurationWizard::onHttpRequestSetNTP() {
@@ -805,57 +1194,255 @@ void ESP8266ConfigurationWizard::onHttpRequestSetNTP() {
   String strTimeOffset = _webServer->arg("offset");
   long interval = atol(_webServer->arg("interval").c_str());
   if(ntpServer.isEmpty() || strTimeOffset.isEmpty() || interval == 0) {
-    _webServer->send(400,"application/json", String("{\"success\":false}"));
+    sendSuccess(false, 400);
     return;
   }
-  long timeOffset = atol(strTimeOffset.c_str());
-  bool isSuccess = connectNTP(ntpServer.c_str(), timeOffset, interval * 60000L);
-  
-  _webServer->sendHeader("Access-Control-Allow-Origin", "*");
-  
-  if(isSuccess) {
-    _config.setNTPServer(ntpServer);
-    _config.setTimeOffset(timeOffset);
-    _config.setNTPUpdateInterval((uint16_t)interval);
-    _webServer->send(200,"application/json", String("{\"success\":true, \"h\":" + String(_ntpClient->getHours()) + ",\"m\":" + String(_ntpClient->getMinutes()) +  ",\"s\":" +  String(_ntpClient->getSeconds())  + "}"));
-  } else {
-    _webServer->send(400,"application/json", String("{\"success\":false}"));
+  startJob(JOB_NTP);
+  _job.host = ntpServer;
+  _job.number = atol(strTimeOffset.c_str());
+  _job.interval = interval;
+  // 새 서버로 동기화되는지 확인해야 하므로 이전 동기화 결과는 지운다.
+  _timeSynced = false;
+  startNTP(_job.host.c_str(), _job.number, interval * 60000L);
+  sendJob();
+}
+
+
+// 새 작업은 진행 중인 작업을 대신한다.
+void ESP8266ConfigurationWizard::startJob(uint8_t type) {
+  _job.id++;
+  _job.type = type;
+  _job.state = JOB_STATE_RUNNING;
+  _job.startMillis = millis();
+}
+
+void ESP8266ConfigurationWizard::finishJob(bool success) {
+  _job.state = success ? JOB_STATE_DONE : JOB_STATE_FAILED;
+  // 웹 페이지가 결과를 받아간 뒤에도 남아 있을 필요가 없다.
+  _job.password = String();
+}
+
+// 작업이 끝날 때까지 걸리는 최대 시간. (ms) 웹 페이지는 이 시간이 지나도 running 이면 상태 확인을 멈춘다.
+unsigned long ESP8266ConfigurationWizard::jobTimeout() {
+  switch(_job.type) {
+    case JOB_WIFI: return WIFI_TIMEOUT;
+    case JOB_NTP: return NTP_TIMEOUT;
+    case JOB_MQTT: return _timeBudget;
   }
+  return 0;
 }
 
+// AP 를 찾지 못했거나 인증에 실패하면 WIFI_TIMEOUT 까지 기다리지 않는다.
+// WL_WRONG_PASSWORD 는 ESP8266 core 3.0.0 부터 있으며, 이전 버전은 WL_CONNECT_FAILED 로 알려준다.
+bool ESP8266ConfigurationWizard::isWiFiConnectFailed(int status) {
+  #if defined(ARDUINO_ESP8266_MAJOR) && ARDUINO_ESP8266_MAJOR >= 3
+  if(status == WL_WRONG_PASSWORD) return true;
+  #endif
+  return status == WL_CONNECT_FAILED || status == WL_NO_SSID_AVAIL;
+}
 
-void ESP8266ConfigurationWizard::onHttpRequestOptionCount() {
-  int count = _config.getOptionCount();
-  _webServer->sendHeader("Access-Control-Allow-Origin", "*");
-  _config.beginOption();
-  _webServer->send(200,"application/json", String("{\"success\":true, \"cnt\":" + String(count) + "}"));
+// 설정 모드의 loop() 에서만 호출된다. (MQTT 연결은 기다려야 하므로 HTTP 요청 처리 중에는 진행하지 않는다) 성공한 값만 설정에 반영한다.
+void ESP8266ConfigurationWizard::processJob() {
+  if(_job.state != JOB_STATE_RUNNING) return;
+  unsigned long elapsed = millis() - _job.startMillis;
+  switch(_job.type) {
+    case JOB_WIFI:
+      if(WiFi.status() == WL_CONNECTED && WiFi.SSID() == _job.host) {
+        _config.setWiFiSSID(_job.host);
+        _config.setWiFiPassword(_job.password);
+        finishJob(true);
+      } else if(isWiFiConnectFailed(WiFi.status()) || elapsed >= WIFI_TIMEOUT) {
+        finishJob(false);
+      }
+      break;
+    case JOB_NTP:
+      if(_timeSynced) {
+        _config.setNTPServer(_job.host);
+        _config.setTimeOffset(_job.number);
+        _config.setNTPUpdateInterval((uint16_t)_job.interval);
+        finishJob(true);
+      } else if(elapsed >= NTP_TIMEOUT) {
+        // 동기화되지 않은 서버로 SNTP 가 계속 요청하지 않도록 저장된 설정으로 되돌린다.
+        startNTP(_config.getNTPServer(), _config.getTimeOffset(), (long)_config.getNTPUpdateInterval() * 60000L);
+        finishJob(false);
+      }
+      break;
+    case JOB_MQTT:
+      // PubSubClient 의 연결은 기다릴 수밖에 없으므로 응답을 보낸 뒤 loop() 에서 기다린다.
+      // connectMQTT() 는 TCP 연결, CONNACK, 재시도를 합쳐 setTimeBudget() 을 넘기지 않는다.
+      if(_mqtt.connected()) _mqtt.disconnect();
+      if(connectMQTT(_job.host.c_str(), (int)_job.number, _job.clientID.c_str(), _job.user.c_str(), _job.password.c_str())) {
+        _config.setMQTTddress(_job.host);
+        _config.setMQTTPort((uint16_t)_job.number);
+        _config.setMQTTClientID(_job.clientID);
+        _config.setMQTTUser(_job.user);
+        _config.setMQTTPassword(_job.password);
+        finishJob(true);
+      } else {
+        finishJob(false);
+      }
+      break;
+  }
+}
+
+void ESP8266ConfigurationWizard::sendJob() {
+  JsonWriter json(_webServer);
+  json.beginObject();
+  json.add("success", true);
+  json.add("job", (int)_job.id);
+  json.add("timeout", jobTimeout());
+  json.endObject();
+  json.end();
+}
+
+// id 가 현재 작업과 다르면 (다른 작업으로 바뀌었거나 재부팅된 경우) state 는 unknown 이다.
+void ESP8266ConfigurationWizard::onHttpRequestJobStatus() {
+  static const char* const stateNames[] = {"idle", "running", "done", "failed"};
+  bool found = _job.type != JOB_NONE && _webServer->arg("id").toInt() == _job.id;
+  JsonWriter json(_webServer);
+  json.beginObject();
+  json.add("success", found);
+  json.add("id", (int)_job.id);
+  json.add("state", found ? stateNames[_job.state] : "unknown");
+  if(found) {
+    json.add("elapsed", millis() - _job.startMillis);
+  }
+  if(found && _job.state == JOB_STATE_DONE) {
+    if(_job.type == JOB_WIFI) {
+      json.add("ip", WiFi.localIP());
+    } else if(_job.type == JOB_NTP) {
+      json.add("h", getHours());
+      json.add("m", getMinutes());
+      json.add("s", getSeconds());
+    }
+  }
+  json.endObject();
+  json.end();
+}
+
+
+// 모든 옵션을 한 번에 보낸다. Config 의 옵션 cursor 를 사용하지 않으므로 여러 브라우저에서 동시에 열어도 된다.
+void ESP8266ConfigurationWizard::onHttpRequestOptionList() {
+  JsonWriter json(_webServer);
+  json.beginObject();
+  json.add("success", true);
+  json.key("list");
+  json.beginArray();
+  for(int handle = 0, n = _config.getOptionCount(); handle < n; ++handle) {
+    UserOption* option = _config.getUserOption(handle);
+    json.beginObject();
+    json.key("name");
+    json.beginString();
+    option->printName(json);
+    json.endString();
+    json.key("value");
+    json.beginString();
+    option->printValue(json);
+    json.endString();
+    json.key("default");
+    json.beginString();
+    option->printDefaultValue(json);
+    json.endString();
+    json.add("isNull", option->isNull());
+    json.add("type", (int)option->getType());
+    json.endObject();
+  }
+  json.endArray();
+  json.endObject();
+  json.end();
 }
 
 void ESP8266ConfigurationWizard::onHttpRequestSetOption() {
   String name = _webServer->arg("name");
   String value = _webServer->arg("value");
-  _webServer->sendHeader("Access-Control-Allow-Origin", "*");
   if(_onFilterOption != NULL) {
     const char* message = _onFilterOption(name.c_str(), value.c_str());
     if(message != NULL && strlen(message) > 0) {
-      _webServer->send(200,"application/json", String("{\"success\":false,\"msg\":\"" + String(message) + "\" }"));
+      JsonWriter json(_webServer);
+      json.beginObject();
+      json.add("success", false);
+      json.add("msg", message);
+      json.endObject();
+      json.end();
       return;
     }
   }
-  if(_config.setOptionValue(name,value)) {
-    _webServer->send(200,"application/json", String("{\"success\":true}"));
+  int handle = _config.getOptionHandle(name.c_str());
+  UserOption* option = _config.getUserOption(handle);
+  // 큰 값은 파일에 바로 쓰고 설정에는 descriptor 만 남긴다. 
+  bool success = option != NULL && option->getType() == OPTION_TYPE_BLOB ? 
+                 _configFile.writeOption(_config, handle, (const uint8_t*)value.c_str(), value.length()) : 
+                 _config.setOptionValue(name,value);
+  sendSuccess(success);
+}
+
+// 여러 옵션을 한 번에 설정한다. 인자는 count 와 name0, value0, name1, value1 ... 이다.
+// 하나라도 잘못된 값이 있으면 아무것도 바꾸지 않고, 잘못된 옵션마다 이름과 이유를 errors 로 보낸다.
+void ESP8266ConfigurationWizard::onHttpRequestSetOptions() {
+  int count = _webServer->arg("count").toInt();
+  if(count <= 0 || count > _config.getOptionCount()) {
+    sendSuccess(false, 400);
     return;
   }
-  _webServer->send(200,"application/json", String("{\"success\":false}"));
+  char nameKey[OPTION_BATCH_KEY_SIZE];
+  char valueKey[OPTION_BATCH_KEY_SIZE];
+  JsonWriter json(_webServer);
+  json.beginObject();
+  json.key("errors");
+  json.beginArray();
+  bool success = true;
+  for(int i = 0; i < count; ++i) {
+    snprintf(nameKey, sizeof(nameKey), "name%d", i);
+    snprintf(valueKey, sizeof(valueKey), "value%d", i);
+    String name = _webServer->arg(nameKey);
+    const char* message = checkOptionValue(name.c_str(), _webServer->arg(valueKey).c_str());
+    if(message == NULL) continue;
+    success = false;
+    json.beginObject();
+    json.add("name", name.c_str());
+    json.add("msg", message);
+    json.endObject();
+  }
+  json.endArray();
+  // 검사를 통과한 값은 복사본에 먼저 적용하고, 모두 성공했을 때만 설정을 바꾼다.
+  // 큰 값(OPTION_TYPE_BLOB)은 새 이름의 파일에 쓰고 복사본의 descriptor 만 바꾸므로 현재 값의 파일은 그대로 남는다.
+  // 파일 쓰기를 줄이기 위해 다른 값을 모두 적용한 뒤에 쓰고, 실패하면 이번에 쓴 파일을 지운다.
+  if(success) {
+    Config staged(_config);
+    for(int pass = 0; pass < 2 && success; ++pass) {
+      for(int i = 0; i < count && success; ++i) {
+        snprintf(nameKey, sizeof(nameKey), "name%d", i);
+        snprintf(valueKey, sizeof(valueKey), "value%d", i);
+        int handle = staged.getOptionHandle(_webServer->arg(nameKey).c_str());
+        bool isBlob = staged.getUserOption(handle)->getType() == OPTION_TYPE_BLOB;
+        if(isBlob != (pass == 1)) continue;
+        String value = _webServer->arg(valueKey);
+        success = isBlob ? _configFile.writeOption(staged, handle, (const uint8_t*)value.c_str(), value.length()) :
+                           staged.setOptionValue(handle, value.c_str());
+      }
+    }
+    if(success) _config = staged;
+    else _configFile.removeUnusedBlobs(_config);
+  }
+  json.add("success", success);
+  json.endObject();
+  json.end();
 }
 
-void ESP8266ConfigurationWizard::onHttpRequestGetOption() {
-   UserOption* option = _config.nextOption();
-   const char* value = option == NULL ? "" : option->getValue();
-   value = strlen(value) == 0 && option != NULL ? option->getDefaultValue() : value;
-   String name =  option == NULL ? "" : option->getName();
-  _webServer->sendHeader("Access-Control-Allow-Origin", "*");
-  _webServer->send(200,"application/json", String("{\"success\":true, \"name\": \"" + name + "\",\"value\":\"" + String(value) + "\",\"isNull\":" + (option != NULL && option->isNull() ? "true" : "false") + "}"));
+// 옵션 값을 적용할 수 있는지 검사한다. 문제가 없으면 NULL, 아니면 이유를 반환한다.
+const char* ESP8266ConfigurationWizard::checkOptionValue(const char* name, const char* value) {
+  UserOption* option = _config.getUserOption(_config.getOptionHandle(name));
+  if(option == NULL) return "Unknown option.";
+  if(_onFilterOption != NULL) {
+    const char* message = _onFilterOption(name, value);
+    if(message != NULL && strlen(message) > 0) return message;
+  }
+  size_t length = strlen(value);
+  if(length == 0) return option->isNull() ? NULL : "Empty values are not allowed.";
+  if(option->getType() == OPTION_TYPE_BLOB) return NULL;
+  if(length > OPTION_VALUE_MAX_LENGTH) return "Value is too long.";
+  if(!option->isValidValue(value)) return "Invalid value.";
+  return NULL;
 }
 
 
@@ -863,228 +1450,70 @@ bool ESP8266ConfigurationWizard::saveConfig() {
 		if(!LittleFS.begin()){
 			return false;
 		}
-
-		char NTPUpdateIntervalBuf[16];
-		char offsetBuf[16];
-		char mqttPortBuf[16];
-		memset(NTPUpdateIntervalBuf, '\0', 16);
-		memset(offsetBuf, '\0', 16);
-		memset(mqttPortBuf, '\0', 16);
-		ltoa(_config.getNTPUpdateInterval(), NTPUpdateIntervalBuf,10);
-		ltoa(_config.getTimeOffset(), offsetBuf,10);
-		ltoa(_config.getMQTTPort(), mqttPortBuf,10);
-
-
-		LittleFS.remove("/config002.dat");
-		LittleFS.remove(CONFIG_FILENAME);
-		File configFile = LittleFS.open(CONFIG_FILENAME, "w");
-		if (!configFile) {
-			#ifdef _DEBUG_ 
-			Serial.println("Failed to open config file for writing");
-			#endif
-			return false;
-		}	  
-		
-		writeLineInConfigFile(&configFile,ESP_CONFIGURATION_WIZARD_VERSION);
-
-		writeLineInConfigFile(&configFile,_config.version());	  
-		writeLineInConfigFile(&configFile,_config.getDeviceName());
-		writeLineInConfigFile(&configFile,_config.getWiFiSSID());	  
-		writeLineInConfigFile(&configFile,_config.getWiFiPassword());	  
-		writeLineInConfigFile(&configFile,_config.getNTPServer());	  
-		writeLineInConfigFile(&configFile,NTPUpdateIntervalBuf);	  
-		writeLineInConfigFile(&configFile,offsetBuf);	  
-		writeLineInConfigFile(&configFile,_config.getMQTTAddress());	  
-		writeLineInConfigFile(&configFile,mqttPortBuf);	  
-		writeLineInConfigFile(&configFile,_config.getMQTTClientID());	  
-		writeLineInConfigFile(&configFile,_config.getMQTTUser());	  
-		writeLineInConfigFile(&configFile,_config.getMQTTPassword());	
-
-		if(!saveConfigOptions(&configFile)){
-			configFile.close();
-			return false;
-		}
-
-		configFile.close();
-
-
-		return true;
+		return _configFile.save(_config);
     }
 	
 	
-	bool ESP8266ConfigurationWizard::saveConfigOptions(File* file) {    
-		int optionCount=_config.getOptionCount();
-		char optionCountBuffer[16];
-		memset(optionCountBuffer, '\0', 16);
-		itoa(optionCount, optionCountBuffer,10);
-		writeLineInConfigFile(file,optionCountBuffer);
-
-		_config.beginOption();
-		for(int i = 0, n = optionCount; i < n; ++i) {
-			UserOption* option = _config.nextOption();
-			String name = option->getName();
-			String value = option->getValue();
-			writeLineInConfigFile(file,name.c_str());
-			writeLineInConfigFile(file,value.c_str());
-		}
-		return true;
+    bool ESP8266ConfigurationWizard::commitConfig() {
+		return saveConfig();
     }
-	
-	
-	void ESP8266ConfigurationWizard::writeLineInConfigFile(File* file, const char* value) {
-		file->write(value, strlen(value));
-		file->write("\n", 1);
-	}
-	
-	
-	 
-    bool ESP8266ConfigurationWizard::loadConfig() {
-		if(!LittleFS.begin()){
-			return false;
-		}
 
-		char buffer[VALUE_BUFFER_SIZE];      
-		memset(buffer, '\0', VALUE_BUFFER_SIZE);
-		#ifdef _DEBUG_ 
-		Serial.println("Load file");
-		Serial.println(CONFIG_FILENAME);
-		#endif
-		File configFile = LittleFS.open(CONFIG_FILENAME, "r");
-		
+    // 스캔 결과를 재사용하는 시간. (ms)
+    void ESP8266ConfigurationWizard::setWiFiScanCacheTTL(unsigned long ttl) {
+		_wifiScanner.setCacheTTL(ttl);
+    }
 
-		if (!configFile) {
-			#ifdef _DEBUG_ 
-			Serial.println("Failed to open config file");
-			#endif
 
+    // OPTION_TYPE_BLOB 옵션의 값을 파일에 쓰고 설정을 저장한다.
+    bool ESP8266ConfigurationWizard::writeOption(int handle, Stream& in, size_t length) {
+		if(!LittleFS.begin() || !_configFile.writeOption(_config, handle, in, length)){
 			return false;
 		}
-		char* value = NULL;
-		// 라인이 null 값이면 정리하고 false 를 반홚야함.
-		if((value = readLineInConfigFile(&configFile, buffer)) == NULL) {
-			configFile.close();
-			return false;
-		}
-		if(strcmp(value, ESP_CONFIGURATION_WIZARD_VERSION) != 0) {
-			configFile.close();
-			return false;
-		}
-		
-		if((value = readLineInConfigFile(&configFile, buffer)) == NULL) {
-			configFile.close();
-			return false;
-		}
-		_config.setVersion(String(value));
-		if((value = readLineInConfigFile(&configFile, buffer)) == NULL) {
-			configFile.close();
-			return false;
-		}
-		_config.setDeviceName(String(value));
-		if((value = readLineInConfigFile(&configFile, buffer)) == NULL) {
-			configFile.close();
-			return false;
-		}
-		_config.setWiFiSSID(String(value));
-		if((value = readLineInConfigFile(&configFile, buffer)) == NULL) {
-			configFile.close();
-			return false;
-		}
-		_config.setWiFiPassword(String(value));
+		return saveConfig();
+    }
 
-		if((value = readLineInConfigFile(&configFile, buffer)) == NULL) {
-			configFile.close();
-			return false;
-		}
-		_config.setNTPServer(String(value));
-		if((value = readLineInConfigFile(&configFile, buffer)) == NULL) {
-			configFile.close();
-			return false;
-		}
-		_config.setNTPUpdateInterval(atol(value));
-		if((value = readLineInConfigFile(&configFile, buffer)) == NULL) {
-			configFile.close();
-			return false;
-		}
-		_config.setTimeOffset(atol(value));
 
-		if((value = readLineInConfigFile(&configFile, buffer)) == NULL) {
-			configFile.close();
-			return false;
-		}
-		_config.setMQTTddress( String(value) );
-		if((value = readLineInConfigFile(&configFile, buffer)) == NULL) {
-			configFile.close();
+    bool ESP8266ConfigurationWizard::writeOption(int handle, const uint8_t* data, size_t length) {
+		if(!LittleFS.begin() || !_configFile.writeOption(_config, handle, data, length)){
 			return false;
 		}
-		_config.setMQTTPort(atoi(  value ));
-		if((value = readLineInConfigFile(&configFile, buffer)) == NULL) {
-			configFile.close();
-			return false;
-		}
-		_config.setMQTTClientID(  String(value) );
-		if((value = readLineInConfigFile(&configFile, buffer)) == NULL) {
-			configFile.close();
-			return false;
-		}
-		_config.setMQTTUser( String(value)  );
-		if((value = readLineInConfigFile(&configFile, buffer)) == NULL) {
-			configFile.close();
-			return false;
-		}
-		_config.setMQTTPassword( String(value) );
+		return saveConfig();
+    }
 
 
-		if(!loadConfigOptions(&configFile, buffer)) {
-			configFile.close();
-		   return false;
-		}
+    bool ESP8266ConfigurationWizard::writeOption(const char* name, Stream& in, size_t length) {
+		return writeOption(_config.getOptionHandle(name), in, length);
+    }
 
-		configFile.close();
 
-		return true;
+    bool ESP8266ConfigurationWizard::writeOption(const char* name, const uint8_t* data, size_t length) {
+		return writeOption(_config.getOptionHandle(name), data, length);
+    }
+
+
+    File ESP8266ConfigurationWizard::openOption(int handle) {
+		if(!LittleFS.begin()){
+			return File();
+		}
+		return _configFile.openOption(_config, handle);
     }
-	
-	bool ESP8266ConfigurationWizard::loadConfigOptions(File *file, char* buffer) {
-		
-	  bool isReadName = true; 
-	  
-	  char* value = NULL;
-   	  // 라인이 null 값이면 정리하고 false 를 반홚야함.
-	  if((value = readLineInConfigFile(file, buffer)) == NULL) return false;
-	  int optionCount = atoi(  value );
-	  
-      for(int i = 0; i < optionCount; ++i) {
-		if((value = readLineInConfigFile(file, buffer)) == NULL) return false;
-		String name(value);
-		if((value = readLineInConfigFile(file, buffer)) == NULL) return false;		
-		String optionValue(value);
-		#ifdef _DEBUG_
-		Serial.print(name);
-		Serial.print(":");
-		Serial.println(optionValue);
-		#endif
-		_config.setOptionValue(name, optionValue);
-      }
-	  #ifdef _DEBUG_
-      Serial.println("loadConfigOptions()...OK!");
-	  #endif
-	  return true;
 
+
+    File ESP8266ConfigurationWizard::openOption(const char* name) {
+		return openOption(_config.getOptionHandle(name));
     }
 
-	char* ESP8266ConfigurationWizard::readLineInConfigFile(File* file, char* buffer) {
-		memset(buffer, '\0', VALUE_BUFFER_SIZE);
-		int cnt = 0;
-		while(file->available()){
-			char ch = file->read();
-			if(ch != '\n') {
-			  buffer[cnt++] = ch;
-			} else {				
-			  return buffer;
-			}
+
+    bool ESP8266ConfigurationWizard::loadConfig() {
+		if(!LittleFS.begin()){
+			return false;
 		}
-		return NULL;
-	}
+		#ifdef _DEBUG_ 
+		Serial.println("Load file");
+		Serial.println(CONFIG_FILENAME);
+		#endif
+		return _configFile.load(_config);
+    }
 
 
     
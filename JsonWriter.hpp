@@ -0,0 +1,284 @@
+#pragma once
+
+#include <ESP8266WebServer.h>
+
+/**
+ * API 응답용 JSON 출력기. (Streaming JSON writer)
+ * 고정 크기 buffer 에 JSON 을 쓰고, 응답 전체가 buffer 에 들어가면 Content-Length 와 함께 한 번에 보낸다.
+ * buffer 가 차면 chunked 전송으로 바꾸고 buffer 단위로 흘려보내므로 응답 크기와 관계없이 heap 을 사용하지 않는다.
+ * Print 를 상속하므로 문자열 값 안에서는 UserOption::printValue() 처럼 Print 로 쓰는 값도 escape 된다.
+ * JSON_WRITER_MAX_DEPTH 보다 깊게 중첩하거나 열지 않은 객체, 배열을 닫으면 failed() 가 되고 이후의 출력은 버린다.
+ * 아직 보내기 전이면 end() 는 500 오류를 보낸다.
+ *
+ *   JsonWriter json(_webServer);
+ *   json.beginObject();
+ *   json.add("success", true);
+ *   json.add("ssid", _config.getWiFiSSID());
+ *   json.endObject();
+ *   json.end();
+ */
+
+#define JSON_WRITER_BUFFER_SIZE 256
+// 객체, 배열을 중첩할 수 있는 깊이. (쉼표 위치를 bit 로 기억한다)
+#define JSON_WRITER_MAX_DEPTH 32
+
+
+class JsonWriter : public Print {
+  private :
+    ESP8266WebServer* _server;
+    int _code;
+    char _buffer[JSON_WRITER_BUFFER_SIZE];
+    size_t _length;
+    uint32_t _hasItem;
+    uint8_t _depth;
+    bool _afterKey;
+    bool _inString;
+    bool _chunked;
+    bool _failed;
+
+  public :
+    JsonWriter(ESP8266WebServer* server, int code = 200);
+    JsonWriter(const JsonWriter&) = delete;
+    JsonWriter& operator=(const JsonWriter&) = delete;
+
+    void beginObject();
+    void endObject();
+    void beginArray();
+    void endArray();
+    void key(const char* name);
+
+    void value(const char* value);
+    void value(long value);
+    void value(unsigned long value);
+    void value(int value);
+    void value(bool value);
+    void value(const IPAddress& ip);
+    void nullValue();
+
+    // Print 로 문자열 값을 쓸 때 사용한다. beginString() 과 endString() 사이의 출력은 escape 된다.
+    void beginString();
+    void endString();
+
+    template<typename T> void add(const char* name, T value) {
+      key(name);
+      this->value(value);
+    }
+
+    void end();
+    bool failed() const;
+
+    size_t write(uint8_t ch) override;
+    size_t write(const uint8_t* data, size_t size) override;
+
+  private :
+    void open(char ch);
+    void close(char ch);
+    void fail();
+    void separate();
+    void writeRaw(const char* text);
+    void writeRaw(char ch);
+    void writeEscaped(char ch);
+    void flushBuffer();
+};
+
+
+JsonWriter::JsonWriter(ESP8266WebServer* server, int code) : _server(server), _code(code), _length(0), _hasItem(0), _depth(0), _afterKey(false), _inString(false), _chunked(false), _failed(false) {
+}
+
+void JsonWriter::beginObject() {
+  open('{');
+}
+
+void JsonWriter::endObject() {
+  close('}');
+}
+
+void JsonWriter::beginArray() {
+  open('[');
+}
+
+void JsonWriter::endArray() {
+  close(']');
+}
+
+void JsonWriter::key(const char* name) {
+  separate();
+  writeRaw('"');
+  while(*name != '\0') writeEscaped(*name++);
+  writeRaw("\":");
+  _afterKey = true;
+}
+
+void JsonWriter::value(const char* value) {
+  beginString();
+  if(value != NULL) {
+    while(*value != '\0') writeEscaped(*value++);
+  }
+  endString();
+}
+
+void JsonWriter::value(long value) {
+  char number[12];
+  separate();
+  writeRaw(ltoa(value, number, 10));
+}
+
+void JsonWriter::value(unsigned long value) {
+  char number[12];
+  separate();
+  writeRaw(ultoa(value, number, 10));
+}
+
+void JsonWriter::value(int value) {
+  this->value((long)value);
+}
+
+void JsonWriter::value(bool value) {
+  separate();
+  writeRaw(value ? "true" : "false");
+}
+
+void JsonWriter::value(const IPAddress& ip) {
+  char address[16];
+  snprintf(address, sizeof(address), "%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+  value((const char*)address);
+}
+
+void JsonWriter::nullValue() {
+  separate();
+  writeRaw("null");
+}
+
+void JsonWriter::beginString() {
+  separate();
+  writeRaw('"');
+  _inString = true;
+}
+
+void JsonWriter::endString() {
+  _inString = false;
+  writeRaw('"');
+}
+
+// 응답을 끝낸다. chunked 로 보내는 중이 아니면 여기서 한 번에 보낸다.
+// 이미 chunked 로 보내기 시작한 뒤에 실패했으면 응답 코드를 바꿀 수 없으므로 보낸 데까지만 보내고 끝낸다.
+void JsonWriter::end() {
+  if(_failed && !_chunked) {
+    _server->sendHeader("Access-Control-Allow-Origin", "*");
+    _server->send(500, "application/json", "{\"success\":false}");
+    _length = 0;
+    return;
+  }
+  if(!_chunked) {
+    _server->sendHeader("Access-Control-Allow-Origin", "*");
+    _server->send(_code, "application/json", _buffer, _length);
+    _length = 0;
+    return;
+  }
+  flushBuffer();
+  _server->sendContent("");
+}
+
+bool JsonWriter::failed() const {
+  return _failed;
+}
+
+size_t JsonWriter::write(uint8_t ch) {
+  if(_inString) writeEscaped((char)ch);
+  else writeRaw((char)ch);
+  return 1;
+}
+
+size_t JsonWriter::write(const uint8_t* data, size_t size) {
+  for(size_t i = 0; i < size; ++i) write(data[i]);
+  return size;
+}
+
+// 깊이마다 bit 하나로 쉼표 위치를 기억하므로 JSON_WRITER_MAX_DEPTH 를 넘으면 더 쓰지 않는다.
+void JsonWriter::open(char ch) {
+  if(_depth >= JSON_WRITER_MAX_DEPTH) {
+    fail();
+    return;
+  }
+  separate();
+  writeRaw(ch);
+  ++_depth;
+  _hasItem &= ~(1UL << (_depth - 1));
+}
+
+void JsonWriter::close(char ch) {
+  if(_depth == 0) {
+    fail();
+    return;
+  }
+  writeRaw(ch);
+  --_depth;
+}
+
+void JsonWriter::fail() {
+  #ifdef _DEBUG_
+  if(!_failed) Serial.println("JsonWriter: invalid nesting.");
+  #endif
+  _failed = true;
+}
+
+// 같은 객체, 배열 안의 두 번째 항목부터 앞에 쉼표를 붙인다. key 바로 뒤의 값은 제외한다.
+void JsonWriter::separate() {
+  if(_afterKey) {
+    _afterKey = false;
+    return;
+  }
+  if(_depth == 0) return;
+  uint32_t bit = 1UL << (_depth - 1);
+  if(_hasItem & bit) writeRaw(',');
+  _hasItem |= bit;
+}
+
+void JsonWriter::writeRaw(const char* text) {
+  while(*text != '\0') writeRaw(*text++);
+}
+
+void JsonWriter::writeRaw(char ch) {
+  if(_failed) return;
+  if(_length >= JSON_WRITER_BUFFER_SIZE) flushBuffer();
+  _buffer[_length++] = ch;
+}
+
+void JsonWriter::writeEscaped(char ch) {
+  switch(ch) {
+    case '"':
+      writeRaw("\\\"");
+      return;
+    case '\\':
+      writeRaw("\\\\");
+      return;
+    case '\n':
+      writeRaw("\\n");
+      return;
+    case '\r':
+      writeRaw("\\r");
+      return;
+    case '\t':
+      writeRaw("\\t");
+      return;
+  }
+  if((uint8_t)ch < 0x20) {
+    char code[7];
+    snprintf(code, sizeof(code), "\\u%04x", (uint8_t)ch);
+    writeRaw(code);
+    return;
+  }
+  writeRaw(ch);
+}
+
+// buffer 가 처음 찼을 때 chunked 응답을 시작한다.
+void JsonWriter::flushBuffer() {
+  if(!_chunked) {
+    _server->sendHeader("Access-Control-Allow-Origin", "*");
+    _server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+    _server->send(_code, "application/json", "");
+    _chunked = true;
+  }
+  if(_length > 0) _server->sendContent(_buffer, _length);
+  _length = 0;
+}
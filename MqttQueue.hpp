@@ -0,0 +1,378 @@
+#pragma once
+
+#include <LittleFS.h>
+#include <PubSubClient.h>
+
+/**
+ * MQTT 연결이 끊어진 동안 publish 한 메시지를 보관하는 queue. (Offline publish queue)
+ *
+ *  record : [topic length(u8)][payload length(u16)][flags(u8)][topic][payload]
+ *
+ * 메시지는 먼저 RAM ring buffer 에 쌓고, ring 이 가득 차면 MQTT_QUEUE_DIRECTORY 아래 segment 파일 뒤에 같은 형식으로 덧붙인다.
+ * segment 에 메시지가 남아 있는 동안에는 순서를 지키기 위해 새 메시지도 segment 에 쓴다.
+ * segment 가 MQTT_QUEUE_MAX_SEGMENTS 개를 넘으면 가장 오래된 segment 를 지운다. (지운 메시지 수는 dropped() 로 확인한다)
+ *
+ * drain() 은 가장 오래된 메시지 하나를 beginPublish(), write(), endPublish() 로 보내므로 payload 를 한 번에 메모리에 올리지 않는다.
+ * 쌓인 메시지가 많으면 (isBacklogged()) 전송 간격을 지키지 않고 한 번에 MQTT_QUEUE_DRAIN_BURST 개까지 보내서,
+ * 설정한 속도보다 빠르게 publish 하는 경우에도 queue 가 segment 로 계속 커지지 않게 한다.
+ * payload 를 다 쓰지 못하면 선언한 길이와 맞지 않는 packet 이 되므로 연결을 끊고, 메시지는 queue 에 남겨 다시 연결된 뒤 보낸다.
+ * segment 의 읽은 위치는 저장하지 않으므로 재부팅하면 첫 segment 의 이미 보낸 메시지가 다시 전송될 수 있다. (at-least-once)
+ * RAM 에 있던 메시지는 재부팅하면 사라진다.
+ */
+
+#define MQTT_QUEUE_RAM_SIZE 2048
+#define MQTT_QUEUE_DIRECTORY "/mq"
+#define MQTT_QUEUE_PATH_SIZE 24
+#define MQTT_QUEUE_SEGMENT_SIZE 4096
+#define MQTT_QUEUE_MAX_SEGMENTS 8
+#define MQTT_QUEUE_RECORD_HEADER_SIZE 4
+#define MQTT_QUEUE_COPY_BUFFER_SIZE 64
+// 초당 보내는 메시지 수. 0 이면 drain() 을 호출할 때마다 보낸다.
+#define MQTT_QUEUE_DRAIN_RATE 20
+// segment 에 메시지가 있거나 RAM ring 이 절반 넘게 찼으면 전송 간격과 관계없이 drain() 한 번에 이만큼 보낸다.
+#define MQTT_QUEUE_DRAIN_BURST 8
+
+#define MQTT_QUEUE_FLAG_RETAINED 0x01
+
+
+class MqttQueue {
+  private :
+    uint8_t* _ring;
+    size_t _head;
+    size_t _used;
+    uint16_t _ramCount;
+
+    uint32_t _firstSegment;
+    uint32_t _lastSegment;
+    size_t _readOffset;
+    size_t _lastSegmentSize;
+    uint32_t _spillCount;
+    uint32_t _dropped;
+    bool _spillLoaded;
+
+    uint16_t _rate;
+    unsigned long _lastDrainMillis;
+
+  public :
+    MqttQueue();
+    ~MqttQueue();
+    MqttQueue(const MqttQueue&) = delete;
+    MqttQueue& operator=(const MqttQueue&) = delete;
+
+    bool begin();
+    bool push(const char* topic, const uint8_t* payload, size_t length, bool retained);
+    bool drain(PubSubClient& mqtt);
+    void clear();
+
+    void setRate(uint16_t messagesPerSecond);
+    bool isEmpty() const;
+    bool isBacklogged() const;
+    uint32_t count() const;
+    uint32_t spilled() const;
+    uint32_t dropped() const;
+
+  private :
+    bool pushRam(const uint8_t* header, const char* topic, const uint8_t* payload, size_t length);
+    bool pushSegment(const uint8_t* header, const char* topic, const uint8_t* payload, size_t length);
+    bool drainRam(PubSubClient& mqtt);
+    bool drainSegment(PubSubClient& mqtt);
+    void dropFirstSegment();
+    void nextSegment();
+    uint8_t ringAt(size_t offset) const;
+    void ringWrite(const uint8_t* data, size_t length);
+    static void segmentPath(uint32_t segment, char* path);
+    static uint32_t countRecords(File& file, size_t offset);
+};
+
+
+MqttQueue::MqttQueue() : _ring(NULL), _head(0), _used(0), _ramCount(0), _firstSegment(0), _lastSegment(0), _readOffset(0), _lastSegmentSize(0), _spillCount(0), _dropped(0), _spillLoaded(false), _rate(MQTT_QUEUE_DRAIN_RATE), _lastDrainMillis(0) {
+}
+
+MqttQueue::~MqttQueue() {
+  if(_ring != NULL) delete[] _ring;
+}
+
+// 이전에 남은 segment 를 찾는다. LittleFS 를 mount 하지 못하면 false 를 반환하고, 다음 호출에서 다시 찾는다.
+// 찾기 전에 segment 를 쓰면 이전 segment 를 덮어쓰므로 pushSegment() 도 먼저 이 함수를 호출한다.
+bool MqttQueue::begin() {
+  if(_spillLoaded) return true;
+  if(!LittleFS.begin()) return false;
+  _spillLoaded = true;
+  bool found = false;
+  Dir dir = LittleFS.openDir(MQTT_QUEUE_DIRECTORY);
+  while(dir.next()) {
+    uint32_t segment = strtoul(dir.fileName().c_str(), NULL, 16);
+    if(!found || segment < _firstSegment) _firstSegment = segment;
+    if(!found || segment > _lastSegment) _lastSegment = segment;
+    found = true;
+  }
+  if(!found) return true;
+  char path[MQTT_QUEUE_PATH_SIZE];
+  for(uint32_t segment = _firstSegment; segment <= _lastSegment; ++segment) {
+    segmentPath(segment, path);
+    File file = LittleFS.open(path, "r");
+    if(!file) continue;
+    _spillCount += countRecords(file, 0);
+    if(segment == _lastSegment) _lastSegmentSize = file.size();
+    file.close();
+  }
+  #ifdef _DEBUG_
+  Serial.print("mqtt queue restored: ");
+  Serial.println(_spillCount);
+  #endif
+  return true;
+}
+
+// 메시지를 보관할 수 없으면 false. (topic 이 255 byte 를 넘거나, record 가 segment 보다 크거나, RAM 이 가득 찼는데 LittleFS 를 mount 하지 못한 경우)
+bool MqttQueue::push(const char* topic, const uint8_t* payload, size_t length, bool retained) {
+  size_t topicLength = strlen(topic);
+  if(topicLength == 0 || topicLength > 0xFF || length > 0xFFFF) return false;
+  uint8_t header[MQTT_QUEUE_RECORD_HEADER_SIZE];
+  header[0] = (uint8_t)topicLength;
+  header[1] = (uint8_t)(length & 0xFF);
+  header[2] = (uint8_t)(length >> 8);
+  header[3] = retained ? MQTT_QUEUE_FLAG_RETAINED : 0;
+  if(_spillCount == 0 && pushRam(header, topic, payload, length)) return true;
+  return pushSegment(header, topic, payload, length);
+}
+
+// 가장 오래된 메시지부터 보낸다. 쌓인 메시지가 많으면 MQTT_QUEUE_DRAIN_BURST 개까지, 아니면 하나만 보낸다.
+// 보낼 메시지가 없거나, 전송 간격이 지나지 않았거나, 첫 메시지 전송에 실패하면 false.
+bool MqttQueue::drain(PubSubClient& mqtt) {
+  if(isEmpty()) return false;
+  bool backlogged = isBacklogged();
+  if(!backlogged && _rate > 0 && millis() - _lastDrainMillis < 1000UL / _rate) return false;
+  _lastDrainMillis = millis();
+  bool sent = false;
+  for(int i = 0; i < (backlogged ? MQTT_QUEUE_DRAIN_BURST : 1) && !isEmpty(); ++i) {
+    if(!(_ramCount > 0 ? drainRam(mqtt) : drainSegment(mqtt))) break;
+    sent = true;
+  }
+  return sent;
+}
+
+void MqttQueue::clear() {
+  _head = 0;
+  _used = 0;
+  _ramCount = 0;
+  char path[MQTT_QUEUE_PATH_SIZE];
+  for(uint32_t segment = _firstSegment; segment <= _lastSegment; ++segment) {
+    segmentPath(segment, path);
+    LittleFS.remove(path);
+  }
+  _firstSegment = _lastSegment;
+  _readOffset = 0;
+  _lastSegmentSize = 0;
+  _spillCount = 0;
+  _dropped = 0;
+}
+
+void MqttQueue::setRate(uint16_t messagesPerSecond) {
+  _rate = messagesPerSecond;
+}
+
+bool MqttQueue::isEmpty() const {
+  return _ramCount == 0 && _spillCount == 0;
+}
+
+// segment 에 메시지가 있거나 RAM ring 이 절반 넘게 찼으면 true. 이 동안은 drain() 이 전송 간격을 지키지 않는다.
+bool MqttQueue::isBacklogged() const {
+  return _spillCount > 0 || _used > MQTT_QUEUE_RAM_SIZE / 2;
+}
+
+uint32_t MqttQueue::count() const {
+  return _ramCount + _spillCount;
+}
+
+// 파일에 보관 중인 메시지 수.
+uint32_t MqttQueue::spilled() const {
+  return _spillCount;
+}
+
+// segment 가 넘쳐서 버린 메시지 수.
+uint32_t MqttQueue::dropped() const {
+  return _dropped;
+}
+
+bool MqttQueue::pushRam(const uint8_t* header, const char* topic, const uint8_t* payload, size_t length) {
+  size_t size = MQTT_QUEUE_RECORD_HEADER_SIZE + header[0] + length;
+  if(_used + size > MQTT_QUEUE_RAM_SIZE || _ramCount == 0xFFFF) return false;
+  if(_ring == NULL) _ring = new uint8_t[MQTT_QUEUE_RAM_SIZE];
+  ringWrite(header, MQTT_QUEUE_RECORD_HEADER_SIZE);
+  ringWrite((const uint8_t*)topic, header[0]);
+  ringWrite(payload, length);
+  ++_ramCount;
+  return true;
+}
+
+bool MqttQueue::pushSegment(const uint8_t* header, const char* topic, const uint8_t* payload, size_t length) {
+  size_t size = MQTT_QUEUE_RECORD_HEADER_SIZE + header[0] + length;
+  if(size > MQTT_QUEUE_SEGMENT_SIZE || !begin()) return false;
+  if(_spillCount > 0 && _lastSegmentSize + size > MQTT_QUEUE_SEGMENT_SIZE) nextSegment();
+  char path[MQTT_QUEUE_PATH_SIZE];
+  segmentPath(_lastSegment, path);
+  File file = LittleFS.open(path, _lastSegmentSize == 0 ? "w" : "a");
+  if(!file) return false;
+  bool written = file.write(header, MQTT_QUEUE_RECORD_HEADER_SIZE) == MQTT_QUEUE_RECORD_HEADER_SIZE &&
+                 file.write((const uint8_t*)topic, header[0]) == header[0] &&
+                 file.write(payload, length) == length;
+  if(!written) {
+    // 일부만 쓰인 record 를 지워야 다음 record 를 이어서 쓸 수 있다.
+    file.truncate(_lastSegmentSize);
+    file.close();
+    return false;
+  }
+  file.close();
+  _lastSegmentSize += size;
+  ++_spillCount;
+  return true;
+}
+
+bool MqttQueue::drainRam(PubSubClient& mqtt) {
+  char topic[0x100];
+  uint8_t topicLength = ringAt(0);
+  size_t length = ringAt(1) | ((size_t)ringAt(2) << 8);
+  bool retained = (ringAt(3) & MQTT_QUEUE_FLAG_RETAINED) != 0;
+  for(size_t i = 0; i < topicLength; ++i) topic[i] = (char)ringAt(MQTT_QUEUE_RECORD_HEADER_SIZE + i);
+  topic[topicLength] = '\0';
+  if(!mqtt.beginPublish(topic, length, retained)) return false;
+  size_t offset = (_head + MQTT_QUEUE_RECORD_HEADER_SIZE + topicLength) % MQTT_QUEUE_RAM_SIZE;
+  size_t remain = length;
+  while(remain > 0) {
+    // ring 끝에서 나뉜 payload 는 두 번에 나누어 쓴다.
+    size_t chunk = MQTT_QUEUE_RAM_SIZE - offset;
+    if(chunk > remain) chunk = remain;
+    if(mqtt.write(_ring + offset, chunk) != chunk) {
+      // packet 길이가 이미 전송되었으므로 연결을 끊는다. 메시지는 queue 에 남는다.
+      mqtt.disconnect();
+      return false;
+    }
+    offset = (offset + chunk) % MQTT_QUEUE_RAM_SIZE;
+    remain -= chunk;
+  }
+  if(!mqtt.endPublish()) return false;
+  size_t size = MQTT_QUEUE_RECORD_HEADER_SIZE + topicLength + length;
+  _head = (_head + size) % MQTT_QUEUE_RAM_SIZE;
+  _used -= size;
+  --_ramCount;
+  return true;
+}
+
+bool MqttQueue::drainSegment(PubSubClient& mqtt) {
+  char path[MQTT_QUEUE_PATH_SIZE];
+  segmentPath(_firstSegment, path);
+  File file = LittleFS.open(path, "r");
+  uint8_t header[MQTT_QUEUE_RECORD_HEADER_SIZE];
+  char topic[0x100];
+  if(!file || !file.seek(_readOffset, SeekSet) || file.read(header, MQTT_QUEUE_RECORD_HEADER_SIZE) != MQTT_QUEUE_RECORD_HEADER_SIZE) {
+    // segment 를 끝까지 읽었거나 잃어버린 경우.
+    if(file) file.close();
+    if(_firstSegment == _lastSegment) {
+      _spillCount = 0;
+      LittleFS.remove(path);
+      _readOffset = 0;
+      _lastSegmentSize = 0;
+      return false;
+    }
+    LittleFS.remove(path);
+    ++_firstSegment;
+    _readOffset = 0;
+    return drainSegment(mqtt);
+  }
+  uint8_t topicLength = header[0];
+  size_t length = header[1] | ((size_t)header[2] << 8);
+  bool retained = (header[3] & MQTT_QUEUE_FLAG_RETAINED) != 0;
+  if(file.read((uint8_t*)topic, topicLength) != topicLength || file.available() < (int)length) {
+    file.close();
+    _readOffset = MQTT_QUEUE_SEGMENT_SIZE + 1;
+    return drainSegment(mqtt);
+  }
+  topic[topicLength] = '\0';
+  if(!mqtt.beginPublish(topic, length, retained)) {
+    file.close();
+    return false;
+  }
+  uint8_t buffer[MQTT_QUEUE_COPY_BUFFER_SIZE];
+  size_t remain = length;
+  while(remain > 0) {
+    size_t read = file.read(buffer, remain < sizeof(buffer) ? remain : sizeof(buffer));
+    if(read == 0 || mqtt.write(buffer, read) != read) {
+      // drainRam() 과 같이 길이가 맞지 않는 packet 을 끝내지 않고 연결을 끊는다.
+      file.close();
+      mqtt.disconnect();
+      return false;
+    }
+    remain -= read;
+  }
+  file.close();
+  if(!mqtt.endPublish()) return false;
+  _readOffset += MQTT_QUEUE_RECORD_HEADER_SIZE + topicLength + length;
+  --_spillCount;
+  if(_spillCount == 0) {
+    LittleFS.remove(path);
+    _firstSegment = _lastSegment;
+    _readOffset = 0;
+    _lastSegmentSize = 0;
+  }
+  return true;
+}
+
+// 남은 메시지 수를 빼고 가장 오래된 segment 를 지운다.
+void MqttQueue::dropFirstSegment() {
+  char path[MQTT_QUEUE_PATH_SIZE];
+  segmentPath(_firstSegment, path);
+  File file = LittleFS.open(path, "r");
+  uint32_t count = 0;
+  if(file) {
+    count = countRecords(file, _readOffset);
+    file.close();
+  }
+  LittleFS.remove(path);
+  if(count > _spillCount) count = _spillCount;
+  _spillCount -= count;
+  _dropped += count;
+  _readOffset = 0;
+  if(_firstSegment == _lastSegment) {
+    _lastSegmentSize = 0;
+    return;
+  }
+  ++_firstSegment;
+}
+
+void MqttQueue::nextSegment() {
+  ++_lastSegment;
+  _lastSegmentSize = 0;
+  if(_lastSegment - _firstSegment >= MQTT_QUEUE_MAX_SEGMENTS) dropFirstSegment();
+}
+
+uint8_t MqttQueue::ringAt(size_t offset) const {
+  return _ring[(_head + offset) % MQTT_QUEUE_RAM_SIZE];
+}
+
+void MqttQueue::ringWrite(const uint8_t* data, size_t length) {
+  size_t tail = (_head + _used) % MQTT_QUEUE_RAM_SIZE;
+  for(size_t i = 0; i < length; ++i) {
+    _ring[tail] = data[i];
+    tail = tail + 1 == MQTT_QUEUE_RAM_SIZE ? 0 : tail + 1;
+  }
+  _used += length;
+}
+
+void MqttQueue::segmentPath(uint32_t segment, char* path) {
+  snprintf(path, MQTT_QUEUE_PATH_SIZE, MQTT_QUEUE_DIRECTORY "/%08lx", (unsigned long)segment);
+}
+
+// offset 부터 끝까지 온전한 record 의 수. 파일 끝에서 잘린 record 는 세지 않는다.
+uint32_t MqttQueue::countRecords(File& file, size_t offset) {
+  uint32_t count = 0;
+  size_t size = file.size();
+  uint8_t header[MQTT_QUEUE_RECORD_HEADER_SIZE];
+  while(offset + MQTT_QUEUE_RECORD_HEADER_SIZE <= size) {
+    if(!file.seek(offset, SeekSet) || file.read(header, MQTT_QUEUE_RECORD_HEADER_SIZE) != MQTT_QUEUE_RECORD_HEADER_SIZE) break;
+    size_t recordSize = MQTT_QUEUE_RECORD_HEADER_SIZE + header[0] + (header[1] | ((size_t)header[2] << 8));
+    if(offset + recordSize > size) break;
+    offset += recordSize;
+    ++count;
+  }
+  return count;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "OptionTable.hpp"
+
+/**
+ * 컴파일 타임 옵션 스키마. (Compile-time option schema)
+ * 옵션 이름, 기본값, 빈 값 허용 여부, 이름의 해시값을 모두 flash(PROGMEM) 에 둔다.
+ * 기본값은 사용자가 값을 바꾸기 전까지 RAM 을 사용하지 않는다.
+ * OPTION(id, 이름, 기본값, 빈 값 허용, 타입, 선택지)
+ *
+  [[example[[
+  #define MY_OPTIONS(OPTION) \
+    OPTION(DeviceName, "DeviceName", "ESP8266ConfigurationWizard", false, OPTION_TYPE_STRING, "") \
+    OPTION(Interval, "Interval", "60", false, OPTION_TYPE_INT, "") \
+    OPTION(Mode, "Mode", "auto", true, OPTION_TYPE_ENUM, "auto|heat|cool")
+
+  DECLARE_OPTION_SCHEMA(MY_OPTION_SCHEMA, MY_OPTIONS);
+
+  void setup() {
+    config->addOptionSchema(MY_OPTION_SCHEMA);
+  }
+ */
+
+struct OptionSpec {
+  PGM_P name;
+  PGM_P defaultValue;
+  PGM_P choices;
+  uint32_t hash;
+  bool isNull;
+  uint8_t type;
+};
+
+
+#define OPTION_SPEC_STRINGS(id, name, defaultValue, isNull, type, choices) \
+  static const char id##_OPTION_NAME[] PROGMEM = name; \
+  static const char id##_OPTION_DEFAULT[] PROGMEM = defaultValue; \
+  static const char id##_OPTION_CHOICES[] PROGMEM = choices;
+
+#define OPTION_SPEC_ENTRY(id, name, defaultValue, isNull, type, choices) \
+  { id##_OPTION_NAME, id##_OPTION_DEFAULT, id##_OPTION_CHOICES, optionHash(name), isNull, type },
+
+#define DECLARE_OPTION_SCHEMA(schema, OPTION_LIST) \
+  OPTION_LIST(OPTION_SPEC_STRINGS) \
+  static const OptionSpec schema[] PROGMEM = { OPTION_LIST(OPTION_SPEC_ENTRY) }
@@ -0,0 +1,211 @@
+#pragma once
+
+#include <utility>
+#include "UserOption.hpp"
+
+/**
+ * 옵션 저장소. (Option store)
+ * UserOption 을 하나의 연속된 배열에 보관하고, 이름의 해시값으로 만든 open addressing 인덱스로 찾는다.
+ * addOption 이 반환하는 handle 은 배열의 위치이므로 옵션이 삭제되기 전까지 바뀌지 않는다.
+ */
+
+#define OPTION_INVALID_HANDLE -1
+
+#define OPTION_TABLE_INITIAL_CAPACITY 8
+// 인덱스 한 칸이 uint8_t 이고 0xFF 는 빈 칸 표시로 사용한다.
+#define OPTION_TABLE_MAX_CAPACITY 254
+#define OPTION_INDEX_EMPTY 0xFF
+#define OPTION_NAME_BUFFER_SIZE 64
+
+
+// FNV-1a (32bit)
+constexpr uint32_t optionHash(const char* name, uint32_t hash = 2166136261UL) {
+  return *name == '\0' ? hash : optionHash(name + 1, (hash ^ (uint8_t)*name) * 16777619UL);
+}
+
+
+class OptionTable {
+  private :
+    UserOption* _options;
+    uint8_t* _index;
+    int _count;
+    int _capacity;
+    int _indexSize;
+
+  public :
+    OptionTable();
+    OptionTable(const OptionTable& table);
+    ~OptionTable();
+    OptionTable& operator=(const OptionTable& table);
+
+    int add(const char* name);
+    int add_P(PGM_P name, uint32_t hash);
+    int find(const char* name) const;
+    int find(const char* name, uint32_t hash) const;
+    UserOption* get(int handle) const;
+    int count() const;
+    void clear();
+
+  private :
+    int append(uint32_t hash);
+    bool grow();
+    void rebuildIndex();
+    void insertIndex(int handle);
+    void copy(const OptionTable& table);
+    void release();
+};
+
+
+OptionTable::OptionTable() : _options(NULL), _index(NULL), _count(0), _capacity(0), _indexSize(0) {
+}
+
+OptionTable::OptionTable(const OptionTable& table) : _options(NULL), _index(NULL), _count(0), _capacity(0), _indexSize(0) {
+  copy(table);
+}
+
+OptionTable::~OptionTable() {
+  release();
+}
+
+OptionTable& OptionTable::operator=(const OptionTable& table) {
+  if(this != &table) {
+    release();
+    copy(table);
+  }
+  return *this;
+}
+
+int OptionTable::add(const char* name) {
+  uint32_t hash = optionHash(name);
+  int handle = find(name, hash);
+  if(handle != OPTION_INVALID_HANDLE) {
+    return handle;
+  }
+  handle = append(hash);
+  if(handle != OPTION_INVALID_HANDLE) {
+    _options[handle].setName(name);
+  }
+  return handle;
+}
+
+// hash 는 전체 이름으로 계산되어 있으므로 잘린 이름으로 찾지 않도록 buffer 보다 긴 이름은 받지 않는다.
+int OptionTable::add_P(PGM_P name, uint32_t hash) {
+  if(strlen_P(name) >= OPTION_NAME_BUFFER_SIZE) return OPTION_INVALID_HANDLE;
+  char buffer[OPTION_NAME_BUFFER_SIZE];
+  strncpy_P(buffer, name, OPTION_NAME_BUFFER_SIZE - 1);
+  buffer[OPTION_NAME_BUFFER_SIZE - 1] = '\0';
+  int handle = find(buffer, hash);
+  if(handle != OPTION_INVALID_HANDLE) {
+    return handle;
+  }
+  handle = append(hash);
+  if(handle != OPTION_INVALID_HANDLE) {
+    _options[handle].setName_P(name);
+  }
+  return handle;
+}
+
+int OptionTable::find(const char* name) const {
+  return find(name, optionHash(name));
+}
+
+int OptionTable::find(const char* name, uint32_t hash) const {
+  if(_count == 0) return OPTION_INVALID_HANDLE;
+  int mask = _indexSize - 1;
+  for(int slot = hash & mask;; slot = (slot + 1) & mask) {
+    uint8_t handle = _index[slot];
+    if(handle == OPTION_INDEX_EMPTY) {
+      return OPTION_INVALID_HANDLE;
+    }
+    UserOption* option = &_options[handle];
+    if(option->getHash() == hash && option->equalsName(name)) {
+      return handle;
+    }
+  }
+}
+
+UserOption* OptionTable::get(int handle) const {
+  if(handle < 0 || handle >= _count) return NULL;
+  return &_options[handle];
+}
+
+int OptionTable::count() const {
+  return _count;
+}
+
+void OptionTable::clear() {
+  release();
+}
+
+int OptionTable::append(uint32_t hash) {
+  if(_count == _capacity && !grow()) {
+    return OPTION_INVALID_HANDLE;
+  }
+  int handle = _count++;
+  _options[handle].setHash(hash);
+  insertIndex(handle);
+  return handle;
+}
+
+bool OptionTable::grow() {
+  int capacity = _capacity == 0 ? OPTION_TABLE_INITIAL_CAPACITY : _capacity * 2;
+  if(capacity > OPTION_TABLE_MAX_CAPACITY) capacity = OPTION_TABLE_MAX_CAPACITY;
+  if(capacity <= _capacity) return false;
+
+  UserOption* options = new UserOption[capacity];
+  for(int i = 0; i < _count; ++i) {
+    options[i] = std::move(_options[i]);
+  }
+  delete[] _options;
+  _options = options;
+  _capacity = capacity;
+  rebuildIndex();
+  return true;
+}
+
+void OptionTable::rebuildIndex() {
+  // 부하율이 50% 를 넘지 않도록 용량의 두 배 이상인 2의 거듭제곱 크기로 잡는다.
+  int indexSize = 16;
+  while(indexSize < _capacity * 2) indexSize <<= 1;
+  if(indexSize != _indexSize) {
+    delete[] _index;
+    _index = new uint8_t[indexSize];
+    _indexSize = indexSize;
+  }
+  memset(_index, OPTION_INDEX_EMPTY, _indexSize);
+  for(int i = 0; i < _count; ++i) {
+    insertIndex(i);
+  }
+}
+
+void OptionTable::insertIndex(int handle) {
+  int mask = _indexSize - 1;
+  int slot = _options[handle].getHash() & mask;
+  while(_index[slot] != OPTION_INDEX_EMPTY) {
+    slot = (slot + 1) & mask;
+  }
+  _index[slot] = (uint8_t)handle;
+}
+
+void OptionTable::copy(const OptionTable& table) {
+  if(table._capacity == 0) return;
+  _options = new UserOption[table._capacity];
+  _index = new uint8_t[table._indexSize];
+  _capacity = table._capacity;
+  _indexSize = table._indexSize;
+  _count = table._count;
+  for(int i = 0; i < _count; ++i) {
+    _options[i] = table._options[i];
+  }
+  memcpy(_index, table._index, _indexSize);
+}
+
+void OptionTable::release() {
+  delete[] _options;
+  delete[] _index;
+  _options = NULL;
+  _index = NULL;
+  _count = 0;
+  _capacity = 0;
+  _indexSize = 0;
+}
@@ -1,9 +1,2438 @@
-#define RES_WIFI_HTML "<!DOCTYPE html><html lang='en'><head><meta charset='UTF-8'><title>Configuration Wizard</title><meta name='viewport' content='width=device-width,user-scalable=no'><link rel='stylesheet' type='text/css' href='css/main.css'><script type='text/javascript' charset='utf-8' src='js/env.js'></script><script type='text/javascript' charset='utf-8' src='js/ajax.js'></script><script type='text/javascript' charset='utf-8' src='js/app.js'></script></head><body onload='WifiConfig.init()'><div style='width:100%;margin-left:-10px'><div class='layout-outter'><div class='layout-contents'><div><div class='step curr'><a href='wifi'>Wifi</a></div><div class='step-arrow'>▷</div><div class='step'>Time</div><div class='step-arrow'>▷</div><div class='step'>Mqtt</div><div class='step-arrow'>▷</div><div class='step'>Options</div><div class='step-arrow'>▷</div><div class='step'>Finish</div></div><h2>Wifi Access</h2><div id='wifi-list'></div><br><div class='form'><div class='form'><span class='label'>SSID:</span><input type='text' id='wifi-ssid'></div><div class='form'><span class='label'>Password:</span><input type='text' id='wifi-passwd'></div><div class='result'></div><div class='layout-outter' style='margin-top:50px'><button id='btn-commit' style='width:49%'>Submit</button> <button id='btn-next' style='width:49%'>Next</button></div><br><br><br><div class='layout-loading' id='wifi-loading'><div id='text-loading'>Loading...</div></div></div></div></div></div></body></html>"
-#define RES_TIME_HTML "<!DOCTYPE html><html lang='en'><meta name='viewport' content='width=device-width,user-scalable=no'><link rel='stylesheet' type='text/css' href='css/main.css'><script type='text/javascript' charset='utf-8' src='js/ajax.js'></script><script type='text/javascript' charset='utf-8' src='js/env.js'></script><script type='text/javascript' charset='utf-8' src='js/app.js'></script><head><meta charset='UTF-8'><title>Configuration Wizard</title></head><body onload='TimeConfig.init()'><div class='layout-outter'><div class='layout-contents'><div style='width:100%;margin-left:-10px'><div class='step comp'><a href='wifi'>Wifi</a></div><div class='step-arrow comp'>▶</div><div class='step curr'><a href='time'>Time</a></div><div class='step-arrow'>▷</div><div class='step'>Mqtt</div><div class='step-arrow'>▷</div><div class='step'>Options</div><div class='step-arrow'>▷</div><div class='step'>Finish</div></div><h2>Time setting</h2><div class='form'><span class='label'>NTP Server:</span><input type='text' id='input-ntp' maxlength='64'></div><div class='form'><span class='label'>Interval:</span><input type='number' id='input-interval'><sub>min</sub></div><div class='form'><span class='label'>Time zone:</span><select id='select-utc'></select></div><div class='form' id='block-timeoffset' style='display:none'><span class='label'>Time offset:</span><input type='number' id='input-manually-utc'><sub>sec</sub></div><div id='settime-result' class='result'></div><div class='layout-outter' style='margin-top:50px'><button id='btn-commit' style='width:49%'>Submit</button> <button id='btn-next' style='width:49%'>Next</button></div></div></div><div class='layout-loading' id='wifi-loading'><div id='text-loading'>Loading...</div></div></body></html>"
-#define RES_MQTT_HTML "<!DOCTYPE html><html lang='en'><head><meta charset='UTF-8'><meta name='viewport' content='width=device-width,user-scalable=no'><link rel='stylesheet' type='text/css' href='css/main.css'><script type='text/javascript' charset='utf-8' src='js/env.js'></script><script type='text/javascript' charset='utf-8' src='js/ajax.js'></script><script type='text/javascript' charset='utf-8' src='js/app.js'></script><title>Configuration Wizard</title></head><body onload='MqttConfig.init()'><div class='layout-outter'><div class='layout-contents'><div style='width:100%;margin-left:-10px'><div class='step comp'><a href='wifi'>Wifi</a></div><div class='step-arrow comp'>▶</div><div class='step comp'><a href='time'>Time</a></div><div class='step-arrow comp'>▶</div><div class='step curr'>Mqtt</div><div class='step-arrow'>▷</div><div class='step'>Options</div><div class='step-arrow'>▷</div><div class='step'>Finish</div></div><h2>MQTT Connection</h2><div class='form'><span class='label'>Address: </span><input type='text' id='input-mqtt-addr'></div><div class='form'><span class='label'>Port: </span><input type='number' id='input-mqtt-port'></div><div class='form'><span class='label'>ClientID: </span><input type='text' id='input-mqtt-clientid'></div><div class='form'><span class='label'>User: </span><input type='text' id='input-mqtt-user'></div><div class='form'><span class='label'>Password: </span><input type='password' id='input-mqtt-pass'></div><div id='setmqtt-result' class='result'></div><div class='layout-outter' style='margin-top:50px'><button id='btn-commit' style='width:49%'>Submit</button> <button id='btn-next' style='width:49%'>Next</button></div><br><br><br><div class='layout-loading' id='wifi-loading'><div id='text-loading'>Loading...</div></div></div></div></body></html>"
-#define RES_OPTION_HTML "<!DOCTYPE html><html lang='en'><head><meta charset='UTF-8'><meta name='viewport' content='width=device-width,user-scalable=no'><link rel='stylesheet' type='text/css' href='css/main.css'><script type='text/javascript' charset='utf-8' src='js/env.js'></script><script type='text/javascript' charset='utf-8' src='js/ajax.js'></script><script type='text/javascript' charset='utf-8' src='js/app.js'></script><title>Configuration Wizard</title></head><body onload='OptionConfig.init()'><div class='layout-outter'><div class='layout-contents'><div style='width:100%;margin-left:-10px'><div class='step comp'><a href='wifi'>Wifi</a></div><div class='step-arrow comp'>▶</div><div class='step comp'><a href='time'>Time</a></div><div class='step-arrow comp'>▶</div><div class='step comp'><a href='mqtt'>Mqtt</a></div><div class='step-arrow comp'>▶</div><div class='step curr'>Options</div><div class='step-arrow'>▷</div><div class='step'>Finish</div></div><h2>Options</h2><div id='options'></div><div class='result'></div><div class='layout-outter' style='margin-top:50px'><button id='btn-commit' style='width:49%'>Submit</button> <button id='btn-next' style='width:49%'>Next</button></div><br><br><br><div class='layout-loading' id='wifi-loading'><div id='text-loading'>Loading...</div></div></div></div></body></html>"
-#define RES_FINISH_HTML "<!DOCTYPE html><html lang='en'><head><meta charset='UTF-8'><meta name='viewport' content='width=device-width,user-scalable=no'><link rel='stylesheet' type='text/css' href='css/main.css'><title>Configuration Wizard</title></head><body onload='FinishView.init()'><div class='layout-outter'><div class='layout-contents'><div style='width:100%;margin-left:-10px'><div class='step comp'><a href='wifi'>Wifi</a></div><div class='step-arrow comp'>▶</div><div class='step comp'><a href='time'>Time</a></div><div class='step-arrow comp'>▶</div><div class='step comp'><a href='mqtt'>Mqtt</a></div><div class='step-arrow comp'>▶</div><div class='step comp'><a href='option'>Options</a></div><div class='step-arrow comp'>▶</div><div class='step curr'>Finish</div></div><h2>Configuration Complete</h2><div><div id='config-info'><div class='info-line'><div class='config-name'>.<span class='config-value'>.</span></div></div></div><div id='setmqtt-result' class='result'></div><div class='layout-outter' style='margin-top:50px'><button id='btn-commit' style='width:49%'>OK</button> <button id='btn-next' style='width:49%;display:none'>Next</button></div><div class='layout-loading' id='wifi-loading'><div id='text-loading'>Loading...</div></div></div></div></div></body><script type='text/javascript' charset='utf-8' src='js/env.js'></script><script type='text/javascript' charset='utf-8' src='js/ajax.js'></script><script type='text/javascript' charset='utf-8' src='js/app.js'></script></html>"
-#define RES_MAIN_CSS "html, body { font-family: Dotum, 'droid sans fallback', 'AppleGothic', sans-serif; font-size: 12pt; width: 100%; height: 100%; margin: 0; color: #333; } h2 { margin-left: -10px; font-weight: 900; color: #555; margin-top: 10px; font-size: 30pt; } a { text-decoration: none; color: #fff;} a:visited { text-decoration: none; } a:hover { text-decoration: none; } a:focus { text-decoration: none; } a:hover, a:active { text-decoration: none; } input { border-radius: 5px; border: 1px solid #aaa; height: 24px; width: 143px; padding: 0 8px 0 8px; } select { height: 28px; border-radius: 5px; border: 1px solid #aaa; padding: 0 3px 0 3px; min-width: 160px; } button { border-radius: 5px; border: 1px solid #aaa; background-color: #eee; width: 150px; height: 30px; cursor: pointer; } button:disabled,:hover:disabled { background-color: #f3f3f3; color: #ccc; border: 1px solid #ccc; } button:hover { background-color: #bbb; } .layout-outter { width: 100%; text-align: center; } .layout-contents { width: 100%; max-width: 320px; text-align: left; display: inline-block; margin-top: 10px; } .form { margin: 10px 0 0 0; clear: both; } .label { width: 90px; text-align: right; margin: 5px 5px 0 0; display: inline-block; } .label-option-name { font-size: 10pt; font-weight: bold; display: inline-block; text-align: right; margin: 0px 5px 0 0; } .sig-1 { background: red; } .sig-2 { background: #ffb700; } .sig-3 { background: #1dd900; } .sig-4 { background: #00a2ff; } .sig-0 { background: #cfcfcf; } .layout-loading { position: fixed; left: 0; top: 0; width: 100%; height: 100%; opacity: .5; background: #222 } #text-loading { position: fixed; width: 100%; text-align: center; top: 45%; font-size: 32pt; color: white } .result { margin: 30px 10px 10px 10px; font-weight: bold; } .result.success { color: #33aa00; } .error-msg { color: #ff4411; font-size: 10pt; word-break:break-all; } .result.fail { color: #ff4411; } .wifi-item { height: 35px; width: 100%; border-bottom: 1px #ccc solid; border-right: 1px #ccc solid; border-left: 1px #ccc solid; padding-top: 10px; position: relative; } .wifi-item.top { border-radius: 5px 5px 0 0; border-top: 1px #ccc solid; } .wifi-item.bottom { border-radius: 0 0 5px 5px; } .wifi-item.select { background: #ddd } .wifi-rssi { width: 50px; font-size: 7pt; font-weight: bold; position: relative; display: inline; } .wifi-ssid { font-size: 10pt; display: inline-block; font-weight: bold } .wifi-type { margin-left: 8px; display: inline-block; font-size: 8pt; color: gray } .item-text { position: absolute; left: 45px; } .signal-strength { height: 20px; width: 50px; position: absolute; left: -30px; top: -10px; overflow: hidden; } .signal-strength li { display: inline-block; width: 5px; float: left; height: 100%; margin-right: 1px; } .signal-strength li.pretty-strong { padding-top: 0px; } .signal-strength li.strong { padding-top: 5px; } .signal-strength li.weak { padding-top: 10px; } .signal-strength li.very-weak { padding-top: 15px; } .signal-strength li div { height: 100%; } .step { float: left; padding: 5px 8px 5px 8px; height: 15px; margin: 2px 2px 10px 2px; font-size: 10pt; text-align: center; border-radius: 3px; color: #777; font-weight: bold; background-color: #f0f0f0; cursor: pointer; } .step.comp { text-decoration: underline; color: #fff; /*background-color: #62AEB2;*/ background-color: #4aa8d8; } .step.curr { color: #fff; /*background-color: teal;*/ background-color: #0067a3; } .step-arrow { float: left; font-size: 8pt; margin-top: 10px; color: #aaa; } .step-arrow.comp { color: #72b6d8; font-weight: bold; } .info-line { margin: 0 0 5px 0; } .config-name{ font-weight: bold; font-size: 10pt; display: inline-block; color: #666; } .config-value { display: inline-block; margin: 0 0 0 5px; font-size: 10pt; font-weight: bold; }"
-#define RES_ENV_JS "let DEV_URL = ''"
-#define RES_APP_JS "class p{constructor(){this.eleResult,this.eleBtnNext,this.eleBtnCommit}initCommonEles=()=>{this.eleResult=document.getElementsByClassName(\"result\")[0],this.eleBtnNext=document.getElementById(\"btn-next\"),this.eleBtnCommit=document.getElementById(\"btn-commit\"),this.eleBtnNext.disabled=!0};setCommitButtonClickEvent(t){this.eleBtnCommit.addEventListener(\"click\",e=>{t(e)})}setNextButtonClickEvent(t){this.eleBtnNext.addEventListener(\"click\",e=>{t(e)})}showResult=(e,t)=>{this.eleResult.innerHTML=t,this.eleResult.className=(this.eleResult.className+\"\").replace(/(fail)|(success)/gi,\"\"),this.eleResult.className+=e?\" success\":\" fail\",this.eleBtnNext.disabled=!e};hideLoading(){document.getElementsByClassName(\"layout-loading\")[0].style.display=\"none\"}showLoading(){console.log(document.getElementsByClassName(\"layout-loading\")[0]),this.changeLoadingMessage(\"Loading...\",!1),document.getElementById(\"wifi-loading\"),document.getElementById(\"wifi-loading\").style.display=\"block\"}changeLoadingMessage(e,t){var n=document.getElementById(\"text-loading\");n.style.color=t?\"red\":\"white\",n.innerHTML=`<div>${e}</div>`}showConnectionError(){var e=\"Unable to connect to the selected wifi or check your wifi connection.\";alert(e),this.showResult(!1,e)}}class g{static _retry=0;static MAX_RETRY=3;static scanWifi(t){this._retry=0;let n=[],i;ajax({url:DEV_URL+\"/api/wifi/scan/count\",complete:function(e){i=e.data.count,g._readWifiItem(i,0,n,t)},error:function(e){console.log(e),this._retry>=MAX_RETRY?t(!1,void 0,e):(++this._retry,g.scanWifi(t))}})}static _readWifiItem(i,s,o,a){ajax({url:DEV_URL+\"/api/wifi/scan/item?count=\"+s,complete:function(t){if(i<=++s)a(!0,o);else{let e=!1;for(var n of o)n.ssid==t.data.ssid&&(e=!0);e||o.push(t.data),g._readWifiItem(i,s,o,a)}},error:function(e){console.log(e),this._retry>MAX_RETRY?a(!1,void 0,e):(++this._retry,g.scanWifi(a))}})}static connectWifi(e,t,n){ajax({type:\"POST\",url:DEV_URL+\"/api/wifi/connect\",data:{ssid:e||\"\",password:t||\"\"},complete:function(e){n(e.data.success,e.data,void 0)},error:function(e){console.error(e),n(!1,void 0,e)}})}static getTimeConfig(t){ajax({url:DEV_URL+\"/api/ntp/info\",complete:function(e){t(e.data.success,e.data,void 0)},error:function(e){console.error(e),t(!1,void 0,e)}})}static setTimeConfig(e,t,n,i){ajax({url:DEV_URL+\"/api/ntp/set\",type:\"POST\",data:{ntp:e,interval:t,offset:n},complete:function(e){e=e.data;i(e.success,e)},error:function(e){console.error(e),i(!1,void 0,e)}})}static getMqttConfig(t){ajax({type:\"GET\",url:DEV_URL+\"/api/mqtt/info\",complete:function(e){t(!0,e.data,void 0)},error:function(e){t(!1,void 0,e)}})}static setMqttConfig(e,t,n,i,s,o){ajax({type:\"POST\",data:{url:e,port:t,mid:n,muser:i,mpass:s},url:DEV_URL+\"/api/mqtt/connect\",complete:function(e){o(e.data.success,e.data,void 0)},error:function(e){o(!1,void 0,e)}})}static getOptionList(t){let n=[];ajax({type:\"GET\",url:DEV_URL+\"/api/option/count\",complete:function(e){e=e.data.cnt;0!=e?g._loadOption(e,e,n,t):t(!0,n,void 0)},error:function(e){console.error(e),t(!1,void 0,e)}})}static _loadOption(t,n,i,s){ajax({type:\"GET\",url:DEV_URL+\"/api/option/get\",complete:function(e){i.push(e.data),0<--n?g._loadOption(t,n,i,s):s(!0,i,void 0)},error:function(e){console.error(e),loadOptionCount(s)}})}static updateOption(e,t,n){ajax({type:\"POST\",data:{name:e,value:t},url:DEV_URL+\"/api/option/set\",complete:function(e){e.data.success?n(!0,\"\"):(console.log(e.data.msg),n(!1,e.data.msg))},error:function(e){console.error(e),n(!0,void 0,e)}})}static getDeviceInfo(t){ajax({type:\"GET\",url:DEV_URL+\"/api/info\",complete:function(e){console.log(e.data),t(!0,e.data,void 0)},error:function(e){t(!1,void 0,e)}})}static commit(t){ajax({type:\"GET\",url:DEV_URL+\"/api/commit\",complete:function(e){t(e.data.success,e.data,void 0)},error:function(e){t(!1,void 0,e)}})}}let WifiConfig=new function(){let o=[],a={},s=new p,t=-1,i=60;function l(e){let n=document.getElementsByClassName(\"wifi-item\");for(let e=0,t=n.length-1;e<=t;++e)n.item(e).className=\"wifi-item \"+(e==t?\"bottom\":0==e?\"top\":\"\");let t=e.target;for(;!t.className.includes(\"wifi-item\");)if((t=t.parentNode).className.includes(\"wifi-list\"))return;a=o[t.id.replace(\"wifi-item\",\"\")];let i=document.getElementById(\"wifi-passwd\"),s=document.getElementById(\"wifi-ssid\");s.value=a.ssid,i.value=\"\",\"None\"==a.type||\"Auto\"==a.type?i.disabled=!0:i.disabled=!1,t.className+=\" select\"}function c(){-1<t&&(clearInterval(t),t=-1),s.changeLoadingMessage(\"Loading...\")}this.init=()=>{s.initCommonEles(),s.setCommitButtonClickEvent(()=>{{s.showLoading(),-1<t&&clearInterval(t),i=60,t=setInterval(()=>{s.changeLoadingMessage(`Connecting...  <span style=\"font-size: 15pt\">( ${--i} )</span>`),i<1&&(s.changeLoadingMessage('Connecting...<span style=\"font-size: 15pt\">( pending )</span>'),c())},1090);let n=document.getElementById(\"wifi-ssid\"),e=document.getElementById(\"wifi-passwd\");return void g.connectWifi(n.value,e.value,(e,t)=>{t?(c(),s.hideLoading(),1==e?s.showResult(!0,`Ok. Connected. (${t.ip})`):s.showResult(!1,\"Unable to connect to the selected wifi.\")):setTimeout(()=>{g.getDeviceInfo((e,t)=>{c(),s.hideLoading(),e&&t.ssid==n.value?s.showResult(!0,`Ok. Connected. (${t.ip})`):s.showResult(!1,\"Unable to connect to the selected wifi or check your wifi connection.\")})},3e3)})}}),s.setNextButtonClickEvent(()=>{location.href=\"time\"}),s.showLoading(),o=[],g.scanWifi((e,t)=>{if(e){s.hideLoading(),o=t;{var i=o;let e=document.getElementById(\"wifi-list\"),n=\"\";for(let e=0,t=i.length-1;e<=t;++e)n+=`<div id=\"wifi-item${e}\" class=\"wifi-item ${e==t?\"bottom\":0==e?\"top\":\"\"}\"><div class=\"wifi-rssi\" >`+function(e){e=function(e,t,n,i,s){return Math.round((e-t)*(s-i)/(n-t)+i)}(e=-65<e?-65:e<-95?-95:e,-95,-65,0,4);return`<ul class=\"signal-strength\"><li class=\"very-weak\"><div class=\"${0<e?\"sig-\"+e:\"sig-0\"}\" ></div></li><li class=\"weak\"><div class=\"${1<e?\"sig-\"+e:\"sig-0\"}\" ></div></li><li class=\"strong\"><div class=\"${2<e?\"sig-\"+e:\"sig-0\"}\"></div></li><li class=\"pretty-strong\"><div class=\"${3<e?\"sig-\"+e:\"sig-0\"}\"></div></li></ul>`}(i[e].rssi)+'</div><div class=\"item-text\"><div class=\"wifi-ssid\">'+i[e].ssid+'</div><div class=\"wifi-type\">('+i[e].type+\")</div></div></div>\";e.innerHTML=n;let t=document.getElementsByClassName(\"wifi-item\");for(let e=0;e<t.length;++e)t.item(e).addEventListener(\"click\",l,!1)}}else s.changeLoadingMessage(\"Check your device wifi connection.\",!1)})}},TimeConfig=new function(){let s={},o,a,l,c,t,i,d=new p,u;function n(e){e=e.target.value;t.style=\"manually\"==e?\"display: \":\"display: none\"}function r(){g.getTimeConfig((t,n,i)=>{n?(d.hideLoading(),s=n,console.log(\"--\"),console.log(s.ntp),o.value=s.ntp,a.value=s.interval,(n=s.offset)%3600!=0?(l.value=\"manually\",c.value=n):(l.value=n,c.value=0)):(404==e.status&&d.showConnectionError(),r())})}function m(){u.setSeconds(u.getSeconds()+1);var e=u.getHours(),t=u.getMinutes(),n=u.getSeconds();d.eleResult.innerHTML=`Success - ${e<10?\"0\":\"\"}${e}:${t<10?\"0\":\"\"}${t}:`+(n<10?\"0\":\"\")+n}this.init=()=>{o=document.getElementById(\"input-ntp\"),a=document.getElementById(\"input-interval\"),l=document.getElementById(\"select-utc\"),c=document.getElementById(\"input-manually-utc\"),t=document.getElementById(\"block-timeoffset\"),d.initCommonEles();{let t=\"\";for(let e=-12;e<13;++e)t+=`<option value=\"${60*e*60}\">UTC${0<e?\"+\":0==e?\" \":\"\"}${e}:00</option>`;t+='<option value=\"manually\">manually</option>';let e=l;e.innerHTML=t}l.addEventListener(\"change\",n),d.setCommitButtonClickEvent(()=>{{d.showLoading(),d.eleResult.innerHTML=\"\",i&&clearInterval(i);let e=l.value;return console.log(e),\"manually\"==e&&(e=c.value),\"\"==o.value.trim()&&(o.value=s.ntp),a.value<1&&(a.value=s.interval),(e<-86400||86400<e)&&(e=0,l.value=0,c.value=0,n({target:c})),void g.setTimeConfig(o.value,a.value,e,(e,t,n)=>{console.log(t),1==e&&t?(d.hideLoading(),(u=new Date).setHours(t.h,t.m,t.s),d.showResult(!0,\"\"),m(),i=setInterval(()=>{m()},1e3)):(d.hideLoading(),n&&404==n.status?d.showConnectionError():(d.showResult(!1,\"Fail...<br/>All values ​​are initialized.<br/>please try again.\"),r()))})}}),d.setNextButtonClickEvent(()=>{location.href=\"mqtt\"}),r()}},MqttConfig=new function(){let o,a,l,c,d,u=new p;this.init=()=>{o=document.getElementById(\"input-mqtt-addr\"),a=document.getElementById(\"input-mqtt-port\"),l=document.getElementById(\"input-mqtt-clientid\"),c=document.getElementById(\"input-mqtt-user\"),d=document.getElementById(\"input-mqtt-pass\"),u.initCommonEles(),function s(){u.showLoading();g.getMqttConfig((t,n,i)=>{t?(o.value=n.url,a.value=n.port+\"\",l.value=n.mid,c.value=n.muser+\"\",d.value=n.mpass+\"\",u.hideLoading()):(i&&404==e.status&&u.showConnectionError(),s())})}(),u.setCommitButtonClickEvent(()=>{null!==o.value&&\"\"!==o.value?null===a.value||65353<a.value||a.value<1?u.showResult(!1,\"Invalid port number.\"):null!==l.value&&\"\"!=l.value?(u.showLoading(),g.setMqttConfig(o.value,a.value,l.value,c.value,d.value,(e,t,n)=>{!0===e?u.showResult(!0,\"Ok. Connected.\"):n?(u.showConnectionError(),u.hideLoading()):u.showResult(!1,\"Can not connect to MQTT server.\"),u.hideLoading()})):u.showResult(!1,\"ClientID is empty\"):u.showResult(!1,\"Address is empty\")}),u.setNextButtonClickEvent(()=>{location.href=\"option\"})}},OptionConfig=new function(){let c,d=[],o=-1,a=!0,u=new p;function r(t){for(let e=0;e<d.length;++e)if(d[e].name==t&&d[e].isNull)return 1}this.init=()=>{c=document.getElementById(\"options\"),u.initCommonEles(),u.showLoading(),g.getOptionList((e,t,n)=>{if(1==e){if(0!=(d=t).length){let t=\"\";for(let e=0;e<d.length;++e){var a=d[e];t=t+`<div class='form'><span class='label-option-name'>${a.name}${r(a.name)?\"\":\"*\"}: </span><input type='text' class='input-option-value' maxlength='32' name='${a.name}' value='${a.value}' /></div>`+\"<div class='error-msg'  ></div>\"}c.innerHTML=t;let n=0,i=document.getElementsByClassName(\"label-option-name\"),s=document.getElementsByClassName(\"input-option-value\"),o=document.getElementsByClassName(\"error-msg\");for(let e=0;e<i.length;++e){var l=i[e];n=Math.max(l.offsetWidth,n)}if(0!=n){210<n&&(n=210);for(let e=0;e<i.length;++e)i[e].style.width=n+\"px\",o[e].style.margin=`2px 0 -3px ${n+5}px`,s[e].style.width=280-n+\"px\",o[e].style.width=300-n+\"px\"}}else u.showResult(!0,\"No options.\"),u.eleResult.style.setProperty(\"color\",\"#ccc\"),u.eleResult.style.setProperty(\"font-size\",\"28pt\"),u.eleResult.style.setProperty(\"margin\",\"100px 10px 100px 10px\",\"important\"),u.eleResult.style.setProperty(\"text-align\",\"center\"),u.eleBtnCommit.disabled=!0;u.hideLoading()}else u.showConnectionError()}),u.setCommitButtonClickEvent(()=>{{u.showLoading(),a=!0,o=d.length;let t=document.getElementsByClassName(\"label-option-name\"),n=document.getElementsByClassName(\"input-option-value\"),i=document.getElementsByClassName(\"error-msg\");for(let e=0;e<n.length;++e)i[e].textContent=\"\",t[e].style.color=\"black\",r(n[e].name)||\"\"!=n[e].value?function(e,t,i,s){g.updateOption(e,t,(e,t,n)=>{try{console.log(t),t&&\"\"!=t?(s.textContent=t||\"Invalid value.\",i.style.color=\"red\",a=!1):e||(console.log(\"쉴패!!\"),console.log(t),console.log(n),n&&404==n.status&&u.showConnectionError(),a=!1),0==--o&&(u.hideLoading(),a?u.showResult(!0,\"Options applied.\"):u.showResult(!1,\"Invalid option value.\"))}catch(e){console.error(e)}})}(n[e].name,n[e].value,t[e],i[e]):(i[e].textContent=\"Empty values ​​are not allowed.\",t[e].style.color=\"red\",--o,a=!1);return}}),u.setNextButtonClickEvent(()=>{location.href=\"finish\"})}},FinishView=new function(){let e,n=\"\",i=new p;function s(e){return e<10?\"0\"+e:e}function o(){console.log(e),e.innerHTML=n}this.init=()=>{n=\"\",e=document.getElementById(\"config-info\"),i.initCommonEles(),i.showLoading(),i.setCommitButtonClickEvent(()=>{i.showLoading(),g.commit(e=>{i.hideLoading(),e?(alert(\"Configuration complete. Restart your device.\"),location.href=\"about:blank\"):alert(\"Error. Failed to save configuration values.\")})}),g.getDeviceInfo((e,t)=>{console.log(t),n=(n=(n=(n+=`<div class='info-line'><span class=\"config-name\">Device name :</span><span class=\"config-value\">${t.device}</span></div>`)+`<div class='info-line'><span class=\"config-name\">Version :</span><span class=\"config-value\">${t.version}</span></div>`+\"<br/>\")+`<div class='info-line'><span class=\"config-name\">SSID :</span><span class=\"config-value\">${t.ssid}</span></div>`)+`<div class='info-line'><span class=\"config-name\">IP :</span><span class=\"config-value\">${t.ip}</span></div>`+\"<br/>\",o(),g.getTimeConfig((e,t)=>{console.log(t),n=(n=(n+=`<div class='info-line'><span class=\"config-name\">Device name :</span><span class=\"config-value\">${t.ntp}</span></div>`)+`<div class='info-line'><span class=\"config-name\">Version :</span><span class=\"config-value\">${t.interval} min</span></div>`)+`<div class='info-line'><span class=\"config-name\">Time zone :</span><span class=\"config-value\">UTC${0<t.offset?\"+\":t.offset<0?\"-\":\" \"}${s(Math.abs(t.offset)/3600)}:${s(Math.abs(t.offset)%3600)}</span></div>`+\"<br/>\",g.getMqttConfig((e,t)=>{console.log(t),n=(n=(n+=`<div class='info-line'><span class=\"config-name\">Address :</span><span class=\"config-value\">${t.url}</span></div>`)+`<div class='info-line'><span class=\"config-name\">Port :</span><span class=\"config-value\">${t.port}</span></div>`)+`<div class='info-line'><span class=\"config-name\">Client ID :</span><span class=\"config-value\">${t.mid}</span></div>`,\"\"!=t.muser&&(n+=`<div class='info-line'><span class=\"config-name\">User :</span><span class=\"config-value\">${t.muser}</span></div>`),\"\"!=t.mpass&&(n+=`<div class='info-line'><span class=\"config-name\">Password :</span><span class=\"config-value\">${t.mpass}</span></div>`),n+=\"<br/>\",g.getOptionList((e,t)=>{console.log(t);for(let e=0;e<t.length;++e)console.log(t[e]),n+=`<div class='info-line'><span class=\"config-name\">${t[e].name} :</span><span class=\"config-value\">${t[e].value}</span></div>`;o(),i.hideLoading()})})})})}};"
-#define RES_AJAX_JS "function createXHR(){var a;if(window.ActiveXObject){a=new ActiveXObject(\"Microsoft.XMLHTTP\")}else{a=new XMLHttpRequest()}return a}function serialize(b){var c=[];for(var a in b){if(b.hasOwnProperty(a)){c.push(encodeURIComponent(a)+\"=\"+encodeURIComponent(b[a]))}}return c.join(\"&\")}function ajax(d){try{var a=createXHR();d.type=d.type===\"POST\"?\"POST\":d.type===\"PUT\"?\"PUT\":d.type===\"DELETE\"?\"DELETE\":\"GET\";var b=null;if(d.data!==undefined&&d.data!==null){b=serialize(d.data);if(d.type!==\"POST\"&&d.type!==\"PUT\"){d.url+=\"?\"+b}}a.onreadystatechange=function(){if(this.readyState===4){if(this.status/100===2&&d.complete!==undefined&&d.complete!==null){try{d.complete({status:a.status,data:JSON.parse(a.responseText)})}catch(f){d.complete({status:a.status,data:a.responseText})}}else{if(d.error!==undefined&&d.error!==null){try{d.error({status:a.status,data:JSON.parse(a.responseText)})}catch(f){d.error({status:a.status,data:a.responseText})}}}}};a.open(d.type,d.url,true);a.setRequestHeader(\"Content-type\",\"application/x-www-form-urlencoded\");if(d.type!==\"POST\"){a.send()}else{console.log(b);if(b!==null){a.send(b)}else{a.send()}}}catch(c){if(d.error!==undefined&&d.error!==null){d.error({status:-1,data:c})}}};"
+// .res/build.js 로 생성된 파일. 직접 수정하지 말 것.
+#pragma once
+
+#include "WebResource.hpp"
+
+#ifndef WIZARD_RESOURCE_GZIP_ONLY
+#define RES_INDEX_HTML_LEN 31135
+static const uint8_t RES_INDEX_HTML[] PROGMEM = {
+0x3c,0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x68,0x74,0x6d,0x6c,0x3e,0x3c,
+0x68,0x74,0x6d,0x6c,0x20,0x6c,0x61,0x6e,0x67,0x3d,0x27,0x65,0x6e,0x27,0x3e,0x3c,
+0x68,0x65,0x61,0x64,0x3e,0x3c,0x6d,0x65,0x74,0x61,0x20,0x63,0x68,0x61,0x72,0x73,
+0x65,0x74,0x3d,0x27,0x55,0x54,0x46,0x2d,0x38,0x27,0x3e,0x3c,0x74,0x69,0x74,0x6c,
+0x65,0x3e,0x43,0x6f,0x6e,0x66,0x69,0x67,0x75,0x72,0x61,0x74,0x69,0x6f,0x6e,0x20,
+0x57,0x69,0x7a,0x61,0x72,0x64,0x3c,0x2f,0x74,0x69,0x74,0x6c,0x65,0x3e,0x3c,0x6d,
+0x65,0x74,0x61,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x76,0x69,0x65,0x77,0x70,0x6f,
+0x72,0x74,0x27,0x20,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x3d,0x27,0x77,0x69,0x64,
+0x74,0x68,0x3d,0x64,0x65,0x76,0x69,0x63,0x65,0x2d,0x77,0x69,0x64,0x74,0x68,0x2c,
+0x20,0x75,0x73,0x65,0x72,0x2d,0x73,0x63,0x61,0x6c,0x61,0x62,0x6c,0x65,0x3d,0x6e,
+0x6f,0x27,0x3e,0x3c,0x73,0x74,0x79,0x6c,0x65,0x3e,0x68,0x74,0x6d,0x6c,0x2c,0x62,
+0x6f,0x64,0x79,0x7b,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,
+0x44,0x6f,0x74,0x75,0x6d,0x2c,0x27,0x64,0x72,0x6f,0x69,0x64,0x20,0x73,0x61,0x6e,
+0x73,0x20,0x66,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x27,0x2c,0x27,0x41,0x70,0x70,
+0x6c,0x65,0x47,0x6f,0x74,0x68,0x69,0x63,0x27,0x2c,0x73,0x61,0x6e,0x73,0x2d,0x73,
+0x65,0x72,0x69,0x66,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,
+0x32,0x70,0x74,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x30,0x30,0x25,0x3b,0x68,
+0x65,0x69,0x67,0x68,0x74,0x3a,0x31,0x30,0x30,0x25,0x3b,0x6d,0x61,0x72,0x67,0x69,
+0x6e,0x3a,0x30,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x33,0x33,0x33,0x7d,0x68,
+0x32,0x7b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x2d,0x31,
+0x30,0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,
+0x39,0x30,0x30,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x35,0x35,0x35,0x3b,0x6d,
+0x61,0x72,0x67,0x69,0x6e,0x2d,0x74,0x6f,0x70,0x3a,0x31,0x30,0x70,0x78,0x3b,0x66,
+0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x33,0x30,0x70,0x74,0x7d,0x61,0x7b,
+0x74,0x65,0x78,0x74,0x2d,0x64,0x65,0x63,0x6f,0x72,0x61,0x74,0x69,0x6f,0x6e,0x3a,
+0x6e,0x6f,0x6e,0x65,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x66,0x66,0x7d,
+0x61,0x3a,0x76,0x69,0x73,0x69,0x74,0x65,0x64,0x7b,0x74,0x65,0x78,0x74,0x2d,0x64,
+0x65,0x63,0x6f,0x72,0x61,0x74,0x69,0x6f,0x6e,0x3a,0x6e,0x6f,0x6e,0x65,0x7d,0x61,
+0x3a,0x68,0x6f,0x76,0x65,0x72,0x7b,0x74,0x65,0x78,0x74,0x2d,0x64,0x65,0x63,0x6f,
+0x72,0x61,0x74,0x69,0x6f,0x6e,0x3a,0x6e,0x6f,0x6e,0x65,0x7d,0x61,0x3a,0x66,0x6f,
+0x63,0x75,0x73,0x7b,0x74,0x65,0x78,0x74,0x2d,0x64,0x65,0x63,0x6f,0x72,0x61,0x74,
+0x69,0x6f,0x6e,0x3a,0x6e,0x6f,0x6e,0x65,0x7d,0x61,0x3a,0x68,0x6f,0x76,0x65,0x72,
+0x2c,0x61,0x3a,0x61,0x63,0x74,0x69,0x76,0x65,0x7b,0x74,0x65,0x78,0x74,0x2d,0x64,
+0x65,0x63,0x6f,0x72,0x61,0x74,0x69,0x6f,0x6e,0x3a,0x6e,0x6f,0x6e,0x65,0x7d,0x69,
+0x6e,0x70,0x75,0x74,0x7b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,
+0x75,0x73,0x3a,0x35,0x70,0x78,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x31,0x70,
+0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x23,0x61,0x61,0x61,0x3b,0x68,0x65,0x69,
+0x67,0x68,0x74,0x3a,0x32,0x34,0x70,0x78,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,
+0x34,0x33,0x70,0x78,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x30,0x20,0x38,
+0x70,0x78,0x20,0x30,0x20,0x38,0x70,0x78,0x7d,0x73,0x65,0x6c,0x65,0x63,0x74,0x7b,
+0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x32,0x38,0x70,0x78,0x3b,0x62,0x6f,0x72,0x64,
+0x65,0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x35,0x70,0x78,0x3b,0x62,0x6f,
+0x72,0x64,0x65,0x72,0x3a,0x31,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x23,
+0x61,0x61,0x61,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x30,0x20,0x33,0x70,
+0x78,0x20,0x30,0x20,0x33,0x70,0x78,0x3b,0x6d,0x69,0x6e,0x2d,0x77,0x69,0x64,0x74,
+0x68,0x3a,0x31,0x36,0x30,0x70,0x78,0x7d,0x62,0x75,0x74,0x74,0x6f,0x6e,0x7b,0x62,
+0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x35,0x70,0x78,
+0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x31,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,
+0x64,0x20,0x23,0x61,0x61,0x61,0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,
+0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x65,0x65,0x65,0x3b,0x77,0x69,0x64,
+0x74,0x68,0x3a,0x31,0x35,0x30,0x70,0x78,0x3b,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,
+0x33,0x30,0x70,0x78,0x3b,0x63,0x75,0x72,0x73,0x6f,0x72,0x3a,0x70,0x6f,0x69,0x6e,
+0x74,0x65,0x72,0x7d,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3a,0x64,0x69,0x73,0x61,0x62,
+0x6c,0x65,0x64,0x2c,0x3a,0x68,0x6f,0x76,0x65,0x72,0x3a,0x64,0x69,0x73,0x61,0x62,
+0x6c,0x65,0x64,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,
+0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x33,0x66,0x33,0x66,0x33,0x3b,0x63,0x6f,0x6c,
+0x6f,0x72,0x3a,0x23,0x63,0x63,0x63,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x31,
+0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x23,0x63,0x63,0x63,0x7d,0x62,0x75,
+0x74,0x74,0x6f,0x6e,0x3a,0x68,0x6f,0x76,0x65,0x72,0x7b,0x62,0x61,0x63,0x6b,0x67,
+0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x62,0x62,0x62,
+0x7d,0x2e,0x6c,0x61,0x79,0x6f,0x75,0x74,0x2d,0x6f,0x75,0x74,0x74,0x65,0x72,0x7b,
+0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x30,0x30,0x25,0x3b,0x74,0x65,0x78,0x74,0x2d,
+0x61,0x6c,0x69,0x67,0x6e,0x3a,0x63,0x65,0x6e,0x74,0x65,0x72,0x7d,0x2e,0x6c,0x61,
+0x79,0x6f,0x75,0x74,0x2d,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x73,0x7b,0x77,0x69,
+0x64,0x74,0x68,0x3a,0x31,0x30,0x30,0x25,0x3b,0x6d,0x61,0x78,0x2d,0x77,0x69,0x64,
+0x74,0x68,0x3a,0x33,0x32,0x30,0x70,0x78,0x3b,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,
+0x69,0x67,0x6e,0x3a,0x6c,0x65,0x66,0x74,0x3b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,
+0x3a,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x2d,0x62,0x6c,0x6f,0x63,0x6b,0x3b,0x6d,0x61,
+0x72,0x67,0x69,0x6e,0x2d,0x74,0x6f,0x70,0x3a,0x31,0x30,0x70,0x78,0x7d,0x2e,0x66,
+0x6f,0x72,0x6d,0x7b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x31,0x30,0x70,0x78,0x20,
+0x30,0x20,0x30,0x20,0x30,0x3b,0x63,0x6c,0x65,0x61,0x72,0x3a,0x62,0x6f,0x74,0x68,
+0x7d,0x2e,0x6c,0x61,0x62,0x65,0x6c,0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,0x39,0x30,
+0x70,0x78,0x3b,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x72,0x69,
+0x67,0x68,0x74,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x35,0x70,0x78,0x20,0x35,
+0x70,0x78,0x20,0x30,0x20,0x30,0x3b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x69,
+0x6e,0x6c,0x69,0x6e,0x65,0x2d,0x62,0x6c,0x6f,0x63,0x6b,0x7d,0x2e,0x6c,0x61,0x62,
+0x65,0x6c,0x2d,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x2d,0x6e,0x61,0x6d,0x65,0x7b,0x66,
+0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x30,0x70,0x74,0x3b,0x66,0x6f,
+0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,0x62,0x6f,0x6c,0x64,0x3b,0x64,
+0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x2d,0x62,0x6c,
+0x6f,0x63,0x6b,0x3b,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x72,
+0x69,0x67,0x68,0x74,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x30,0x70,0x78,0x20,
+0x35,0x70,0x78,0x20,0x30,0x20,0x30,0x7d,0x2e,0x73,0x69,0x67,0x2d,0x31,0x7b,0x62,
+0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x72,0x65,0x64,0x7d,0x2e,0x73,
+0x69,0x67,0x2d,0x32,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,
+0x23,0x66,0x66,0x62,0x37,0x30,0x30,0x7d,0x2e,0x73,0x69,0x67,0x2d,0x33,0x7b,0x62,
+0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x23,0x31,0x64,0x64,0x39,0x30,
+0x30,0x7d,0x2e,0x73,0x69,0x67,0x2d,0x34,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,
+0x75,0x6e,0x64,0x3a,0x23,0x30,0x30,0x61,0x32,0x66,0x66,0x7d,0x2e,0x73,0x69,0x67,
+0x2d,0x30,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x23,0x63,
+0x66,0x63,0x66,0x63,0x66,0x7d,0x2e,0x6c,0x61,0x79,0x6f,0x75,0x74,0x2d,0x6c,0x6f,
+0x61,0x64,0x69,0x6e,0x67,0x7b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x66,
+0x69,0x78,0x65,0x64,0x3b,0x6c,0x65,0x66,0x74,0x3a,0x30,0x3b,0x74,0x6f,0x70,0x3a,
+0x30,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x30,0x30,0x25,0x3b,0x68,0x65,0x69,
+0x67,0x68,0x74,0x3a,0x31,0x30,0x30,0x25,0x3b,0x6f,0x70,0x61,0x63,0x69,0x74,0x79,
+0x3a,0x2e,0x35,0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x23,
+0x32,0x32,0x32,0x7d,0x23,0x74,0x65,0x78,0x74,0x2d,0x6c,0x6f,0x61,0x64,0x69,0x6e,
+0x67,0x7b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x66,0x69,0x78,0x65,0x64,
+0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x30,0x30,0x25,0x3b,0x74,0x65,0x78,0x74,
+0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x63,0x65,0x6e,0x74,0x65,0x72,0x3b,0x74,0x6f,
+0x70,0x3a,0x34,0x35,0x25,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,
+0x33,0x32,0x70,0x74,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x77,0x68,0x69,0x74,0x65,
+0x7d,0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x7b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,
+0x33,0x30,0x70,0x78,0x20,0x31,0x30,0x70,0x78,0x20,0x31,0x30,0x70,0x78,0x20,0x31,
+0x30,0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,
+0x62,0x6f,0x6c,0x64,0x7d,0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x2e,0x73,0x75,0x63,
+0x63,0x65,0x73,0x73,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x33,0x33,0x61,0x61,
+0x30,0x30,0x7d,0x2e,0x65,0x72,0x72,0x6f,0x72,0x2d,0x6d,0x73,0x67,0x7b,0x63,0x6f,
+0x6c,0x6f,0x72,0x3a,0x23,0x66,0x66,0x34,0x34,0x31,0x31,0x3b,0x66,0x6f,0x6e,0x74,
+0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x30,0x70,0x74,0x3b,0x77,0x6f,0x72,0x64,0x2d,
+0x62,0x72,0x65,0x61,0x6b,0x3a,0x62,0x72,0x65,0x61,0x6b,0x2d,0x61,0x6c,0x6c,0x7d,
+0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x2e,0x66,0x61,0x69,0x6c,0x7b,0x63,0x6f,0x6c,
+0x6f,0x72,0x3a,0x23,0x66,0x66,0x34,0x34,0x31,0x31,0x7d,0x2e,0x77,0x69,0x66,0x69,
+0x2d,0x69,0x74,0x65,0x6d,0x7b,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x33,0x35,0x70,
+0x78,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x30,0x30,0x25,0x3b,0x62,0x6f,0x72,
+0x64,0x65,0x72,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x31,0x70,0x78,0x20,0x23,
+0x63,0x63,0x63,0x20,0x73,0x6f,0x6c,0x69,0x64,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,
+0x2d,0x72,0x69,0x67,0x68,0x74,0x3a,0x31,0x70,0x78,0x20,0x23,0x63,0x63,0x63,0x20,
+0x73,0x6f,0x6c,0x69,0x64,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x6c,0x65,0x66,
+0x74,0x3a,0x31,0x70,0x78,0x20,0x23,0x63,0x63,0x63,0x20,0x73,0x6f,0x6c,0x69,0x64,
+0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,0x74,0x6f,0x70,0x3a,0x31,0x30,0x70,
+0x78,0x3b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x72,0x65,0x6c,0x61,0x74,
+0x69,0x76,0x65,0x7d,0x2e,0x77,0x69,0x66,0x69,0x2d,0x69,0x74,0x65,0x6d,0x2e,0x74,
+0x6f,0x70,0x7b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,
+0x3a,0x35,0x70,0x78,0x20,0x35,0x70,0x78,0x20,0x30,0x20,0x30,0x3b,0x62,0x6f,0x72,
+0x64,0x65,0x72,0x2d,0x74,0x6f,0x70,0x3a,0x31,0x70,0x78,0x20,0x23,0x63,0x63,0x63,
+0x20,0x73,0x6f,0x6c,0x69,0x64,0x7d,0x2e,0x77,0x69,0x66,0x69,0x2d,0x69,0x74,0x65,
+0x6d,0x2e,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x7b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,
+0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x30,0x20,0x30,0x20,0x35,0x70,0x78,0x20,0x35,
+0x70,0x78,0x7d,0x2e,0x77,0x69,0x66,0x69,0x2d,0x69,0x74,0x65,0x6d,0x2e,0x73,0x65,
+0x6c,0x65,0x63,0x74,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,
+0x23,0x64,0x64,0x64,0x7d,0x2e,0x77,0x69,0x66,0x69,0x2d,0x72,0x73,0x73,0x69,0x7b,
+0x77,0x69,0x64,0x74,0x68,0x3a,0x35,0x30,0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,0x2d,
+0x73,0x69,0x7a,0x65,0x3a,0x37,0x70,0x74,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,
+0x69,0x67,0x68,0x74,0x3a,0x62,0x6f,0x6c,0x64,0x3b,0x70,0x6f,0x73,0x69,0x74,0x69,
+0x6f,0x6e,0x3a,0x72,0x65,0x6c,0x61,0x74,0x69,0x76,0x65,0x3b,0x64,0x69,0x73,0x70,
+0x6c,0x61,0x79,0x3a,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x7d,0x2e,0x77,0x69,0x66,0x69,
+0x2d,0x73,0x73,0x69,0x64,0x7b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,
+0x31,0x30,0x70,0x74,0x3b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x69,0x6e,0x6c,
+0x69,0x6e,0x65,0x2d,0x62,0x6c,0x6f,0x63,0x6b,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x77,
+0x65,0x69,0x67,0x68,0x74,0x3a,0x62,0x6f,0x6c,0x64,0x7d,0x2e,0x77,0x69,0x66,0x69,
+0x2d,0x74,0x79,0x70,0x65,0x7b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x6c,0x65,0x66,
+0x74,0x3a,0x38,0x70,0x78,0x3b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x69,0x6e,
+0x6c,0x69,0x6e,0x65,0x2d,0x62,0x6c,0x6f,0x63,0x6b,0x3b,0x66,0x6f,0x6e,0x74,0x2d,
+0x73,0x69,0x7a,0x65,0x3a,0x38,0x70,0x74,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x67,
+0x72,0x61,0x79,0x7d,0x2e,0x69,0x74,0x65,0x6d,0x2d,0x74,0x65,0x78,0x74,0x7b,0x70,
+0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x61,0x62,0x73,0x6f,0x6c,0x75,0x74,0x65,
+0x3b,0x6c,0x65,0x66,0x74,0x3a,0x34,0x35,0x70,0x78,0x7d,0x2e,0x73,0x69,0x67,0x6e,
+0x61,0x6c,0x2d,0x73,0x74,0x72,0x65,0x6e,0x67,0x74,0x68,0x7b,0x68,0x65,0x69,0x67,
+0x68,0x74,0x3a,0x32,0x30,0x70,0x78,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x35,0x30,
+0x70,0x78,0x3b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x61,0x62,0x73,0x6f,
+0x6c,0x75,0x74,0x65,0x3b,0x6c,0x65,0x66,0x74,0x3a,0x2d,0x33,0x30,0x70,0x78,0x3b,
+0x74,0x6f,0x70,0x3a,0x2d,0x31,0x30,0x70,0x78,0x3b,0x6f,0x76,0x65,0x72,0x66,0x6c,
+0x6f,0x77,0x3a,0x68,0x69,0x64,0x64,0x65,0x6e,0x7d,0x2e,0x73,0x69,0x67,0x6e,0x61,
+0x6c,0x2d,0x73,0x74,0x72,0x65,0x6e,0x67,0x74,0x68,0x20,0x6c,0x69,0x7b,0x64,0x69,
+0x73,0x70,0x6c,0x61,0x79,0x3a,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x2d,0x62,0x6c,0x6f,
+0x63,0x6b,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x35,0x70,0x78,0x3b,0x66,0x6c,0x6f,
+0x61,0x74,0x3a,0x6c,0x65,0x66,0x74,0x3b,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x31,
+0x30,0x30,0x25,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x72,0x69,0x67,0x68,0x74,
+0x3a,0x31,0x70,0x78,0x7d,0x2e,0x73,0x69,0x67,0x6e,0x61,0x6c,0x2d,0x73,0x74,0x72,
+0x65,0x6e,0x67,0x74,0x68,0x20,0x6c,0x69,0x2e,0x70,0x72,0x65,0x74,0x74,0x79,0x2d,
+0x73,0x74,0x72,0x6f,0x6e,0x67,0x7b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,0x74,
+0x6f,0x70,0x3a,0x30,0x70,0x78,0x7d,0x2e,0x73,0x69,0x67,0x6e,0x61,0x6c,0x2d,0x73,
+0x74,0x72,0x65,0x6e,0x67,0x74,0x68,0x20,0x6c,0x69,0x2e,0x73,0x74,0x72,0x6f,0x6e,
+0x67,0x7b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,0x74,0x6f,0x70,0x3a,0x35,0x70,
+0x78,0x7d,0x2e,0x73,0x69,0x67,0x6e,0x61,0x6c,0x2d,0x73,0x74,0x72,0x65,0x6e,0x67,
+0x74,0x68,0x20,0x6c,0x69,0x2e,0x77,0x65,0x61,0x6b,0x7b,0x70,0x61,0x64,0x64,0x69,
+0x6e,0x67,0x2d,0x74,0x6f,0x70,0x3a,0x31,0x30,0x70,0x78,0x7d,0x2e,0x73,0x69,0x67,
+0x6e,0x61,0x6c,0x2d,0x73,0x74,0x72,0x65,0x6e,0x67,0x74,0x68,0x20,0x6c,0x69,0x2e,
+0x76,0x65,0x72,0x79,0x2d,0x77,0x65,0x61,0x6b,0x7b,0x70,0x61,0x64,0x64,0x69,0x6e,
+0x67,0x2d,0x74,0x6f,0x70,0x3a,0x31,0x35,0x70,0x78,0x7d,0x2e,0x73,0x69,0x67,0x6e,
+0x61,0x6c,0x2d,0x73,0x74,0x72,0x65,0x6e,0x67,0x74,0x68,0x20,0x6c,0x69,0x20,0x64,
+0x69,0x76,0x7b,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x31,0x30,0x30,0x25,0x7d,0x2e,
+0x73,0x74,0x65,0x70,0x7b,0x66,0x6c,0x6f,0x61,0x74,0x3a,0x6c,0x65,0x66,0x74,0x3b,
+0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x35,0x70,0x78,0x20,0x38,0x70,0x78,0x20,
+0x35,0x70,0x78,0x20,0x38,0x70,0x78,0x3b,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x31,
+0x35,0x70,0x78,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x32,0x70,0x78,0x20,0x32,
+0x70,0x78,0x20,0x31,0x30,0x70,0x78,0x20,0x32,0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,
+0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x30,0x70,0x74,0x3b,0x74,0x65,0x78,0x74,0x2d,
+0x61,0x6c,0x69,0x67,0x6e,0x3a,0x63,0x65,0x6e,0x74,0x65,0x72,0x3b,0x62,0x6f,0x72,
+0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x33,0x70,0x78,0x3b,0x63,
+0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x37,0x37,0x37,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x77,
+0x65,0x69,0x67,0x68,0x74,0x3a,0x62,0x6f,0x6c,0x64,0x3b,0x62,0x61,0x63,0x6b,0x67,
+0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x30,0x66,
+0x30,0x66,0x30,0x3b,0x63,0x75,0x72,0x73,0x6f,0x72,0x3a,0x70,0x6f,0x69,0x6e,0x74,
+0x65,0x72,0x7d,0x2e,0x73,0x74,0x65,0x70,0x2e,0x63,0x6f,0x6d,0x70,0x7b,0x74,0x65,
+0x78,0x74,0x2d,0x64,0x65,0x63,0x6f,0x72,0x61,0x74,0x69,0x6f,0x6e,0x3a,0x75,0x6e,
+0x64,0x65,0x72,0x6c,0x69,0x6e,0x65,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,
+0x66,0x66,0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,
+0x6c,0x6f,0x72,0x3a,0x23,0x34,0x61,0x61,0x38,0x64,0x38,0x7d,0x2e,0x73,0x74,0x65,
+0x70,0x2e,0x63,0x75,0x72,0x72,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x66,
+0x66,0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,
+0x6f,0x72,0x3a,0x23,0x30,0x30,0x36,0x37,0x61,0x33,0x7d,0x2e,0x73,0x74,0x65,0x70,
+0x2d,0x61,0x72,0x72,0x6f,0x77,0x7b,0x66,0x6c,0x6f,0x61,0x74,0x3a,0x6c,0x65,0x66,
+0x74,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x38,0x70,0x74,0x3b,
+0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x74,0x6f,0x70,0x3a,0x31,0x30,0x70,0x78,0x3b,
+0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x61,0x61,0x61,0x7d,0x2e,0x73,0x74,0x65,0x70,
+0x2d,0x61,0x72,0x72,0x6f,0x77,0x2e,0x63,0x6f,0x6d,0x70,0x7b,0x63,0x6f,0x6c,0x6f,
+0x72,0x3a,0x23,0x37,0x32,0x62,0x36,0x64,0x38,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x77,
+0x65,0x69,0x67,0x68,0x74,0x3a,0x62,0x6f,0x6c,0x64,0x7d,0x2e,0x69,0x6e,0x66,0x6f,
+0x2d,0x6c,0x69,0x6e,0x65,0x7b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x30,0x20,0x30,
+0x20,0x35,0x70,0x78,0x20,0x30,0x7d,0x2e,0x63,0x6f,0x6e,0x66,0x69,0x67,0x2d,0x6e,
+0x61,0x6d,0x65,0x7b,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,
+0x62,0x6f,0x6c,0x64,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,
+0x30,0x70,0x74,0x3b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x69,0x6e,0x6c,0x69,
+0x6e,0x65,0x2d,0x62,0x6c,0x6f,0x63,0x6b,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,
+0x36,0x36,0x36,0x7d,0x2e,0x63,0x6f,0x6e,0x66,0x69,0x67,0x2d,0x76,0x61,0x6c,0x75,
+0x65,0x7b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+0x2d,0x62,0x6c,0x6f,0x63,0x6b,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x30,0x20,
+0x30,0x20,0x30,0x20,0x35,0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,
+0x65,0x3a,0x31,0x30,0x70,0x74,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,
+0x68,0x74,0x3a,0x62,0x6f,0x6c,0x64,0x7d,0x3c,0x2f,0x73,0x74,0x79,0x6c,0x65,0x3e,
+0x3c,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x6c,0x65,0x74,0x20,0x44,0x45,0x56,0x5f,
+0x55,0x52,0x4c,0x20,0x3d,0x20,0x27,0x27,0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,
+0x3e,0x3c,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,
+0x6e,0x20,0x63,0x72,0x65,0x61,0x74,0x65,0x58,0x48,0x52,0x28,0x29,0x7b,0x76,0x61,
+0x72,0x20,0x61,0x3b,0x69,0x66,0x28,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x41,0x63,
+0x74,0x69,0x76,0x65,0x58,0x4f,0x62,0x6a,0x65,0x63,0x74,0x29,0x7b,0x61,0x3d,0x6e,
+0x65,0x77,0x20,0x41,0x63,0x74,0x69,0x76,0x65,0x58,0x4f,0x62,0x6a,0x65,0x63,0x74,
+0x28,0x22,0x4d,0x69,0x63,0x72,0x6f,0x73,0x6f,0x66,0x74,0x2e,0x58,0x4d,0x4c,0x48,
+0x54,0x54,0x50,0x22,0x29,0x7d,0x65,0x6c,0x73,0x65,0x7b,0x61,0x3d,0x6e,0x65,0x77,
+0x20,0x58,0x4d,0x4c,0x48,0x74,0x74,0x70,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x28,
+0x29,0x7d,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x61,0x7d,0x66,0x75,0x6e,0x63,0x74,
+0x69,0x6f,0x6e,0x20,0x73,0x65,0x72,0x69,0x61,0x6c,0x69,0x7a,0x65,0x28,0x62,0x29,
+0x7b,0x76,0x61,0x72,0x20,0x63,0x3d,0x5b,0x5d,0x3b,0x66,0x6f,0x72,0x28,0x76,0x61,
+0x72,0x20,0x61,0x20,0x69,0x6e,0x20,0x62,0x29,0x7b,0x69,0x66,0x28,0x62,0x2e,0x68,
+0x61,0x73,0x4f,0x77,0x6e,0x50,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x28,0x61,0x29,
+0x29,0x7b,0x63,0x2e,0x70,0x75,0x73,0x68,0x28,0x65,0x6e,0x63,0x6f,0x64,0x65,0x55,
+0x52,0x49,0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x28,0x61,0x29,0x2b,0x22,
+0x3d,0x22,0x2b,0x65,0x6e,0x63,0x6f,0x64,0x65,0x55,0x52,0x49,0x43,0x6f,0x6d,0x70,
+0x6f,0x6e,0x65,0x6e,0x74,0x28,0x62,0x5b,0x61,0x5d,0x29,0x29,0x7d,0x7d,0x72,0x65,
+0x74,0x75,0x72,0x6e,0x20,0x63,0x2e,0x6a,0x6f,0x69,0x6e,0x28,0x22,0x26,0x22,0x29,
+0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x61,0x6a,0x61,0x78,0x28,0x64,
+0x29,0x7b,0x74,0x72,0x79,0x7b,0x76,0x61,0x72,0x20,0x61,0x3d,0x63,0x72,0x65,0x61,
+0x74,0x65,0x58,0x48,0x52,0x28,0x29,0x3b,0x64,0x2e,0x74,0x79,0x70,0x65,0x3d,0x64,
+0x2e,0x74,0x79,0x70,0x65,0x3d,0x3d,0x3d,0x22,0x50,0x4f,0x53,0x54,0x22,0x3f,0x22,
+0x50,0x4f,0x53,0x54,0x22,0x3a,0x64,0x2e,0x74,0x79,0x70,0x65,0x3d,0x3d,0x3d,0x22,
+0x50,0x55,0x54,0x22,0x3f,0x22,0x50,0x55,0x54,0x22,0x3a,0x64,0x2e,0x74,0x79,0x70,
+0x65,0x3d,0x3d,0x3d,0x22,0x44,0x45,0x4c,0x45,0x54,0x45,0x22,0x3f,0x22,0x44,0x45,
+0x4c,0x45,0x54,0x45,0x22,0x3a,0x22,0x47,0x45,0x54,0x22,0x3b,0x76,0x61,0x72,0x20,
+0x62,0x3d,0x6e,0x75,0x6c,0x6c,0x3b,0x69,0x66,0x28,0x64,0x2e,0x64,0x61,0x74,0x61,
+0x21,0x3d,0x3d,0x75,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x26,0x26,0x64,0x2e,
+0x64,0x61,0x74,0x61,0x21,0x3d,0x3d,0x6e,0x75,0x6c,0x6c,0x29,0x7b,0x62,0x3d,0x73,
+0x65,0x72,0x69,0x61,0x6c,0x69,0x7a,0x65,0x28,0x64,0x2e,0x64,0x61,0x74,0x61,0x29,
+0x3b,0x69,0x66,0x28,0x64,0x2e,0x74,0x79,0x70,0x65,0x21,0x3d,0x3d,0x22,0x50,0x4f,
+0x53,0x54,0x22,0x26,0x26,0x64,0x2e,0x74,0x79,0x70,0x65,0x21,0x3d,0x3d,0x22,0x50,
+0x55,0x54,0x22,0x29,0x7b,0x64,0x2e,0x75,0x72,0x6c,0x2b,0x3d,0x22,0x3f,0x22,0x2b,
+0x62,0x7d,0x7d,0x61,0x2e,0x6f,0x6e,0x72,0x65,0x61,0x64,0x79,0x73,0x74,0x61,0x74,
+0x65,0x63,0x68,0x61,0x6e,0x67,0x65,0x3d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,
+0x28,0x29,0x7b,0x69,0x66,0x28,0x74,0x68,0x69,0x73,0x2e,0x72,0x65,0x61,0x64,0x79,
+0x53,0x74,0x61,0x74,0x65,0x3d,0x3d,0x3d,0x34,0x29,0x7b,0x69,0x66,0x28,0x74,0x68,
+0x69,0x73,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,0x2f,0x31,0x30,0x30,0x3d,0x3d,0x3d,
+0x32,0x26,0x26,0x64,0x2e,0x63,0x6f,0x6d,0x70,0x6c,0x65,0x74,0x65,0x21,0x3d,0x3d,
+0x75,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x26,0x26,0x64,0x2e,0x63,0x6f,0x6d,
+0x70,0x6c,0x65,0x74,0x65,0x21,0x3d,0x3d,0x6e,0x75,0x6c,0x6c,0x29,0x7b,0x74,0x72,
+0x79,0x7b,0x64,0x2e,0x63,0x6f,0x6d,0x70,0x6c,0x65,0x74,0x65,0x28,0x7b,0x73,0x74,
+0x61,0x74,0x75,0x73,0x3a,0x61,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,0x2c,0x64,0x61,
+0x74,0x61,0x3a,0x4a,0x53,0x4f,0x4e,0x2e,0x70,0x61,0x72,0x73,0x65,0x28,0x61,0x2e,
+0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x54,0x65,0x78,0x74,0x29,0x7d,0x29,0x7d,
+0x63,0x61,0x74,0x63,0x68,0x28,0x66,0x29,0x7b,0x64,0x2e,0x63,0x6f,0x6d,0x70,0x6c,
+0x65,0x74,0x65,0x28,0x7b,0x73,0x74,0x61,0x74,0x75,0x73,0x3a,0x61,0x2e,0x73,0x74,
+0x61,0x74,0x75,0x73,0x2c,0x64,0x61,0x74,0x61,0x3a,0x61,0x2e,0x72,0x65,0x73,0x70,
+0x6f,0x6e,0x73,0x65,0x54,0x65,0x78,0x74,0x7d,0x29,0x7d,0x7d,0x65,0x6c,0x73,0x65,
+0x7b,0x69,0x66,0x28,0x64,0x2e,0x65,0x72,0x72,0x6f,0x72,0x21,0x3d,0x3d,0x75,0x6e,
+0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x26,0x26,0x64,0x2e,0x65,0x72,0x72,0x6f,0x72,
+0x21,0x3d,0x3d,0x6e,0x75,0x6c,0x6c,0x29,0x7b,0x74,0x72,0x79,0x7b,0x64,0x2e,0x65,
+0x72,0x72,0x6f,0x72,0x28,0x7b,0x73,0x74,0x61,0x74,0x75,0x73,0x3a,0x61,0x2e,0x73,
+0x74,0x61,0x74,0x75,0x73,0x2c,0x64,0x61,0x74,0x61,0x3a,0x4a,0x53,0x4f,0x4e,0x2e,
+0x70,0x61,0x72,0x73,0x65,0x28,0x61,0x2e,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,
+0x54,0x65,0x78,0x74,0x29,0x7d,0x29,0x7d,0x63,0x61,0x74,0x63,0x68,0x28,0x66,0x29,
+0x7b,0x64,0x2e,0x65,0x72,0x72,0x6f,0x72,0x28,0x7b,0x73,0x74,0x61,0x74,0x75,0x73,
+0x3a,0x61,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,0x2c,0x64,0x61,0x74,0x61,0x3a,0x61,
+0x2e,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x54,0x65,0x78,0x74,0x7d,0x29,0x7d,
+0x7d,0x7d,0x7d,0x7d,0x3b,0x61,0x2e,0x6f,0x70,0x65,0x6e,0x28,0x64,0x2e,0x74,0x79,
+0x70,0x65,0x2c,0x64,0x2e,0x75,0x72,0x6c,0x2c,0x74,0x72,0x75,0x65,0x29,0x3b,0x69,
+0x66,0x28,0x64,0x2e,0x74,0x69,0x6d,0x65,0x6f,0x75,0x74,0x29,0x7b,0x61,0x2e,0x74,
+0x69,0x6d,0x65,0x6f,0x75,0x74,0x3d,0x64,0x2e,0x74,0x69,0x6d,0x65,0x6f,0x75,0x74,
+0x7d,0x61,0x2e,0x73,0x65,0x74,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x48,0x65,0x61,
+0x64,0x65,0x72,0x28,0x22,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x74,0x79,0x70,
+0x65,0x22,0x2c,0x22,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2f,
+0x78,0x2d,0x77,0x77,0x77,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x75,0x72,0x6c,0x65,0x6e,
+0x63,0x6f,0x64,0x65,0x64,0x22,0x29,0x3b,0x69,0x66,0x28,0x64,0x2e,0x74,0x79,0x70,
+0x65,0x21,0x3d,0x3d,0x22,0x50,0x4f,0x53,0x54,0x22,0x29,0x7b,0x61,0x2e,0x73,0x65,
+0x6e,0x64,0x28,0x29,0x7d,0x65,0x6c,0x73,0x65,0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,
+0x65,0x2e,0x6c,0x6f,0x67,0x28,0x62,0x29,0x3b,0x69,0x66,0x28,0x62,0x21,0x3d,0x3d,
+0x6e,0x75,0x6c,0x6c,0x29,0x7b,0x61,0x2e,0x73,0x65,0x6e,0x64,0x28,0x62,0x29,0x7d,
+0x65,0x6c,0x73,0x65,0x7b,0x61,0x2e,0x73,0x65,0x6e,0x64,0x28,0x29,0x7d,0x7d,0x7d,
+0x63,0x61,0x74,0x63,0x68,0x28,0x63,0x29,0x7b,0x69,0x66,0x28,0x64,0x2e,0x65,0x72,
+0x72,0x6f,0x72,0x21,0x3d,0x3d,0x75,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x26,
+0x26,0x64,0x2e,0x65,0x72,0x72,0x6f,0x72,0x21,0x3d,0x3d,0x6e,0x75,0x6c,0x6c,0x29,
+0x7b,0x64,0x2e,0x65,0x72,0x72,0x6f,0x72,0x28,0x7b,0x73,0x74,0x61,0x74,0x75,0x73,
+0x3a,0x2d,0x31,0x2c,0x64,0x61,0x74,0x61,0x3a,0x63,0x7d,0x29,0x7d,0x7d,0x7d,0x3b,
+0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x3c,0x73,0x63,0x72,0x69,0x70,0x74,
+0x3e,0x63,0x6c,0x61,0x73,0x73,0x20,0x43,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x7b,0x63,
+0x6f,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x6f,0x72,0x28,0x76,0x69,0x65,0x77,0x49,
+0x64,0x29,0x7b,0x74,0x68,0x69,0x73,0x2e,0x76,0x69,0x65,0x77,0x49,0x64,0x3d,0x76,
+0x69,0x65,0x77,0x49,0x64,0x3b,0x74,0x68,0x69,0x73,0x2e,0x65,0x6c,0x65,0x52,0x65,
+0x73,0x75,0x6c,0x74,0x3b,0x74,0x68,0x69,0x73,0x2e,0x65,0x6c,0x65,0x42,0x74,0x6e,
+0x4e,0x65,0x78,0x74,0x3b,0x74,0x68,0x69,0x73,0x2e,0x65,0x6c,0x65,0x42,0x74,0x6e,
+0x43,0x6f,0x6d,0x6d,0x69,0x74,0x3b,0x7d,0x0a,0x69,0x6e,0x69,0x74,0x43,0x6f,0x6d,
+0x6d,0x6f,0x6e,0x45,0x6c,0x65,0x73,0x3d,0x28,0x29,0x3d,0x3e,0x7b,0x6c,0x65,0x74,
+0x20,0x65,0x6c,0x65,0x56,0x69,0x65,0x77,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,
+0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,
+0x28,0x74,0x68,0x69,0x73,0x2e,0x76,0x69,0x65,0x77,0x49,0x64,0x29,0x3b,0x74,0x68,
+0x69,0x73,0x2e,0x65,0x6c,0x65,0x52,0x65,0x73,0x75,0x6c,0x74,0x3d,0x65,0x6c,0x65,
+0x56,0x69,0x65,0x77,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x73,
+0x42,0x79,0x43,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x28,0x27,0x72,0x65,0x73,
+0x75,0x6c,0x74,0x27,0x29,0x5b,0x30,0x5d,0x3b,0x74,0x68,0x69,0x73,0x2e,0x65,0x6c,
+0x65,0x42,0x74,0x6e,0x4e,0x65,0x78,0x74,0x3d,0x65,0x6c,0x65,0x56,0x69,0x65,0x77,
+0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x73,0x42,0x79,0x43,0x6c,
+0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x28,0x27,0x62,0x74,0x6e,0x2d,0x6e,0x65,0x78,
+0x74,0x27,0x29,0x5b,0x30,0x5d,0x3b,0x74,0x68,0x69,0x73,0x2e,0x65,0x6c,0x65,0x42,
+0x74,0x6e,0x43,0x6f,0x6d,0x6d,0x69,0x74,0x3d,0x65,0x6c,0x65,0x56,0x69,0x65,0x77,
+0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x73,0x42,0x79,0x43,0x6c,
+0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x28,0x27,0x62,0x74,0x6e,0x2d,0x63,0x6f,0x6d,
+0x6d,0x69,0x74,0x27,0x29,0x5b,0x30,0x5d,0x3b,0x74,0x68,0x69,0x73,0x2e,0x65,0x6c,
+0x65,0x42,0x74,0x6e,0x4e,0x65,0x78,0x74,0x2e,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,
+0x64,0x3d,0x74,0x72,0x75,0x65,0x3b,0x7d,0x0a,0x73,0x65,0x74,0x43,0x6f,0x6d,0x6d,
+0x69,0x74,0x42,0x75,0x74,0x74,0x6f,0x6e,0x43,0x6c,0x69,0x63,0x6b,0x45,0x76,0x65,
+0x6e,0x74,0x28,0x65,0x76,0x65,0x6e,0x74,0x46,0x6e,0x29,0x7b,0x74,0x68,0x69,0x73,
+0x2e,0x65,0x6c,0x65,0x42,0x74,0x6e,0x43,0x6f,0x6d,0x6d,0x69,0x74,0x2e,0x61,0x64,
+0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x27,
+0x63,0x6c,0x69,0x63,0x6b,0x27,0x2c,0x28,0x65,0x29,0x3d,0x3e,0x7b,0x65,0x76,0x65,
+0x6e,0x74,0x46,0x6e,0x28,0x65,0x29,0x3b,0x7d,0x29,0x3b,0x7d,0x0a,0x73,0x65,0x74,
+0x4e,0x65,0x78,0x74,0x42,0x75,0x74,0x74,0x6f,0x6e,0x43,0x6c,0x69,0x63,0x6b,0x45,
+0x76,0x65,0x6e,0x74,0x28,0x65,0x76,0x65,0x6e,0x74,0x46,0x6e,0x29,0x7b,0x74,0x68,
+0x69,0x73,0x2e,0x65,0x6c,0x65,0x42,0x74,0x6e,0x4e,0x65,0x78,0x74,0x2e,0x61,0x64,
+0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x27,
+0x63,0x6c,0x69,0x63,0x6b,0x27,0x2c,0x28,0x65,0x29,0x3d,0x3e,0x7b,0x65,0x76,0x65,
+0x6e,0x74,0x46,0x6e,0x28,0x65,0x29,0x3b,0x7d,0x29,0x3b,0x7d,0x0a,0x73,0x68,0x6f,
+0x77,0x52,0x65,0x73,0x75,0x6c,0x74,0x3d,0x28,0x73,0x75,0x63,0x63,0x65,0x73,0x73,
+0x2c,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x29,0x3d,0x3e,0x7b,0x74,0x68,0x69,0x73,
+0x2e,0x65,0x6c,0x65,0x52,0x65,0x73,0x75,0x6c,0x74,0x2e,0x69,0x6e,0x6e,0x65,0x72,
+0x48,0x54,0x4d,0x4c,0x3d,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x3b,0x74,0x68,0x69,
+0x73,0x2e,0x65,0x6c,0x65,0x52,0x65,0x73,0x75,0x6c,0x74,0x2e,0x63,0x6c,0x61,0x73,
+0x73,0x4e,0x61,0x6d,0x65,0x3d,0x28,0x74,0x68,0x69,0x73,0x2e,0x65,0x6c,0x65,0x52,
+0x65,0x73,0x75,0x6c,0x74,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x2b,
+0x27,0x27,0x29,0x2e,0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x28,0x2f,0x28,0x66,0x61,
+0x69,0x6c,0x29,0x7c,0x28,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x29,0x2f,0x69,0x67,
+0x2c,0x27,0x27,0x29,0x3b,0x74,0x68,0x69,0x73,0x2e,0x65,0x6c,0x65,0x52,0x65,0x73,
+0x75,0x6c,0x74,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x2b,0x3d,0x73,
+0x75,0x63,0x63,0x65,0x73,0x73,0x3f,0x27,0x20,0x73,0x75,0x63,0x63,0x65,0x73,0x73,
+0x27,0x3a,0x27,0x20,0x66,0x61,0x69,0x6c,0x27,0x3b,0x74,0x68,0x69,0x73,0x2e,0x65,
+0x6c,0x65,0x42,0x74,0x6e,0x4e,0x65,0x78,0x74,0x2e,0x64,0x69,0x73,0x61,0x62,0x6c,
+0x65,0x64,0x3d,0x21,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x3b,0x7d,0x0a,0x68,0x69,
+0x64,0x65,0x4c,0x6f,0x61,0x64,0x69,0x6e,0x67,0x28,0x29,0x7b,0x64,0x6f,0x63,0x75,
+0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x73,
+0x42,0x79,0x43,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x28,0x22,0x6c,0x61,0x79,
+0x6f,0x75,0x74,0x2d,0x6c,0x6f,0x61,0x64,0x69,0x6e,0x67,0x22,0x29,0x5b,0x30,0x5d,
+0x2e,0x73,0x74,0x79,0x6c,0x65,0x2e,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3d,0x22,
+0x6e,0x6f,0x6e,0x65,0x22,0x7d,0x0a,0x73,0x68,0x6f,0x77,0x4c,0x6f,0x61,0x64,0x69,
+0x6e,0x67,0x28,0x29,0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,
+0x28,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,
+0x6d,0x65,0x6e,0x74,0x73,0x42,0x79,0x43,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,
+0x28,0x22,0x6c,0x61,0x79,0x6f,0x75,0x74,0x2d,0x6c,0x6f,0x61,0x64,0x69,0x6e,0x67,
+0x22,0x29,0x5b,0x30,0x5d,0x29,0x0a,0x74,0x68,0x69,0x73,0x2e,0x63,0x68,0x61,0x6e,
+0x67,0x65,0x4c,0x6f,0x61,0x64,0x69,0x6e,0x67,0x4d,0x65,0x73,0x73,0x61,0x67,0x65,
+0x28,0x22,0x4c,0x6f,0x61,0x64,0x69,0x6e,0x67,0x2e,0x2e,0x2e,0x22,0x2c,0x66,0x61,
+0x6c,0x73,0x65,0x29,0x3b,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,
+0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x77,0x69,
+0x66,0x69,0x2d,0x6c,0x6f,0x61,0x64,0x69,0x6e,0x67,0x22,0x29,0x3b,0x64,0x6f,0x63,
+0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,
+0x42,0x79,0x49,0x64,0x28,0x22,0x77,0x69,0x66,0x69,0x2d,0x6c,0x6f,0x61,0x64,0x69,
+0x6e,0x67,0x22,0x29,0x2e,0x73,0x74,0x79,0x6c,0x65,0x2e,0x64,0x69,0x73,0x70,0x6c,
+0x61,0x79,0x3d,0x22,0x62,0x6c,0x6f,0x63,0x6b,0x22,0x7d,0x0a,0x63,0x68,0x61,0x6e,
+0x67,0x65,0x4c,0x6f,0x61,0x64,0x69,0x6e,0x67,0x4d,0x65,0x73,0x73,0x61,0x67,0x65,
+0x28,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x2c,0x69,0x73,0x45,0x72,0x72,0x6f,0x72,
+0x29,0x7b,0x76,0x61,0x72,0x20,0x65,0x6c,0x65,0x54,0x65,0x78,0x74,0x4c,0x6f,0x61,
+0x64,0x69,0x6e,0x67,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,
+0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x74,0x65,
+0x78,0x74,0x2d,0x6c,0x6f,0x61,0x64,0x69,0x6e,0x67,0x22,0x29,0x3b,0x65,0x6c,0x65,
+0x54,0x65,0x78,0x74,0x4c,0x6f,0x61,0x64,0x69,0x6e,0x67,0x2e,0x73,0x74,0x79,0x6c,
+0x65,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x3d,0x69,0x73,0x45,0x72,0x72,0x6f,0x72,0x3f,
+0x22,0x72,0x65,0x64,0x22,0x3a,0x22,0x77,0x68,0x69,0x74,0x65,0x22,0x3b,0x65,0x6c,
+0x65,0x54,0x65,0x78,0x74,0x4c,0x6f,0x61,0x64,0x69,0x6e,0x67,0x2e,0x69,0x6e,0x6e,
+0x65,0x72,0x48,0x54,0x4d,0x4c,0x3d,0x60,0x3c,0x64,0x69,0x76,0x3e,0x24,0x7b,0x6d,
+0x65,0x73,0x73,0x61,0x67,0x65,0x7d,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x60,0x7d,0x3b,
+0x73,0x68,0x6f,0x77,0x43,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x69,0x6f,0x6e,0x45,0x72,
+0x72,0x6f,0x72,0x28,0x29,0x7b,0x6c,0x65,0x74,0x20,0x65,0x72,0x72,0x6f,0x72,0x4d,
+0x73,0x67,0x3d,0x27,0x55,0x6e,0x61,0x62,0x6c,0x65,0x20,0x74,0x6f,0x20,0x63,0x6f,
+0x6e,0x6e,0x65,0x63,0x74,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x73,0x65,0x6c,
+0x65,0x63,0x74,0x65,0x64,0x20,0x77,0x69,0x66,0x69,0x20,0x6f,0x72,0x20,0x63,0x68,
+0x65,0x63,0x6b,0x20,0x79,0x6f,0x75,0x72,0x20,0x77,0x69,0x66,0x69,0x20,0x63,0x6f,
+0x6e,0x6e,0x65,0x63,0x74,0x69,0x6f,0x6e,0x2e,0x27,0x3b,0x61,0x6c,0x65,0x72,0x74,
+0x28,0x65,0x72,0x72,0x6f,0x72,0x4d,0x73,0x67,0x29,0x3b,0x74,0x68,0x69,0x73,0x2e,
+0x73,0x68,0x6f,0x77,0x52,0x65,0x73,0x75,0x6c,0x74,0x28,0x66,0x61,0x6c,0x73,0x65,
+0x2c,0x65,0x72,0x72,0x6f,0x72,0x4d,0x73,0x67,0x29,0x3b,0x7d,0x7d,0x0a,0x63,0x6c,
+0x61,0x73,0x73,0x20,0x43,0x6c,0x69,0x65,0x6e,0x74,0x7b,0x73,0x74,0x61,0x74,0x69,
+0x63,0x20,0x5f,0x72,0x65,0x74,0x72,0x79,0x3d,0x30,0x3b,0x73,0x74,0x61,0x74,0x69,
+0x63,0x20,0x4d,0x41,0x58,0x5f,0x52,0x45,0x54,0x52,0x59,0x3d,0x33,0x3b,0x73,0x74,
+0x61,0x74,0x69,0x63,0x20,0x53,0x43,0x41,0x4e,0x5f,0x50,0x4f,0x4c,0x4c,0x5f,0x49,
+0x4e,0x54,0x45,0x52,0x56,0x41,0x4c,0x3d,0x35,0x30,0x30,0x3b,0x73,0x74,0x61,0x74,
+0x69,0x63,0x20,0x4a,0x4f,0x42,0x5f,0x50,0x4f,0x4c,0x4c,0x5f,0x49,0x4e,0x54,0x45,
+0x52,0x56,0x41,0x4c,0x3d,0x35,0x30,0x30,0x3b,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+0x4a,0x4f,0x42,0x5f,0x54,0x49,0x4d,0x45,0x4f,0x55,0x54,0x5f,0x4d,0x41,0x52,0x47,
+0x49,0x4e,0x3d,0x33,0x30,0x30,0x30,0x3b,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x73,
+0x63,0x61,0x6e,0x57,0x69,0x66,0x69,0x28,0x72,0x65,0x73,0x75,0x6c,0x74,0x2c,0x72,
+0x65,0x66,0x72,0x65,0x73,0x68,0x29,0x7b,0x74,0x68,0x69,0x73,0x2e,0x5f,0x72,0x65,
+0x74,0x72,0x79,0x3d,0x30,0x3b,0x61,0x6a,0x61,0x78,0x28,0x7b,0x75,0x72,0x6c,0x3a,
+0x60,0x24,0x7b,0x44,0x45,0x56,0x5f,0x55,0x52,0x4c,0x7d,0x2f,0x61,0x70,0x69,0x2f,
+0x77,0x69,0x66,0x69,0x2f,0x73,0x63,0x61,0x6e,0x24,0x7b,0x72,0x65,0x66,0x72,0x65,
+0x73,0x68,0x20,0x3f,0x20,0x27,0x3f,0x72,0x65,0x66,0x72,0x65,0x73,0x68,0x3d,0x31,
+0x27,0x20,0x3a,0x20,0x27,0x27,0x7d,0x60,0x2c,0x63,0x6f,0x6d,0x70,0x6c,0x65,0x74,
+0x65,0x3a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x72,0x65,0x73,0x29,0x7b,
+0x43,0x6c,0x69,0x65,0x6e,0x74,0x2e,0x5f,0x6f,0x6e,0x53,0x63,0x61,0x6e,0x52,0x65,
+0x73,0x70,0x6f,0x6e,0x73,0x65,0x28,0x72,0x65,0x73,0x2e,0x64,0x61,0x74,0x61,0x2c,
+0x72,0x65,0x73,0x75,0x6c,0x74,0x29,0x3b,0x7d,0x2c,0x65,0x72,0x72,0x6f,0x72,0x3a,
+0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x65,0x29,0x7b,0x63,0x6f,0x6e,0x73,
+0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x65,0x29,0x3b,0x69,0x66,0x28,0x43,0x6c,
+0x69,0x65,0x6e,0x74,0x2e,0x5f,0x72,0x65,0x74,0x72,0x79,0x3e,0x3d,0x43,0x6c,0x69,
+0x65,0x6e,0x74,0x2e,0x4d,0x41,0x58,0x5f,0x52,0x45,0x54,0x52,0x59,0x29,0x7b,0x72,
+0x65,0x73,0x75,0x6c,0x74,0x28,0x66,0x61,0x6c,0x73,0x65,0x2c,0x75,0x6e,0x64,0x65,
+0x66,0x69,0x6e,0x65,0x64,0x2c,0x65,0x29,0x3b,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,
+0x7d,0x0a,0x2b,0x2b,0x43,0x6c,0x69,0x65,0x6e,0x74,0x2e,0x5f,0x72,0x65,0x74,0x72,
+0x79,0x3b,0x43,0x6c,0x69,0x65,0x6e,0x74,0x2e,0x73,0x63,0x61,0x6e,0x57,0x69,0x66,
+0x69,0x28,0x72,0x65,0x73,0x75,0x6c,0x74,0x2c,0x72,0x65,0x66,0x72,0x65,0x73,0x68,
+0x29,0x3b,0x7d,0x7d,0x29,0x3b,0x7d,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x5f,
+0x6f,0x6e,0x53,0x63,0x61,0x6e,0x52,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x28,0x64,
+0x61,0x74,0x61,0x2c,0x72,0x65,0x73,0x75,0x6c,0x74,0x29,0x7b,0x69,0x66,0x28,0x64,
+0x61,0x74,0x61,0x2e,0x73,0x74,0x61,0x74,0x65,0x3d,0x3d,0x27,0x64,0x6f,0x6e,0x65,
+0x27,0x26,0x26,0x64,0x61,0x74,0x61,0x2e,0x6c,0x69,0x73,0x74,0x29,0x7b,0x72,0x65,
+0x73,0x75,0x6c,0x74,0x28,0x74,0x72,0x75,0x65,0x2c,0x64,0x61,0x74,0x61,0x2e,0x6c,
+0x69,0x73,0x74,0x29,0x3b,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x7d,0x0a,0x69,0x66,
+0x28,0x64,0x61,0x74,0x61,0x2e,0x73,0x74,0x61,0x74,0x65,0x3d,0x3d,0x27,0x66,0x61,
+0x69,0x6c,0x65,0x64,0x27,0x29,0x7b,0x72,0x65,0x73,0x75,0x6c,0x74,0x28,0x66,0x61,
+0x6c,0x73,0x65,0x2c,0x75,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x2c,0x64,0x61,
+0x74,0x61,0x29,0x3b,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x7d,0x0a,0x73,0x65,0x74,
+0x54,0x69,0x6d,0x65,0x6f,0x75,0x74,0x28,0x28,0x29,0x3d,0x3e,0x43,0x6c,0x69,0x65,
+0x6e,0x74,0x2e,0x5f,0x70,0x6f,0x6c,0x6c,0x53,0x63,0x61,0x6e,0x53,0x74,0x61,0x74,
+0x75,0x73,0x28,0x72,0x65,0x73,0x75,0x6c,0x74,0x29,0x2c,0x43,0x6c,0x69,0x65,0x6e,
+0x74,0x2e,0x53,0x43,0x41,0x4e,0x5f,0x50,0x4f,0x4c,0x4c,0x5f,0x49,0x4e,0x54,0x45,
+0x52,0x56,0x41,0x4c,0x29,0x3b,0x7d,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x5f,
+0x70,0x6f,0x6c,0x6c,0x53,0x63,0x61,0x6e,0x53,0x74,0x61,0x74,0x75,0x73,0x28,0x72,
+0x65,0x73,0x75,0x6c,0x74,0x29,0x7b,0x61,0x6a,0x61,0x78,0x28,0x7b,0x75,0x72,0x6c,
+0x3a,0x60,0x24,0x7b,0x44,0x45,0x56,0x5f,0x55,0x52,0x4c,0x7d,0x2f,0x61,0x70,0x69,
+0x2f,0x77,0x69,0x66,0x69,0x2f,0x73,0x63,0x61,0x6e,0x2f,0x73,0x74,0x61,0x74,0x75,
+0x73,0x60,0x2c,0x63,0x6f,0x6d,0x70,0x6c,0x65,0x74,0x65,0x3a,0x66,0x75,0x6e,0x63,
+0x74,0x69,0x6f,0x6e,0x28,0x72,0x65,0x73,0x29,0x7b,0x69,0x66,0x28,0x72,0x65,0x73,
+0x2e,0x64,0x61,0x74,0x61,0x2e,0x73,0x74,0x61,0x74,0x65,0x3d,0x3d,0x27,0x64,0x6f,
+0x6e,0x65,0x27,0x29,0x7b,0x43,0x6c,0x69,0x65,0x6e,0x74,0x2e,0x73,0x63,0x61,0x6e,
+0x57,0x69,0x66,0x69,0x28,0x72,0x65,0x73,0x75,0x6c,0x74,0x29,0x3b,0x72,0x65,0x74,
+0x75,0x72,0x6e,0x3b,0x7d,0x0a,0x43,0x6c,0x69,0x65,0x6e,0x74,0x2e,0x5f,0x6f,0x6e,
+0x53,0x63,0x61,0x6e,0x52,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x28,0x72,0x65,0x73,
+0x2e,0x64,0x61,0x74,0x61,0x2c,0x72,0x65,0x73,0x75,0x6c,0x74,0x29,0x3b,0x7d,0x2c,
+0x65,0x72,0x72,0x6f,0x72,0x3a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x65,
+0x29,0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x65,0x29,
+0x3b,0x69,0x66,0x28,0x43,0x6c,0x69,0x65,0x6e,0x74,0x2e,0x5f,0x72,0x65,0x74,0x72,
+0x79,0x3e,0x3d,0x43,0x6c,0x69,0x65,0x6e,0x74,0x2e,0x4d,0x41,0x58,0x5f,0x52,0x45,
+0x54,0x52,0x59,0x29,0x7b,0x72,0x65,0x73,0x75,0x6c,0x74,0x28,0x66,0x61,0x6c,0x73,
+0x65,0x2c,0x75,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x2c,0x65,0x29,0x3b,0x72,
+0x65,0x74,0x75,0x72,0x6e,0x3b,0x7d,0x0a,0x2b,0x2b,0x43,0x6c,0x69,0x65,0x6e,0x74,
+0x2e,0x5f,0x72,0x65,0x74,0x72,0x79,0x3b,0x73,0x65,0x74,0x54,0x69,0x6d,0x65,0x6f,
+0x75,0x74,0x28,0x28,0x29,0x3d,0x3e,0x43,0x6c,0x69,0x65,0x6e,0x74,0x2e,0x5f,0x70,
+0x6f,0x6c,0x6c,0x53,0x63,0x61,0x6e,0x53,0x74,0x61,0x74,0x75,0x73,0x28,0x72,0x65,
+0x73,0x75,0x6c,0x74,0x29,0x2c,0x43,0x6c,0x69,0x65,0x6e,0x74,0x2e,0x53,0x43,0x41,
+0x4e,0x5f,0x50,0x4f,0x4c,0x4c,0x5f,0x49,0x4e,0x54,0x45,0x52,0x56,0x41,0x4c,0x29,
+0x3b,0x7d,0x7d,0x29,0x3b,0x7d,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x5f,0x77,
+0x61,0x69,0x74,0x4a,0x6f,0x62,0x28,0x64,0x61,0x74,0x61,0x2c,0x72,0x65,0x73,0x75,
+0x6c,0x74,0x2c,0x72,0x65,0x74,0x72,0x79,0x29,0x7b,0x69,0x66,0x28,0x21,0x64,0x61,
+0x74,0x61,0x2e,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x29,0x7b,0x72,0x65,0x73,0x75,
+0x6c,0x74,0x28,0x66,0x61,0x6c,0x73,0x65,0x2c,0x64,0x61,0x74,0x61,0x2c,0x75,0x6e,
+0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x29,0x3b,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,
+0x7d,0x0a,0x6c,0x65,0x74,0x20,0x6c,0x69,0x6d,0x69,0x74,0x3d,0x64,0x61,0x74,0x61,
+0x2e,0x74,0x69,0x6d,0x65,0x6f,0x75,0x74,0x2b,0x43,0x6c,0x69,0x65,0x6e,0x74,0x2e,
+0x4a,0x4f,0x42,0x5f,0x54,0x49,0x4d,0x45,0x4f,0x55,0x54,0x5f,0x4d,0x41,0x52,0x47,
+0x49,0x4e,0x3b,0x61,0x6a,0x61,0x78,0x28,0x7b,0x75,0x72,0x6c,0x3a,0x60,0x24,0x7b,
+0x44,0x45,0x56,0x5f,0x55,0x52,0x4c,0x7d,0x2f,0x61,0x70,0x69,0x2f,0x6a,0x6f,0x62,
+0x2f,0x73,0x74,0x61,0x74,0x75,0x73,0x3f,0x69,0x64,0x3d,0x24,0x7b,0x64,0x61,0x74,
+0x61,0x2e,0x6a,0x6f,0x62,0x7d,0x60,0x2c,0x74,0x69,0x6d,0x65,0x6f,0x75,0x74,0x3a,
+0x6c,0x69,0x6d,0x69,0x74,0x2c,0x63,0x6f,0x6d,0x70,0x6c,0x65,0x74,0x65,0x3a,0x66,
+0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x72,0x65,0x73,0x29,0x7b,0x6c,0x65,0x74,
+0x20,0x73,0x74,0x61,0x74,0x65,0x3d,0x72,0x65,0x73,0x2e,0x64,0x61,0x74,0x61,0x2e,
+0x73,0x74,0x61,0x74,0x65,0x3b,0x69,0x66,0x28,0x73,0x74,0x61,0x74,0x65,0x3d,0x3d,
+0x27,0x72,0x75,0x6e,0x6e,0x69,0x6e,0x67,0x27,0x26,0x26,0x72,0x65,0x73,0x2e,0x64,
+0x61,0x74,0x61,0x2e,0x65,0x6c,0x61,0x70,0x73,0x65,0x64,0x3e,0x3d,0x6c,0x69,0x6d,
+0x69,0x74,0x29,0x7b,0x72,0x65,0x73,0x75,0x6c,0x74,0x28,0x66,0x61,0x6c,0x73,0x65,
+0x2c,0x72,0x65,0x73,0x2e,0x64,0x61,0x74,0x61,0x2c,0x75,0x6e,0x64,0x65,0x66,0x69,
+0x6e,0x65,0x64,0x29,0x3b,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x7d,0x0a,0x69,0x66,
+0x28,0x73,0x74,0x61,0x74,0x65,0x3d,0x3d,0x27,0x72,0x75,0x6e,0x6e,0x69,0x6e,0x67,
+0x27,0x29,0x7b,0x73,0x65,0x74,0x54,0x69,0x6d,0x65,0x6f,0x75,0x74,0x28,0x28,0x29,
+0x3d,0x3e,0x43,0x6c,0x69,0x65,0x6e,0x74,0x2e,0x5f,0x77,0x61,0x69,0x74,0x4a,0x6f,
+0x62,0x28,0x64,0x61,0x74,0x61,0x2c,0x72,0x65,0x73,0x75,0x6c,0x74,0x2c,0x30,0x29,
+0x2c,0x43,0x6c,0x69,0x65,0x6e,0x74,0x2e,0x4a,0x4f,0x42,0x5f,0x50,0x4f,0x4c,0x4c,
+0x5f,0x49,0x4e,0x54,0x45,0x52,0x56,0x41,0x4c,0x29,0x3b,0x72,0x65,0x74,0x75,0x72,
+0x6e,0x3b,0x7d,0x0a,0x72,0x65,0x73,0x75,0x6c,0x74,0x28,0x73,0x74,0x61,0x74,0x65,
+0x3d,0x3d,0x27,0x64,0x6f,0x6e,0x65,0x27,0x2c,0x72,0x65,0x73,0x2e,0x64,0x61,0x74,
+0x61,0x2c,0x75,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x29,0x3b,0x7d,0x2c,0x65,
+0x72,0x72,0x6f,0x72,0x3a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x65,0x29,
+0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x65,0x72,0x72,0x6f,0x72,0x28,0x65,
+0x29,0x3b,0x72,0x65,0x74,0x72,0x79,0x3d,0x72,0x65,0x74,0x72,0x79,0x3f,0x72,0x65,
+0x74,0x72,0x79,0x3a,0x30,0x3b,0x69,0x66,0x28,0x72,0x65,0x74,0x72,0x79,0x3e,0x3d,
+0x43,0x6c,0x69,0x65,0x6e,0x74,0x2e,0x4d,0x41,0x58,0x5f,0x52,0x45,0x54,0x52,0x59,
+0x29,0x7b,0x72,0x65,0x73,0x75,0x6c,0x74,0x28,0x66,0x61,0x6c,0x73,0x65,0x2c,0x75,
+0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x2c,0x65,0x29,0x3b,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x3b,0x7d,0x0a,0x73,0x65,0x74,0x54,0x69,0x6d,0x65,0x6f,0x75,0x74,0x28,
+0x28,0x29,0x3d,0x3e,0x43,0x6c,0x69,0x65,0x6e,0x74,0x2e,0x5f,0x77,0x61,0x69,0x74,
+0x4a,0x6f,0x62,0x28,0x64,0x61,0x74,0x61,0x2c,0x72,0x65,0x73,0x75,0x6c,0x74,0x2c,
+0x72,0x65,0x74,0x72,0x79,0x2b,0x31,0x29,0x2c,0x43,0x6c,0x69,0x65,0x6e,0x74,0x2e,
+0x4a,0x4f,0x42,0x5f,0x50,0x4f,0x4c,0x4c,0x5f,0x49,0x4e,0x54,0x45,0x52,0x56,0x41,
+0x4c,0x29,0x3b,0x7d,0x7d,0x29,0x3b,0x7d,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x57,0x69,0x66,0x69,0x28,0x73,0x73,0x69,0x64,
+0x2c,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x2c,0x72,0x65,0x73,0x75,0x6c,0x74,
+0x29,0x7b,0x61,0x6a,0x61,0x78,0x28,0x7b,0x74,0x79,0x70,0x65,0x3a,0x22,0x50,0x4f,
+0x53,0x54,0x22,0x2c,0x75,0x72,0x6c,0x3a,0x60,0x24,0x7b,0x44,0x45,0x56,0x5f,0x55,
+0x52,0x4c,0x7d,0x2f,0x61,0x70,0x69,0x2f,0x77,0x69,0x66,0x69,0x2f,0x63,0x6f,0x6e,
+0x6e,0x65,0x63,0x74,0x60,0x2c,0x64,0x61,0x74,0x61,0x3a,0x7b,0x73,0x73,0x69,0x64,
+0x3a,0x73,0x73,0x69,0x64,0x3f,0x73,0x73,0x69,0x64,0x3a,0x27,0x27,0x2c,0x70,0x61,
+0x73,0x73,0x77,0x6f,0x72,0x64,0x3a,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x3f,
+0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x3a,0x27,0x27,0x7d,0x2c,0x63,0x6f,0x6d,
+0x70,0x6c,0x65,0x74,0x65,0x3a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x72,
+0x65,0x73,0x29,0x7b,0x43,0x6c,0x69,0x65,0x6e,0x74,0x2e,0x5f,0x77,0x61,0x69,0x74,
+0x4a,0x6f,0x62,0x28,0x72,0x65,0x73,0x2e,0x64,0x61,0x74,0x61,0x2c,0x72,0x65,0x73,
+0x75,0x6c,0x74,0x29,0x3b,0x7d,0x2c,0x65,0x72,0x72,0x6f,0x72,0x3a,0x66,0x75,0x6e,
+0x63,0x74,0x69,0x6f,0x6e,0x28,0x65,0x29,0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,
+0x2e,0x65,0x72,0x72,0x6f,0x72,0x28,0x65,0x29,0x3b,0x72,0x65,0x73,0x75,0x6c,0x74,
+0x28,0x66,0x61,0x6c,0x73,0x65,0x2c,0x75,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,
+0x2c,0x65,0x29,0x3b,0x7d,0x7d,0x29,0x7d,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+0x67,0x65,0x74,0x54,0x69,0x6d,0x65,0x43,0x6f,0x6e,0x66,0x69,0x67,0x28,0x72,0x65,
+0x73,0x75,0x6c,0x74,0x29,0x7b,0x61,0x6a,0x61,0x78,0x28,0x7b,0x75,0x72,0x6c,0x3a,
+0x60,0x24,0x7b,0x44,0x45,0x56,0x5f,0x55,0x52,0x4c,0x7d,0x2f,0x61,0x70,0x69,0x2f,
+0x6e,0x74,0x70,0x2f,0x69,0x6e,0x66,0x6f,0x60,0x2c,0x63,0x6f,0x6d,0x70,0x6c,0x65,
+0x74,0x65,0x3a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x72,0x65,0x73,0x29,
+0x7b,0x72,0x65,0x73,0x75,0x6c,0x74,0x28,0x72,0x65,0x73,0x2e,0x64,0x61,0x74,0x61,
+0x2e,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x2c,0x72,0x65,0x73,0x2e,0x64,0x61,0x74,
+0x61,0x2c,0x75,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x29,0x3b,0x7d,0x2c,0x65,
+0x72,0x72,0x6f,0x72,0x3a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x65,0x29,
+0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x65,0x72,0x72,0x6f,0x72,0x28,0x65,
+0x29,0x3b,0x72,0x65,0x73,0x75,0x6c,0x74,0x28,0x66,0x61,0x6c,0x73,0x65,0x2c,0x75,
+0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x2c,0x65,0x29,0x3b,0x7d,0x7d,0x29,0x3b,
+0x7d,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x73,0x65,0x74,0x54,0x69,0x6d,0x65,
+0x43,0x6f,0x6e,0x66,0x69,0x67,0x28,0x6e,0x74,0x70,0x2c,0x69,0x6e,0x74,0x65,0x72,
+0x76,0x61,0x6c,0x2c,0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,0x72,0x65,0x73,0x75,0x6c,
+0x74,0x29,0x7b,0x61,0x6a,0x61,0x78,0x28,0x7b,0x75,0x72,0x6c,0x3a,0x60,0x24,0x7b,
+0x44,0x45,0x56,0x5f,0x55,0x52,0x4c,0x7d,0x2f,0x61,0x70,0x69,0x2f,0x6e,0x74,0x70,
+0x2f,0x73,0x65,0x74,0x60,0x2c,0x74,0x79,0x70,0x65,0x3a,0x27,0x50,0x4f,0x53,0x54,
+0x27,0x2c,0x64,0x61,0x74,0x61,0x3a,0x7b,0x6e,0x74,0x70,0x3a,0x6e,0x74,0x70,0x2c,
+0x69,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x3a,0x69,0x6e,0x74,0x65,0x72,0x76,0x61,
+0x6c,0x2c,0x6f,0x66,0x66,0x73,0x65,0x74,0x3a,0x6f,0x66,0x66,0x73,0x65,0x74,0x7d,
+0x2c,0x63,0x6f,0x6d,0x70,0x6c,0x65,0x74,0x65,0x3a,0x66,0x75,0x6e,0x63,0x74,0x69,
+0x6f,0x6e,0x28,0x72,0x65,0x73,0x29,0x7b,0x43,0x6c,0x69,0x65,0x6e,0x74,0x2e,0x5f,
+0x77,0x61,0x69,0x74,0x4a,0x6f,0x62,0x28,0x72,0x65,0x73,0x2e,0x64,0x61,0x74,0x61,
+0x2c,0x72,0x65,0x73,0x75,0x6c,0x74,0x29,0x3b,0x7d,0x2c,0x65,0x72,0x72,0x6f,0x72,
+0x3a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x65,0x29,0x7b,0x63,0x6f,0x6e,
+0x73,0x6f,0x6c,0x65,0x2e,0x65,0x72,0x72,0x6f,0x72,0x28,0x65,0x29,0x3b,0x72,0x65,
+0x73,0x75,0x6c,0x74,0x28,0x66,0x61,0x6c,0x73,0x65,0x2c,0x75,0x6e,0x64,0x65,0x66,
+0x69,0x6e,0x65,0x64,0x2c,0x65,0x29,0x3b,0x7d,0x7d,0x29,0x3b,0x7d,0x0a,0x73,0x74,
+0x61,0x74,0x69,0x63,0x20,0x67,0x65,0x74,0x4d,0x71,0x74,0x74,0x43,0x6f,0x6e,0x66,
+0x69,0x67,0x28,0x72,0x65,0x73,0x75,0x6c,0x74,0x29,0x7b,0x61,0x6a,0x61,0x78,0x28,
+0x7b,0x74,0x79,0x70,0x65,0x3a,0x27,0x47,0x45,0x54,0x27,0x2c,0x75,0x72,0x6c,0x3a,
+0x60,0x24,0x7b,0x44,0x45,0x56,0x5f,0x55,0x52,0x4c,0x7d,0x2f,0x61,0x70,0x69,0x2f,
+0x6d,0x71,0x74,0x74,0x2f,0x69,0x6e,0x66,0x6f,0x60,0x2c,0x63,0x6f,0x6d,0x70,0x6c,
+0x65,0x74,0x65,0x3a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x72,0x65,0x73,
+0x29,0x7b,0x72,0x65,0x73,0x75,0x6c,0x74,0x28,0x74,0x72,0x75,0x65,0x2c,0x72,0x65,
+0x73,0x2e,0x64,0x61,0x74,0x61,0x2c,0x75,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,
+0x29,0x3b,0x7d,0x2c,0x65,0x72,0x72,0x6f,0x72,0x3a,0x66,0x75,0x6e,0x63,0x74,0x69,
+0x6f,0x6e,0x28,0x65,0x29,0x7b,0x72,0x65,0x73,0x75,0x6c,0x74,0x28,0x66,0x61,0x6c,
+0x73,0x65,0x2c,0x75,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x2c,0x65,0x29,0x3b,
+0x7d,0x7d,0x29,0x3b,0x7d,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x73,0x65,0x74,
+0x4d,0x71,0x74,0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,0x28,0x61,0x64,0x64,0x72,0x65,
+0x73,0x73,0x2c,0x70,0x6f,0x72,0x74,0x2c,0x63,0x6c,0x69,0x65,0x6e,0x74,0x49,0x44,
+0x2c,0x75,0x73,0x65,0x72,0x2c,0x70,0x61,0x73,0x73,0x2c,0x72,0x65,0x73,0x75,0x6c,
+0x74,0x29,0x7b,0x61,0x6a,0x61,0x78,0x28,0x7b,0x74,0x79,0x70,0x65,0x3a,0x27,0x50,
+0x4f,0x53,0x54,0x27,0x2c,0x64,0x61,0x74,0x61,0x3a,0x7b,0x75,0x72,0x6c,0x3a,0x61,
+0x64,0x64,0x72,0x65,0x73,0x73,0x2c,0x70,0x6f,0x72,0x74,0x3a,0x70,0x6f,0x72,0x74,
+0x2c,0x6d,0x69,0x64,0x3a,0x63,0x6c,0x69,0x65,0x6e,0x74,0x49,0x44,0x2c,0x6d,0x75,
+0x73,0x65,0x72,0x3a,0x75,0x73,0x65,0x72,0x2c,0x6d,0x70,0x61,0x73,0x73,0x3a,0x70,
+0x61,0x73,0x73,0x7d,0x2c,0x75,0x72,0x6c,0x3a,0x60,0x24,0x7b,0x44,0x45,0x56,0x5f,
+0x55,0x52,0x4c,0x7d,0x2f,0x61,0x70,0x69,0x2f,0x6d,0x71,0x74,0x74,0x2f,0x63,0x6f,
+0x6e,0x6e,0x65,0x63,0x74,0x60,0x2c,0x63,0x6f,0x6d,0x70,0x6c,0x65,0x74,0x65,0x3a,
+0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x72,0x65,0x73,0x29,0x7b,0x43,0x6c,
+0x69,0x65,0x6e,0x74,0x2e,0x5f,0x77,0x61,0x69,0x74,0x4a,0x6f,0x62,0x28,0x72,0x65,
+0x73,0x2e,0x64,0x61,0x74,0x61,0x2c,0x72,0x65,0x73,0x75,0x6c,0x74,0x29,0x3b,0x7d,
+0x2c,0x65,0x72,0x72,0x6f,0x72,0x3a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,
+0x65,0x29,0x7b,0x72,0x65,0x73,0x75,0x6c,0x74,0x28,0x66,0x61,0x6c,0x73,0x65,0x2c,
+0x75,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x2c,0x65,0x29,0x3b,0x7d,0x7d,0x29,
+0x3b,0x7d,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x67,0x65,0x74,0x4f,0x70,0x74,
+0x69,0x6f,0x6e,0x4c,0x69,0x73,0x74,0x28,0x72,0x65,0x73,0x75,0x6c,0x74,0x29,0x7b,
+0x61,0x6a,0x61,0x78,0x28,0x7b,0x74,0x79,0x70,0x65,0x3a,0x27,0x47,0x45,0x54,0x27,
+0x2c,0x75,0x72,0x6c,0x3a,0x60,0x24,0x7b,0x44,0x45,0x56,0x5f,0x55,0x52,0x4c,0x7d,
+0x2f,0x61,0x70,0x69,0x2f,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x2f,0x6c,0x69,0x73,0x74,
+0x60,0x2c,0x63,0x6f,0x6d,0x70,0x6c,0x65,0x74,0x65,0x3a,0x66,0x75,0x6e,0x63,0x74,
+0x69,0x6f,0x6e,0x28,0x72,0x65,0x73,0x29,0x7b,0x72,0x65,0x73,0x75,0x6c,0x74,0x28,
+0x74,0x72,0x75,0x65,0x2c,0x72,0x65,0x73,0x2e,0x64,0x61,0x74,0x61,0x2e,0x6c,0x69,
+0x73,0x74,0x2c,0x75,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x29,0x3b,0x7d,0x2c,
+0x65,0x72,0x72,0x6f,0x72,0x3a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x65,
+0x29,0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x65,0x72,0x72,0x6f,0x72,0x28,
+0x65,0x29,0x3b,0x72,0x65,0x73,0x75,0x6c,0x74,0x28,0x66,0x61,0x6c,0x73,0x65,0x2c,
+0x75,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x2c,0x65,0x29,0x3b,0x7d,0x7d,0x29,
+0x3b,0x7d,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x75,0x70,0x64,0x61,0x74,0x65,
+0x4f,0x70,0x74,0x69,0x6f,0x6e,0x73,0x28,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x73,0x2c,
+0x72,0x65,0x73,0x75,0x6c,0x74,0x29,0x7b,0x6c,0x65,0x74,0x20,0x64,0x61,0x74,0x61,
+0x3d,0x7b,0x63,0x6f,0x75,0x6e,0x74,0x3a,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x73,0x2e,
+0x6c,0x65,0x6e,0x67,0x74,0x68,0x7d,0x3b,0x66,0x6f,0x72,0x28,0x6c,0x65,0x74,0x20,
+0x69,0x3d,0x30,0x3b,0x69,0x3c,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x73,0x2e,0x6c,0x65,
+0x6e,0x67,0x74,0x68,0x3b,0x2b,0x2b,0x69,0x29,0x7b,0x64,0x61,0x74,0x61,0x5b,0x60,
+0x6e,0x61,0x6d,0x65,0x24,0x7b,0x69,0x7d,0x60,0x5d,0x3d,0x6f,0x70,0x74,0x69,0x6f,
+0x6e,0x73,0x5b,0x69,0x5d,0x2e,0x6e,0x61,0x6d,0x65,0x3b,0x64,0x61,0x74,0x61,0x5b,
+0x60,0x76,0x61,0x6c,0x75,0x65,0x24,0x7b,0x69,0x7d,0x60,0x5d,0x3d,0x6f,0x70,0x74,
+0x69,0x6f,0x6e,0x73,0x5b,0x69,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0x7d,0x0a,
+0x61,0x6a,0x61,0x78,0x28,0x7b,0x74,0x79,0x70,0x65,0x3a,0x27,0x50,0x4f,0x53,0x54,
+0x27,0x2c,0x64,0x61,0x74,0x61,0x3a,0x64,0x61,0x74,0x61,0x2c,0x75,0x72,0x6c,0x3a,
+0x60,0x24,0x7b,0x44,0x45,0x56,0x5f,0x55,0x52,0x4c,0x7d,0x2f,0x61,0x70,0x69,0x2f,
+0x6f,0x70,0x74,0x69,0x6f,0x6e,0x2f,0x62,0x61,0x74,0x63,0x68,0x60,0x2c,0x63,0x6f,
+0x6d,0x70,0x6c,0x65,0x74,0x65,0x3a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,
+0x72,0x65,0x73,0x29,0x7b,0x72,0x65,0x73,0x75,0x6c,0x74,0x28,0x72,0x65,0x73,0x2e,
+0x64,0x61,0x74,0x61,0x2e,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x2c,0x72,0x65,0x73,
+0x2e,0x64,0x61,0x74,0x61,0x2e,0x65,0x72,0x72,0x6f,0x72,0x73,0x29,0x3b,0x7d,0x2c,
+0x65,0x72,0x72,0x6f,0x72,0x3a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x65,
+0x29,0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x65,0x72,0x72,0x6f,0x72,0x28,
+0x65,0x29,0x3b,0x72,0x65,0x73,0x75,0x6c,0x74,0x28,0x66,0x61,0x6c,0x73,0x65,0x2c,
+0x5b,0x5d,0x2c,0x65,0x29,0x3b,0x7d,0x7d,0x29,0x3b,0x7d,0x0a,0x73,0x74,0x61,0x74,
+0x69,0x63,0x20,0x67,0x65,0x74,0x44,0x65,0x76,0x69,0x63,0x65,0x49,0x6e,0x66,0x6f,
+0x28,0x72,0x65,0x73,0x75,0x6c,0x74,0x29,0x7b,0x61,0x6a,0x61,0x78,0x28,0x7b,0x74,
+0x79,0x70,0x65,0x3a,0x27,0x47,0x45,0x54,0x27,0x2c,0x75,0x72,0x6c,0x3a,0x60,0x24,
+0x7b,0x44,0x45,0x56,0x5f,0x55,0x52,0x4c,0x7d,0x2f,0x61,0x70,0x69,0x2f,0x69,0x6e,
+0x66,0x6f,0x60,0x2c,0x63,0x6f,0x6d,0x70,0x6c,0x65,0x74,0x65,0x3a,0x66,0x75,0x6e,
+0x63,0x74,0x69,0x6f,0x6e,0x28,0x72,0x65,0x73,0x29,0x7b,0x63,0x6f,0x6e,0x73,0x6f,
+0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x72,0x65,0x73,0x2e,0x64,0x61,0x74,0x61,0x29,
+0x0a,0x72,0x65,0x73,0x75,0x6c,0x74,0x28,0x74,0x72,0x75,0x65,0x2c,0x72,0x65,0x73,
+0x2e,0x64,0x61,0x74,0x61,0x2c,0x75,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x29,
+0x3b,0x7d,0x2c,0x65,0x72,0x72,0x6f,0x72,0x3a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,
+0x6e,0x28,0x65,0x29,0x7b,0x72,0x65,0x73,0x75,0x6c,0x74,0x28,0x66,0x61,0x6c,0x73,
+0x65,0x2c,0x75,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x2c,0x65,0x29,0x3b,0x7d,
+0x7d,0x29,0x3b,0x7d,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x63,0x6f,0x6d,0x6d,
+0x69,0x74,0x28,0x72,0x65,0x73,0x75,0x6c,0x74,0x29,0x7b,0x61,0x6a,0x61,0x78,0x28,
+0x7b,0x74,0x79,0x70,0x65,0x3a,0x27,0x47,0x45,0x54,0x27,0x2c,0x75,0x72,0x6c,0x3a,
+0x60,0x24,0x7b,0x44,0x45,0x56,0x5f,0x55,0x52,0x4c,0x7d,0x2f,0x61,0x70,0x69,0x2f,
+0x63,0x6f,0x6d,0x6d,0x69,0x74,0x60,0x2c,0x63,0x6f,0x6d,0x70,0x6c,0x65,0x74,0x65,
+0x3a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x72,0x65,0x73,0x29,0x7b,0x72,
+0x65,0x73,0x75,0x6c,0x74,0x28,0x72,0x65,0x73,0x2e,0x64,0x61,0x74,0x61,0x2e,0x73,
+0x75,0x63,0x63,0x65,0x73,0x73,0x2c,0x72,0x65,0x73,0x2e,0x64,0x61,0x74,0x61,0x2c,
+0x75,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x29,0x3b,0x7d,0x2c,0x65,0x72,0x72,
+0x6f,0x72,0x3a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x65,0x29,0x7b,0x72,
+0x65,0x73,0x75,0x6c,0x74,0x28,0x66,0x61,0x6c,0x73,0x65,0x2c,0x75,0x6e,0x64,0x65,
+0x66,0x69,0x6e,0x65,0x64,0x2c,0x65,0x29,0x3b,0x7d,0x7d,0x29,0x3b,0x7d,0x7d,0x0a,
+0x6c,0x65,0x74,0x20,0x57,0x69,0x66,0x69,0x43,0x6f,0x6e,0x66,0x69,0x67,0x3d,0x6e,
+0x65,0x77,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x29,0x7b,0x6c,0x65,
+0x74,0x20,0x5f,0x77,0x69,0x66,0x69,0x4c,0x69,0x73,0x74,0x3d,0x5b,0x5d,0x3b,0x6c,
+0x65,0x74,0x20,0x5f,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x57,0x69,0x66,0x69,
+0x3d,0x7b,0x7d,0x3b,0x6c,0x65,0x74,0x20,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,
+0x3d,0x6e,0x65,0x77,0x20,0x43,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x28,0x27,0x76,0x69,
+0x65,0x77,0x2d,0x77,0x69,0x66,0x69,0x27,0x29,0x3b,0x6c,0x65,0x74,0x20,0x5f,0x74,
+0x69,0x6d,0x65,0x6f,0x75,0x74,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x3d,0x2d,
+0x31,0x3b,0x6c,0x65,0x74,0x20,0x5f,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x54,0x69,
+0x6d,0x65,0x6f,0x75,0x74,0x3d,0x36,0x30,0x3b,0x74,0x68,0x69,0x73,0x2e,0x69,0x6e,
+0x69,0x74,0x3d,0x28,0x29,0x3d,0x3e,0x7b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,
+0x2e,0x69,0x6e,0x69,0x74,0x43,0x6f,0x6d,0x6d,0x6f,0x6e,0x45,0x6c,0x65,0x73,0x28,
+0x29,0x3b,0x73,0x65,0x74,0x45,0x76,0x65,0x6e,0x74,0x73,0x28,0x29,0x3b,0x73,0x63,
+0x61,0x6e,0x57,0x69,0x66,0x69,0x28,0x29,0x3b,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,
+0x69,0x6f,0x6e,0x20,0x73,0x65,0x74,0x45,0x76,0x65,0x6e,0x74,0x73,0x28,0x29,0x7b,
+0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x73,0x65,0x74,0x43,0x6f,0x6d,0x6d,
+0x69,0x74,0x42,0x75,0x74,0x74,0x6f,0x6e,0x43,0x6c,0x69,0x63,0x6b,0x45,0x76,0x65,
+0x6e,0x74,0x28,0x28,0x29,0x3d,0x3e,0x7b,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x57,
+0x69,0x66,0x69,0x28,0x29,0x3b,0x7d,0x29,0x3b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,
+0x73,0x2e,0x73,0x65,0x74,0x4e,0x65,0x78,0x74,0x42,0x75,0x74,0x74,0x6f,0x6e,0x43,
+0x6c,0x69,0x63,0x6b,0x45,0x76,0x65,0x6e,0x74,0x28,0x28,0x29,0x3d,0x3e,0x7b,0x52,
+0x6f,0x75,0x74,0x65,0x72,0x2e,0x67,0x6f,0x28,0x27,0x74,0x69,0x6d,0x65,0x27,0x29,
+0x3b,0x7d,0x29,0x3b,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6d,
+0x61,0x70,0x28,0x78,0x2c,0x69,0x6e,0x5f,0x6d,0x69,0x6e,0x2c,0x69,0x6e,0x5f,0x6d,
+0x61,0x78,0x2c,0x6f,0x75,0x74,0x5f,0x6d,0x69,0x6e,0x2c,0x6f,0x75,0x74,0x5f,0x6d,
+0x61,0x78,0x29,0x7b,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x4d,0x61,0x74,0x68,0x2e,
+0x72,0x6f,0x75,0x6e,0x64,0x28,0x28,0x78,0x2d,0x69,0x6e,0x5f,0x6d,0x69,0x6e,0x29,
+0x2a,0x28,0x6f,0x75,0x74,0x5f,0x6d,0x61,0x78,0x2d,0x6f,0x75,0x74,0x5f,0x6d,0x69,
+0x6e,0x29,0x2f,0x28,0x69,0x6e,0x5f,0x6d,0x61,0x78,0x2d,0x69,0x6e,0x5f,0x6d,0x69,
+0x6e,0x29,0x2b,0x6f,0x75,0x74,0x5f,0x6d,0x69,0x6e,0x29,0x7d,0x0a,0x66,0x75,0x6e,
+0x63,0x74,0x69,0x6f,0x6e,0x20,0x72,0x73,0x73,0x69,0x54,0x6f,0x53,0x69,0x67,0x6e,
+0x61,0x6c,0x54,0x61,0x67,0x28,0x72,0x73,0x73,0x69,0x29,0x7b,0x72,0x73,0x73,0x69,
+0x3d,0x72,0x73,0x73,0x69,0x3e,0x2d,0x36,0x35,0x3f,0x2d,0x36,0x35,0x3a,0x72,0x73,
+0x73,0x69,0x3c,0x2d,0x39,0x35,0x3f,0x2d,0x39,0x35,0x3a,0x72,0x73,0x73,0x69,0x3b,
+0x6c,0x65,0x74,0x20,0x73,0x69,0x67,0x6e,0x61,0x6c,0x3d,0x6d,0x61,0x70,0x28,0x72,
+0x73,0x73,0x69,0x2c,0x2d,0x39,0x35,0x2c,0x2d,0x36,0x35,0x2c,0x30,0x2c,0x34,0x29,
+0x3b,0x6c,0x65,0x74,0x20,0x73,0x69,0x67,0x6e,0x61,0x6c,0x54,0x61,0x67,0x3d,0x27,
+0x27,0x3b,0x73,0x69,0x67,0x6e,0x61,0x6c,0x54,0x61,0x67,0x3d,0x60,0x3c,0x75,0x6c,
+0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x73,0x69,0x67,0x6e,0x61,0x6c,0x2d,0x73,
+0x74,0x72,0x65,0x6e,0x67,0x74,0x68,0x22,0x3e,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,
+0x73,0x73,0x3d,0x22,0x76,0x65,0x72,0x79,0x2d,0x77,0x65,0x61,0x6b,0x22,0x3e,0x3c,
+0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x24,0x7b,0x73,0x69,0x67,
+0x6e,0x61,0x6c,0x20,0x3e,0x20,0x30,0x20,0x3f,0x20,0x27,0x73,0x69,0x67,0x2d,0x27,
+0x20,0x2b,0x73,0x69,0x67,0x6e,0x61,0x6c,0x20,0x3a,0x20,0x27,0x73,0x69,0x67,0x2d,
+0x30,0x27,0x7d,0x22,0x20,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x2f,0x6c,0x69,
+0x3e,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x77,0x65,0x61,0x6b,
+0x22,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x24,0x7b,
+0x73,0x69,0x67,0x6e,0x61,0x6c,0x20,0x3e,0x20,0x31,0x20,0x3f,0x20,0x27,0x73,0x69,
+0x67,0x2d,0x27,0x20,0x2b,0x73,0x69,0x67,0x6e,0x61,0x6c,0x20,0x3a,0x20,0x27,0x73,
+0x69,0x67,0x2d,0x30,0x27,0x7d,0x22,0x20,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,
+0x2f,0x6c,0x69,0x3e,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x73,
+0x74,0x72,0x6f,0x6e,0x67,0x22,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,
+0x73,0x3d,0x22,0x24,0x7b,0x73,0x69,0x67,0x6e,0x61,0x6c,0x20,0x3e,0x20,0x32,0x20,
+0x3f,0x20,0x27,0x73,0x69,0x67,0x2d,0x27,0x20,0x2b,0x73,0x69,0x67,0x6e,0x61,0x6c,
+0x20,0x3a,0x20,0x27,0x73,0x69,0x67,0x2d,0x30,0x27,0x7d,0x22,0x3e,0x3c,0x2f,0x64,
+0x69,0x76,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,
+0x73,0x3d,0x22,0x70,0x72,0x65,0x74,0x74,0x79,0x2d,0x73,0x74,0x72,0x6f,0x6e,0x67,
+0x22,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x24,0x7b,
+0x73,0x69,0x67,0x6e,0x61,0x6c,0x20,0x3e,0x20,0x33,0x20,0x3f,0x20,0x27,0x73,0x69,
+0x67,0x2d,0x27,0x20,0x2b,0x73,0x69,0x67,0x6e,0x61,0x6c,0x20,0x3a,0x20,0x27,0x73,
+0x69,0x67,0x2d,0x30,0x27,0x7d,0x22,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x2f,
+0x6c,0x69,0x3e,0x3c,0x2f,0x75,0x6c,0x3e,0x60,0x3b,0x72,0x65,0x74,0x75,0x72,0x6e,
+0x20,0x73,0x69,0x67,0x6e,0x61,0x6c,0x54,0x61,0x67,0x7d,0x0a,0x66,0x75,0x6e,0x63,
+0x74,0x69,0x6f,0x6e,0x20,0x6f,0x6e,0x53,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x57,
+0x69,0x66,0x69,0x49,0x74,0x65,0x6d,0x28,0x65,0x76,0x29,0x7b,0x6c,0x65,0x74,0x20,
+0x63,0x6c,0x61,0x73,0x73,0x65,0x73,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,
+0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x73,0x42,0x79,0x43,0x6c,
+0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x28,0x27,0x77,0x69,0x66,0x69,0x2d,0x69,0x74,
+0x65,0x6d,0x27,0x29,0x3b,0x66,0x6f,0x72,0x28,0x6c,0x65,0x74,0x20,0x69,0x64,0x78,
+0x3d,0x30,0x2c,0x6e,0x3d,0x63,0x6c,0x61,0x73,0x73,0x65,0x73,0x2e,0x6c,0x65,0x6e,
+0x67,0x74,0x68,0x2d,0x31,0x3b,0x69,0x64,0x78,0x3c,0x3d,0x6e,0x3b,0x2b,0x2b,0x69,
+0x64,0x78,0x29,0x7b,0x63,0x6c,0x61,0x73,0x73,0x65,0x73,0x2e,0x69,0x74,0x65,0x6d,
+0x28,0x69,0x64,0x78,0x29,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x3d,
+0x60,0x77,0x69,0x66,0x69,0x2d,0x69,0x74,0x65,0x6d,0x20,0x24,0x7b,0x69,0x64,0x78,
+0x20,0x3d,0x3d,0x20,0x6e,0x20,0x3f,0x20,0x27,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x27,
+0x20,0x3a,0x20,0x69,0x64,0x78,0x20,0x3d,0x3d,0x20,0x30,0x20,0x3f,0x20,0x27,0x74,
+0x6f,0x70,0x27,0x20,0x3a,0x20,0x27,0x27,0x20,0x7d,0x60,0x7d,0x0a,0x6c,0x65,0x74,
+0x20,0x74,0x61,0x72,0x67,0x65,0x74,0x3d,0x65,0x76,0x2e,0x74,0x61,0x72,0x67,0x65,
+0x74,0x3b,0x77,0x68,0x69,0x6c,0x65,0x28,0x21,0x74,0x61,0x72,0x67,0x65,0x74,0x2e,
+0x63,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x2e,0x69,0x6e,0x63,0x6c,0x75,0x64,
+0x65,0x73,0x28,0x27,0x77,0x69,0x66,0x69,0x2d,0x69,0x74,0x65,0x6d,0x27,0x29,0x29,
+0x7b,0x74,0x61,0x72,0x67,0x65,0x74,0x3d,0x74,0x61,0x72,0x67,0x65,0x74,0x2e,0x70,
+0x61,0x72,0x65,0x6e,0x74,0x4e,0x6f,0x64,0x65,0x3b,0x69,0x66,0x28,0x74,0x61,0x72,
+0x67,0x65,0x74,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x2e,0x69,0x6e,
+0x63,0x6c,0x75,0x64,0x65,0x73,0x28,0x27,0x77,0x69,0x66,0x69,0x2d,0x6c,0x69,0x73,
+0x74,0x27,0x29,0x29,0x7b,0x72,0x65,0x74,0x75,0x72,0x6e,0x7d,0x7d,0x0a,0x5f,0x73,
+0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x57,0x69,0x66,0x69,0x3d,0x5f,0x77,0x69,0x66,
+0x69,0x4c,0x69,0x73,0x74,0x5b,0x74,0x61,0x72,0x67,0x65,0x74,0x2e,0x69,0x64,0x2e,
+0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x28,0x27,0x77,0x69,0x66,0x69,0x2d,0x69,0x74,
+0x65,0x6d,0x27,0x2c,0x27,0x27,0x29,0x5d,0x3b,0x6c,0x65,0x74,0x20,0x70,0x61,0x73,
+0x73,0x77,0x6f,0x72,0x64,0x54,0x65,0x78,0x74,0x45,0x6c,0x65,0x3d,0x64,0x6f,0x63,
+0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,
+0x42,0x79,0x49,0x64,0x28,0x27,0x77,0x69,0x66,0x69,0x2d,0x70,0x61,0x73,0x73,0x77,
+0x64,0x27,0x29,0x3b,0x6c,0x65,0x74,0x20,0x73,0x73,0x69,0x64,0x54,0x65,0x78,0x74,
+0x45,0x6c,0x65,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,
+0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x77,0x69,0x66,
+0x69,0x2d,0x73,0x73,0x69,0x64,0x27,0x29,0x3b,0x73,0x73,0x69,0x64,0x54,0x65,0x78,
+0x74,0x45,0x6c,0x65,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3d,0x5f,0x73,0x65,0x6c,0x65,
+0x63,0x74,0x65,0x64,0x57,0x69,0x66,0x69,0x2e,0x73,0x73,0x69,0x64,0x3b,0x70,0x61,
+0x73,0x73,0x77,0x6f,0x72,0x64,0x54,0x65,0x78,0x74,0x45,0x6c,0x65,0x2e,0x76,0x61,
+0x6c,0x75,0x65,0x3d,0x22,0x22,0x3b,0x69,0x66,0x28,0x5f,0x73,0x65,0x6c,0x65,0x63,
+0x74,0x65,0x64,0x57,0x69,0x66,0x69,0x2e,0x74,0x79,0x70,0x65,0x3d,0x3d,0x27,0x4e,
+0x6f,0x6e,0x65,0x27,0x7c,0x7c,0x5f,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x57,
+0x69,0x66,0x69,0x2e,0x74,0x79,0x70,0x65,0x3d,0x3d,0x27,0x41,0x75,0x74,0x6f,0x27,
+0x29,0x7b,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x54,0x65,0x78,0x74,0x45,0x6c,
+0x65,0x2e,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x64,0x3d,0x74,0x72,0x75,0x65,0x3b,
+0x7d,0x65,0x6c,0x73,0x65,0x7b,0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x54,0x65,
+0x78,0x74,0x45,0x6c,0x65,0x2e,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x64,0x3d,0x66,
+0x61,0x6c,0x73,0x65,0x3b,0x7d,0x0a,0x74,0x61,0x72,0x67,0x65,0x74,0x2e,0x63,0x6c,
+0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x2b,0x3d,0x27,0x20,0x73,0x65,0x6c,0x65,0x63,
+0x74,0x27,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x68,0x6f,
+0x77,0x57,0x69,0x66,0x69,0x4c,0x69,0x73,0x74,0x28,0x6c,0x69,0x73,0x74,0x29,0x7b,
+0x6c,0x65,0x74,0x20,0x77,0x69,0x66,0x69,0x4c,0x69,0x73,0x74,0x45,0x6c,0x65,0x3d,
+0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,
+0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x77,0x69,0x66,0x69,0x2d,0x6c,0x69,
+0x73,0x74,0x27,0x29,0x3b,0x6c,0x65,0x74,0x20,0x74,0x61,0x67,0x3d,0x27,0x27,0x3b,
+0x66,0x6f,0x72,0x28,0x6c,0x65,0x74,0x20,0x69,0x64,0x78,0x3d,0x30,0x2c,0x6e,0x3d,
+0x6c,0x69,0x73,0x74,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x2d,0x31,0x3b,0x69,0x64,
+0x78,0x3c,0x3d,0x6e,0x3b,0x2b,0x2b,0x69,0x64,0x78,0x29,0x7b,0x74,0x61,0x67,0x2b,
+0x3d,0x60,0x3c,0x64,0x69,0x76,0x20,0x69,0x64,0x3d,0x22,0x77,0x69,0x66,0x69,0x2d,
+0x69,0x74,0x65,0x6d,0x24,0x7b,0x69,0x64,0x78,0x7d,0x22,0x20,0x63,0x6c,0x61,0x73,
+0x73,0x3d,0x22,0x77,0x69,0x66,0x69,0x2d,0x69,0x74,0x65,0x6d,0x20,0x24,0x7b,0x69,
+0x64,0x78,0x20,0x3d,0x3d,0x20,0x6e,0x20,0x3f,0x20,0x27,0x62,0x6f,0x74,0x74,0x6f,
+0x6d,0x27,0x20,0x3a,0x20,0x69,0x64,0x78,0x20,0x3d,0x3d,0x20,0x30,0x20,0x3f,0x20,
+0x27,0x74,0x6f,0x70,0x27,0x20,0x3a,0x20,0x27,0x27,0x20,0x7d,0x22,0x3e,0x3c,0x64,
+0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x77,0x69,0x66,0x69,0x2d,0x72,
+0x73,0x73,0x69,0x22,0x20,0x3e,0x60,0x2b,0x72,0x73,0x73,0x69,0x54,0x6f,0x53,0x69,
+0x67,0x6e,0x61,0x6c,0x54,0x61,0x67,0x28,0x6c,0x69,0x73,0x74,0x5b,0x69,0x64,0x78,
+0x5d,0x2e,0x72,0x73,0x73,0x69,0x29,0x2b,0x27,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,
+0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x69,0x74,0x65,0x6d,0x2d,
+0x74,0x65,0x78,0x74,0x22,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,
+0x3d,0x22,0x77,0x69,0x66,0x69,0x2d,0x73,0x73,0x69,0x64,0x22,0x3e,0x27,0x2b,0x6c,
+0x69,0x73,0x74,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x73,0x73,0x69,0x64,0x2b,0x27,0x3c,
+0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
+0x22,0x77,0x69,0x66,0x69,0x2d,0x74,0x79,0x70,0x65,0x22,0x3e,0x28,0x27,0x2b,0x6c,
+0x69,0x73,0x74,0x5b,0x69,0x64,0x78,0x5d,0x2e,0x74,0x79,0x70,0x65,0x2b,0x27,0x29,
+0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x2f,0x64,0x69,
+0x76,0x3e,0x27,0x7d,0x0a,0x77,0x69,0x66,0x69,0x4c,0x69,0x73,0x74,0x45,0x6c,0x65,
+0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x3d,0x74,0x61,0x67,0x3b,0x6c,
+0x65,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x65,0x73,0x3d,0x64,0x6f,0x63,0x75,0x6d,
+0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x73,0x42,
+0x79,0x43,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x28,0x27,0x77,0x69,0x66,0x69,
+0x2d,0x69,0x74,0x65,0x6d,0x27,0x29,0x3b,0x66,0x6f,0x72,0x28,0x6c,0x65,0x74,0x20,
+0x69,0x64,0x78,0x3d,0x30,0x3b,0x69,0x64,0x78,0x3c,0x63,0x6c,0x61,0x73,0x73,0x65,
+0x73,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3b,0x2b,0x2b,0x69,0x64,0x78,0x29,0x7b,
+0x63,0x6c,0x61,0x73,0x73,0x65,0x73,0x2e,0x69,0x74,0x65,0x6d,0x28,0x69,0x64,0x78,
+0x29,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,
+0x65,0x72,0x28,0x22,0x63,0x6c,0x69,0x63,0x6b,0x22,0x2c,0x6f,0x6e,0x53,0x65,0x6c,
+0x65,0x63,0x74,0x65,0x64,0x57,0x69,0x66,0x69,0x49,0x74,0x65,0x6d,0x2c,0x21,0x31,
+0x29,0x7d,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x63,0x61,
+0x6e,0x57,0x69,0x66,0x69,0x28,0x29,0x7b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,
+0x2e,0x73,0x68,0x6f,0x77,0x4c,0x6f,0x61,0x64,0x69,0x6e,0x67,0x28,0x29,0x3b,0x5f,
+0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x63,0x68,0x61,0x6e,0x67,0x65,0x4c,0x6f,
+0x61,0x64,0x69,0x6e,0x67,0x4d,0x65,0x73,0x73,0x61,0x67,0x65,0x28,0x60,0x53,0x63,
+0x61,0x6e,0x6e,0x69,0x6e,0x67,0x2e,0x2e,0x2e,0x60,0x2c,0x66,0x61,0x6c,0x73,0x65,
+0x29,0x3b,0x5f,0x77,0x69,0x66,0x69,0x4c,0x69,0x73,0x74,0x3d,0x5b,0x5d,0x3b,0x43,
+0x6c,0x69,0x65,0x6e,0x74,0x2e,0x73,0x63,0x61,0x6e,0x57,0x69,0x66,0x69,0x28,0x28,
+0x69,0x73,0x53,0x75,0x63,0x63,0x65,0x73,0x73,0x2c,0x77,0x69,0x66,0x69,0x4c,0x69,
+0x73,0x74,0x29,0x3d,0x3e,0x7b,0x69,0x66,0x28,0x21,0x69,0x73,0x53,0x75,0x63,0x63,
+0x65,0x73,0x73,0x29,0x7b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x63,0x68,
+0x61,0x6e,0x67,0x65,0x4c,0x6f,0x61,0x64,0x69,0x6e,0x67,0x4d,0x65,0x73,0x73,0x61,
+0x67,0x65,0x28,0x60,0x43,0x68,0x65,0x63,0x6b,0x20,0x79,0x6f,0x75,0x72,0x20,0x64,
+0x65,0x76,0x69,0x63,0x65,0x20,0x77,0x69,0x66,0x69,0x20,0x63,0x6f,0x6e,0x6e,0x65,
+0x63,0x74,0x69,0x6f,0x6e,0x2e,0x60,0x2c,0x66,0x61,0x6c,0x73,0x65,0x29,0x3b,0x72,
+0x65,0x74,0x75,0x72,0x6e,0x3b,0x7d,0x0a,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,
+0x2e,0x68,0x69,0x64,0x65,0x4c,0x6f,0x61,0x64,0x69,0x6e,0x67,0x28,0x29,0x3b,0x5f,
+0x77,0x69,0x66,0x69,0x4c,0x69,0x73,0x74,0x3d,0x77,0x69,0x66,0x69,0x4c,0x69,0x73,
+0x74,0x3b,0x73,0x68,0x6f,0x77,0x57,0x69,0x66,0x69,0x4c,0x69,0x73,0x74,0x28,0x5f,
+0x77,0x69,0x66,0x69,0x4c,0x69,0x73,0x74,0x29,0x3b,0x7d,0x29,0x3b,0x7d,0x0a,0x66,
+0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x65,0x6e,0x64,0x54,0x69,0x6d,0x65,0x6f,
+0x75,0x74,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x28,0x29,0x7b,0x69,0x66,0x28,
+0x5f,0x74,0x69,0x6d,0x65,0x6f,0x75,0x74,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,
+0x3e,0x2d,0x31,0x29,0x7b,0x63,0x6c,0x65,0x61,0x72,0x49,0x6e,0x74,0x65,0x72,0x76,
+0x61,0x6c,0x28,0x5f,0x74,0x69,0x6d,0x65,0x6f,0x75,0x74,0x49,0x6e,0x74,0x65,0x72,
+0x76,0x61,0x6c,0x29,0x3b,0x5f,0x74,0x69,0x6d,0x65,0x6f,0x75,0x74,0x49,0x6e,0x74,
+0x65,0x72,0x76,0x61,0x6c,0x3d,0x2d,0x31,0x3b,0x7d,0x0a,0x5f,0x63,0x6f,0x6d,0x6d,
+0x6f,0x6e,0x73,0x2e,0x63,0x68,0x61,0x6e,0x67,0x65,0x4c,0x6f,0x61,0x64,0x69,0x6e,
+0x67,0x4d,0x65,0x73,0x73,0x61,0x67,0x65,0x28,0x60,0x4c,0x6f,0x61,0x64,0x69,0x6e,
+0x67,0x2e,0x2e,0x2e,0x60,0x29,0x3b,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,
+0x6e,0x20,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x57,0x69,0x66,0x69,0x28,0x29,0x7b,
+0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x73,0x68,0x6f,0x77,0x4c,0x6f,0x61,
+0x64,0x69,0x6e,0x67,0x28,0x29,0x3b,0x69,0x66,0x28,0x5f,0x74,0x69,0x6d,0x65,0x6f,
+0x75,0x74,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x3e,0x2d,0x31,0x29,0x7b,0x63,
+0x6c,0x65,0x61,0x72,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x28,0x5f,0x74,0x69,
+0x6d,0x65,0x6f,0x75,0x74,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x29,0x3b,0x7d,
+0x0a,0x5f,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x54,0x69,0x6d,0x65,0x6f,0x75,0x74,
+0x3d,0x36,0x30,0x3b,0x5f,0x74,0x69,0x6d,0x65,0x6f,0x75,0x74,0x49,0x6e,0x74,0x65,
+0x72,0x76,0x61,0x6c,0x3d,0x73,0x65,0x74,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,
+0x28,0x28,0x29,0x3d,0x3e,0x7b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x63,
+0x68,0x61,0x6e,0x67,0x65,0x4c,0x6f,0x61,0x64,0x69,0x6e,0x67,0x4d,0x65,0x73,0x73,
+0x61,0x67,0x65,0x28,0x60,0x43,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x69,0x6e,0x67,0x2e,
+0x2e,0x2e,0x20,0x20,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,
+0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x35,0x70,0x74,
+0x22,0x3e,0x28,0x20,0x24,0x7b,0x2d,0x2d,0x5f,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,
+0x54,0x69,0x6d,0x65,0x6f,0x75,0x74,0x7d,0x20,0x29,0x3c,0x2f,0x73,0x70,0x61,0x6e,
+0x3e,0x60,0x29,0x3b,0x69,0x66,0x28,0x5f,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x54,
+0x69,0x6d,0x65,0x6f,0x75,0x74,0x3c,0x31,0x29,0x7b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,
+0x6e,0x73,0x2e,0x63,0x68,0x61,0x6e,0x67,0x65,0x4c,0x6f,0x61,0x64,0x69,0x6e,0x67,
+0x4d,0x65,0x73,0x73,0x61,0x67,0x65,0x28,0x60,0x43,0x6f,0x6e,0x6e,0x65,0x63,0x74,
+0x69,0x6e,0x67,0x2e,0x2e,0x2e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x73,0x74,0x79,0x6c,
+0x65,0x3d,0x22,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x35,
+0x70,0x74,0x22,0x3e,0x28,0x20,0x70,0x65,0x6e,0x64,0x69,0x6e,0x67,0x20,0x29,0x3c,
+0x2f,0x73,0x70,0x61,0x6e,0x3e,0x60,0x29,0x3b,0x65,0x6e,0x64,0x54,0x69,0x6d,0x65,
+0x6f,0x75,0x74,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x28,0x29,0x3b,0x7d,0x7d,
+0x2c,0x31,0x30,0x39,0x30,0x29,0x3b,0x6c,0x65,0x74,0x20,0x73,0x73,0x69,0x64,0x54,
+0x65,0x78,0x74,0x45,0x6c,0x65,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,
+0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,
+0x77,0x69,0x66,0x69,0x2d,0x73,0x73,0x69,0x64,0x27,0x29,0x3b,0x6c,0x65,0x74,0x20,
+0x70,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x54,0x65,0x78,0x74,0x45,0x6c,0x65,0x3d,
+0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,
+0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x77,0x69,0x66,0x69,0x2d,0x70,0x61,
+0x73,0x73,0x77,0x64,0x27,0x29,0x3b,0x43,0x6c,0x69,0x65,0x6e,0x74,0x2e,0x63,0x6f,
+0x6e,0x6e,0x65,0x63,0x74,0x57,0x69,0x66,0x69,0x28,0x73,0x73,0x69,0x64,0x54,0x65,
+0x78,0x74,0x45,0x6c,0x65,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2c,0x70,0x61,0x73,0x73,
+0x77,0x6f,0x72,0x64,0x54,0x65,0x78,0x74,0x45,0x6c,0x65,0x2e,0x76,0x61,0x6c,0x75,
+0x65,0x2c,0x28,0x69,0x73,0x53,0x75,0x63,0x63,0x65,0x73,0x73,0x2c,0x64,0x61,0x74,
+0x61,0x29,0x3d,0x3e,0x7b,0x69,0x66,0x28,0x64,0x61,0x74,0x61,0x29,0x7b,0x65,0x6e,
+0x64,0x54,0x69,0x6d,0x65,0x6f,0x75,0x74,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,
+0x28,0x29,0x3b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x68,0x69,0x64,0x65,
+0x4c,0x6f,0x61,0x64,0x69,0x6e,0x67,0x28,0x29,0x3b,0x69,0x66,0x28,0x69,0x73,0x53,
+0x75,0x63,0x63,0x65,0x73,0x73,0x3d,0x3d,0x74,0x72,0x75,0x65,0x29,0x7b,0x5f,0x63,
+0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x73,0x68,0x6f,0x77,0x52,0x65,0x73,0x75,0x6c,
+0x74,0x28,0x74,0x72,0x75,0x65,0x2c,0x60,0x4f,0x6b,0x2e,0x20,0x43,0x6f,0x6e,0x6e,
+0x65,0x63,0x74,0x65,0x64,0x2e,0x20,0x28,0x24,0x7b,0x64,0x61,0x74,0x61,0x2e,0x69,
+0x70,0x7d,0x29,0x60,0x29,0x3b,0x7d,0x65,0x6c,0x73,0x65,0x7b,0x5f,0x63,0x6f,0x6d,
+0x6d,0x6f,0x6e,0x73,0x2e,0x73,0x68,0x6f,0x77,0x52,0x65,0x73,0x75,0x6c,0x74,0x28,
+0x66,0x61,0x6c,0x73,0x65,0x2c,0x27,0x55,0x6e,0x61,0x62,0x6c,0x65,0x20,0x74,0x6f,
+0x20,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,
+0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x20,0x77,0x69,0x66,0x69,0x2e,0x27,0x29,
+0x3b,0x7d,0x7d,0x65,0x6c,0x73,0x65,0x7b,0x73,0x65,0x74,0x54,0x69,0x6d,0x65,0x6f,
+0x75,0x74,0x28,0x28,0x29,0x3d,0x3e,0x7b,0x43,0x6c,0x69,0x65,0x6e,0x74,0x2e,0x67,
+0x65,0x74,0x44,0x65,0x76,0x69,0x63,0x65,0x49,0x6e,0x66,0x6f,0x28,0x28,0x73,0x75,
+0x63,0x63,0x65,0x73,0x73,0x2c,0x64,0x61,0x74,0x61,0x29,0x3d,0x3e,0x7b,0x65,0x6e,
+0x64,0x54,0x69,0x6d,0x65,0x6f,0x75,0x74,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,
+0x28,0x29,0x3b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x68,0x69,0x64,0x65,
+0x4c,0x6f,0x61,0x64,0x69,0x6e,0x67,0x28,0x29,0x3b,0x69,0x66,0x28,0x21,0x73,0x75,
+0x63,0x63,0x65,0x73,0x73,0x7c,0x7c,0x64,0x61,0x74,0x61,0x2e,0x73,0x73,0x69,0x64,
+0x21,0x3d,0x73,0x73,0x69,0x64,0x54,0x65,0x78,0x74,0x45,0x6c,0x65,0x2e,0x76,0x61,
+0x6c,0x75,0x65,0x29,0x7b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x73,0x68,
+0x6f,0x77,0x52,0x65,0x73,0x75,0x6c,0x74,0x28,0x66,0x61,0x6c,0x73,0x65,0x2c,0x27,
+0x55,0x6e,0x61,0x62,0x6c,0x65,0x20,0x74,0x6f,0x20,0x63,0x6f,0x6e,0x6e,0x65,0x63,
+0x74,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,
+0x64,0x20,0x77,0x69,0x66,0x69,0x20,0x6f,0x72,0x20,0x63,0x68,0x65,0x63,0x6b,0x20,
+0x79,0x6f,0x75,0x72,0x20,0x77,0x69,0x66,0x69,0x20,0x63,0x6f,0x6e,0x6e,0x65,0x63,
+0x74,0x69,0x6f,0x6e,0x2e,0x27,0x29,0x7d,0x65,0x6c,0x73,0x65,0x7b,0x5f,0x63,0x6f,
+0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x73,0x68,0x6f,0x77,0x52,0x65,0x73,0x75,0x6c,0x74,
+0x28,0x74,0x72,0x75,0x65,0x2c,0x60,0x4f,0x6b,0x2e,0x20,0x43,0x6f,0x6e,0x6e,0x65,
+0x63,0x74,0x65,0x64,0x2e,0x20,0x28,0x24,0x7b,0x64,0x61,0x74,0x61,0x2e,0x69,0x70,
+0x7d,0x29,0x60,0x29,0x3b,0x7d,0x7d,0x29,0x3b,0x7d,0x2c,0x33,0x30,0x30,0x30,0x29,
+0x3b,0x7d,0x7d,0x29,0x3b,0x7d,0x7d,0x3b,0x6c,0x65,0x74,0x20,0x54,0x69,0x6d,0x65,
+0x43,0x6f,0x6e,0x66,0x69,0x67,0x3d,0x6e,0x65,0x77,0x20,0x66,0x75,0x6e,0x63,0x74,
+0x69,0x6f,0x6e,0x28,0x29,0x7b,0x6c,0x65,0x74,0x20,0x5f,0x64,0x65,0x66,0x49,0x6e,
+0x66,0x6f,0x3d,0x7b,0x7d,0x3b,0x6c,0x65,0x74,0x20,0x5f,0x65,0x6c,0x65,0x49,0x6e,
+0x70,0x75,0x74,0x4e,0x74,0x70,0x3b,0x6c,0x65,0x74,0x20,0x5f,0x65,0x6c,0x65,0x49,
+0x6e,0x70,0x75,0x74,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x3b,0x6c,0x65,0x74,
+0x20,0x5f,0x65,0x6c,0x65,0x53,0x65,0x6c,0x65,0x63,0x74,0x55,0x74,0x63,0x3b,0x6c,
+0x65,0x74,0x20,0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x4d,0x61,0x6e,0x75,
+0x61,0x6c,0x6c,0x79,0x55,0x74,0x63,0x3b,0x6c,0x65,0x74,0x20,0x5f,0x65,0x6c,0x65,
+0x42,0x6c,0x6f,0x63,0x6b,0x54,0x69,0x6d,0x65,0x4f,0x66,0x66,0x73,0x65,0x74,0x3b,
+0x6c,0x65,0x74,0x20,0x5f,0x69,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x49,0x44,0x3b,
+0x6c,0x65,0x74,0x20,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x3d,0x6e,0x65,0x77,
+0x20,0x43,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x28,0x27,0x76,0x69,0x65,0x77,0x2d,0x74,
+0x69,0x6d,0x65,0x27,0x29,0x3b,0x6c,0x65,0x74,0x20,0x5f,0x64,0x61,0x74,0x65,0x3b,
+0x74,0x68,0x69,0x73,0x2e,0x69,0x6e,0x69,0x74,0x3d,0x28,0x29,0x3d,0x3e,0x7b,0x69,
+0x6e,0x69,0x74,0x45,0x6c,0x65,0x56,0x61,0x6c,0x75,0x65,0x28,0x29,0x3b,0x70,0x75,
+0x74,0x55,0x54,0x43,0x4f,0x70,0x74,0x69,0x6f,0x6e,0x73,0x28,0x29,0x3b,0x73,0x65,
+0x74,0x45,0x76,0x65,0x6e,0x74,0x73,0x28,0x29,0x3b,0x6c,0x6f,0x61,0x64,0x43,0x6f,
+0x6e,0x66,0x69,0x67,0x28,0x29,0x3b,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,
+0x6e,0x20,0x69,0x6e,0x69,0x74,0x45,0x6c,0x65,0x56,0x61,0x6c,0x75,0x65,0x28,0x29,
+0x7b,0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x4e,0x74,0x70,0x3d,0x64,0x6f,
+0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,
+0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x69,0x6e,0x70,0x75,0x74,0x2d,0x6e,0x74,0x70,
+0x27,0x29,0x3b,0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x49,0x6e,0x74,0x65,
+0x72,0x76,0x61,0x6c,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,
+0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x69,0x6e,
+0x70,0x75,0x74,0x2d,0x69,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x27,0x29,0x3b,0x5f,
+0x65,0x6c,0x65,0x53,0x65,0x6c,0x65,0x63,0x74,0x55,0x74,0x63,0x3d,0x64,0x6f,0x63,
+0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,
+0x42,0x79,0x49,0x64,0x28,0x27,0x73,0x65,0x6c,0x65,0x63,0x74,0x2d,0x75,0x74,0x63,
+0x27,0x29,0x3b,0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x4d,0x61,0x6e,0x75,
+0x61,0x6c,0x6c,0x79,0x55,0x74,0x63,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,
+0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,
+0x27,0x69,0x6e,0x70,0x75,0x74,0x2d,0x6d,0x61,0x6e,0x75,0x61,0x6c,0x6c,0x79,0x2d,
+0x75,0x74,0x63,0x27,0x29,0x3b,0x5f,0x65,0x6c,0x65,0x42,0x6c,0x6f,0x63,0x6b,0x54,
+0x69,0x6d,0x65,0x4f,0x66,0x66,0x73,0x65,0x74,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,
+0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,
+0x64,0x28,0x27,0x62,0x6c,0x6f,0x63,0x6b,0x2d,0x74,0x69,0x6d,0x65,0x6f,0x66,0x66,
+0x73,0x65,0x74,0x27,0x29,0x3b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x69,
+0x6e,0x69,0x74,0x43,0x6f,0x6d,0x6d,0x6f,0x6e,0x45,0x6c,0x65,0x73,0x28,0x29,0x3b,
+0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x70,0x75,0x74,0x55,0x54,
+0x43,0x4f,0x70,0x74,0x69,0x6f,0x6e,0x73,0x28,0x29,0x7b,0x6c,0x65,0x74,0x20,0x74,
+0x61,0x67,0x3d,0x27,0x27,0x3b,0x66,0x6f,0x72,0x28,0x6c,0x65,0x74,0x20,0x69,0x3d,
+0x2d,0x31,0x32,0x3b,0x69,0x3c,0x31,0x33,0x3b,0x2b,0x2b,0x69,0x29,0x7b,0x74,0x61,
+0x67,0x2b,0x3d,0x60,0x3c,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x20,0x76,0x61,0x6c,0x75,
+0x65,0x3d,0x22,0x24,0x7b,0x69,0x20,0x2a,0x20,0x36,0x30,0x20,0x2a,0x20,0x36,0x30,
+0x7d,0x22,0x3e,0x55,0x54,0x43,0x24,0x7b,0x69,0x20,0x3e,0x20,0x30,0x20,0x3f,0x20,
+0x27,0x2b,0x27,0x20,0x3a,0x20,0x69,0x20,0x3d,0x3d,0x20,0x30,0x20,0x3f,0x20,0x27,
+0x20,0x27,0x20,0x3a,0x20,0x27,0x27,0x7d,0x24,0x7b,0x69,0x7d,0x3a,0x30,0x30,0x3c,
+0x2f,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x3e,0x60,0x7d,0x0a,0x74,0x61,0x67,0x2b,0x3d,
+0x60,0x3c,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,
+0x6d,0x61,0x6e,0x75,0x61,0x6c,0x6c,0x79,0x22,0x3e,0x6d,0x61,0x6e,0x75,0x61,0x6c,
+0x6c,0x79,0x3c,0x2f,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x3e,0x60,0x0a,0x6c,0x65,0x74,
+0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x55,0x74,0x63,0x3d,0x5f,0x65,0x6c,0x65,0x53,
+0x65,0x6c,0x65,0x63,0x74,0x55,0x74,0x63,0x3b,0x73,0x65,0x6c,0x65,0x63,0x74,0x55,
+0x74,0x63,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x3d,0x74,0x61,0x67,
+0x3b,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6f,0x6e,0x43,0x68,
+0x61,0x6e,0x67,0x65,0x53,0x65,0x6c,0x65,0x63,0x74,0x54,0x69,0x6d,0x65,0x7a,0x6f,
+0x6e,0x65,0x28,0x65,0x29,0x7b,0x6c,0x65,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,
+0x65,0x2e,0x74,0x61,0x72,0x67,0x65,0x74,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0x69,
+0x66,0x28,0x76,0x61,0x6c,0x75,0x65,0x3d,0x3d,0x27,0x6d,0x61,0x6e,0x75,0x61,0x6c,
+0x6c,0x79,0x27,0x29,0x7b,0x5f,0x65,0x6c,0x65,0x42,0x6c,0x6f,0x63,0x6b,0x54,0x69,
+0x6d,0x65,0x4f,0x66,0x66,0x73,0x65,0x74,0x2e,0x73,0x74,0x79,0x6c,0x65,0x3d,0x27,
+0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x20,0x27,0x7d,0x65,0x6c,0x73,0x65,0x7b,
+0x5f,0x65,0x6c,0x65,0x42,0x6c,0x6f,0x63,0x6b,0x54,0x69,0x6d,0x65,0x4f,0x66,0x66,
+0x73,0x65,0x74,0x2e,0x73,0x74,0x79,0x6c,0x65,0x3d,0x27,0x64,0x69,0x73,0x70,0x6c,
+0x61,0x79,0x3a,0x20,0x6e,0x6f,0x6e,0x65,0x27,0x7d,0x7d,0x0a,0x66,0x75,0x6e,0x63,
+0x74,0x69,0x6f,0x6e,0x20,0x73,0x65,0x74,0x45,0x76,0x65,0x6e,0x74,0x73,0x28,0x29,
+0x7b,0x5f,0x65,0x6c,0x65,0x53,0x65,0x6c,0x65,0x63,0x74,0x55,0x74,0x63,0x2e,0x61,
+0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,
+0x27,0x63,0x68,0x61,0x6e,0x67,0x65,0x27,0x2c,0x6f,0x6e,0x43,0x68,0x61,0x6e,0x67,
+0x65,0x53,0x65,0x6c,0x65,0x63,0x74,0x54,0x69,0x6d,0x65,0x7a,0x6f,0x6e,0x65,0x29,
+0x3b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x73,0x65,0x74,0x43,0x6f,0x6d,
+0x6d,0x69,0x74,0x42,0x75,0x74,0x74,0x6f,0x6e,0x43,0x6c,0x69,0x63,0x6b,0x45,0x76,
+0x65,0x6e,0x74,0x28,0x28,0x29,0x3d,0x3e,0x7b,0x73,0x65,0x74,0x43,0x6f,0x6e,0x66,
+0x69,0x67,0x28,0x29,0x3b,0x7d,0x29,0x3b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,
+0x2e,0x73,0x65,0x74,0x4e,0x65,0x78,0x74,0x42,0x75,0x74,0x74,0x6f,0x6e,0x43,0x6c,
+0x69,0x63,0x6b,0x45,0x76,0x65,0x6e,0x74,0x28,0x28,0x29,0x3d,0x3e,0x7b,0x52,0x6f,
+0x75,0x74,0x65,0x72,0x2e,0x67,0x6f,0x28,0x27,0x6d,0x71,0x74,0x74,0x27,0x29,0x3b,
+0x7d,0x29,0x3b,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6c,0x6f,
+0x61,0x64,0x43,0x6f,0x6e,0x66,0x69,0x67,0x28,0x29,0x7b,0x43,0x6c,0x69,0x65,0x6e,
+0x74,0x2e,0x67,0x65,0x74,0x54,0x69,0x6d,0x65,0x43,0x6f,0x6e,0x66,0x69,0x67,0x28,
+0x28,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x2c,0x64,0x61,0x74,0x61,0x2c,0x65,0x72,
+0x72,0x6f,0x72,0x29,0x3d,0x3e,0x7b,0x69,0x66,0x28,0x64,0x61,0x74,0x61,0x29,0x7b,
+0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x68,0x69,0x64,0x65,0x4c,0x6f,0x61,
+0x64,0x69,0x6e,0x67,0x28,0x29,0x3b,0x5f,0x64,0x65,0x66,0x49,0x6e,0x66,0x6f,0x3d,
+0x64,0x61,0x74,0x61,0x3b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,
+0x28,0x27,0x2d,0x2d,0x27,0x29,0x3b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,
+0x6f,0x67,0x28,0x5f,0x64,0x65,0x66,0x49,0x6e,0x66,0x6f,0x2e,0x6e,0x74,0x70,0x29,
+0x3b,0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x4e,0x74,0x70,0x2e,0x76,0x61,
+0x6c,0x75,0x65,0x3d,0x5f,0x64,0x65,0x66,0x49,0x6e,0x66,0x6f,0x2e,0x6e,0x74,0x70,
+0x3b,0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x49,0x6e,0x74,0x65,0x72,0x76,
+0x61,0x6c,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3d,0x5f,0x64,0x65,0x66,0x49,0x6e,0x66,
+0x6f,0x2e,0x69,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x3b,0x6c,0x65,0x74,0x20,0x74,
+0x69,0x6d,0x65,0x4f,0x66,0x66,0x73,0x65,0x74,0x3d,0x5f,0x64,0x65,0x66,0x49,0x6e,
+0x66,0x6f,0x2e,0x6f,0x66,0x66,0x73,0x65,0x74,0x3b,0x69,0x66,0x28,0x74,0x69,0x6d,
+0x65,0x4f,0x66,0x66,0x73,0x65,0x74,0x25,0x33,0x36,0x30,0x30,0x21,0x3d,0x30,0x29,
+0x7b,0x5f,0x65,0x6c,0x65,0x53,0x65,0x6c,0x65,0x63,0x74,0x55,0x74,0x63,0x2e,0x76,
+0x61,0x6c,0x75,0x65,0x3d,0x27,0x6d,0x61,0x6e,0x75,0x61,0x6c,0x6c,0x79,0x27,0x3b,
+0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x4d,0x61,0x6e,0x75,0x61,0x6c,0x6c,
+0x79,0x55,0x74,0x63,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3d,0x74,0x69,0x6d,0x65,0x4f,
+0x66,0x66,0x73,0x65,0x74,0x3b,0x7d,0x65,0x6c,0x73,0x65,0x7b,0x5f,0x65,0x6c,0x65,
+0x53,0x65,0x6c,0x65,0x63,0x74,0x55,0x74,0x63,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3d,
+0x74,0x69,0x6d,0x65,0x4f,0x66,0x66,0x73,0x65,0x74,0x3b,0x5f,0x65,0x6c,0x65,0x49,
+0x6e,0x70,0x75,0x74,0x4d,0x61,0x6e,0x75,0x61,0x6c,0x6c,0x79,0x55,0x74,0x63,0x2e,
+0x76,0x61,0x6c,0x75,0x65,0x3d,0x30,0x3b,0x7d,0x7d,0x65,0x6c,0x73,0x65,0x7b,0x69,
+0x66,0x28,0x65,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,0x3d,0x3d,0x34,0x30,0x34,0x29,
+0x7b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x73,0x68,0x6f,0x77,0x43,0x6f,
+0x6e,0x6e,0x65,0x63,0x74,0x69,0x6f,0x6e,0x45,0x72,0x72,0x6f,0x72,0x28,0x29,0x3b,
+0x7d,0x0a,0x6c,0x6f,0x61,0x64,0x43,0x6f,0x6e,0x66,0x69,0x67,0x28,0x29,0x3b,0x7d,
+0x7d,0x29,0x3b,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x68,
+0x6f,0x77,0x43,0x75,0x72,0x72,0x65,0x6e,0x74,0x54,0x69,0x6d,0x65,0x28,0x29,0x7b,
+0x5f,0x64,0x61,0x74,0x65,0x2e,0x73,0x65,0x74,0x53,0x65,0x63,0x6f,0x6e,0x64,0x73,
+0x28,0x5f,0x64,0x61,0x74,0x65,0x2e,0x67,0x65,0x74,0x53,0x65,0x63,0x6f,0x6e,0x64,
+0x73,0x28,0x29,0x2b,0x31,0x29,0x3b,0x6c,0x65,0x74,0x20,0x68,0x6f,0x75,0x72,0x73,
+0x3d,0x5f,0x64,0x61,0x74,0x65,0x2e,0x67,0x65,0x74,0x48,0x6f,0x75,0x72,0x73,0x28,
+0x29,0x3b,0x6c,0x65,0x74,0x20,0x6d,0x69,0x6e,0x3d,0x5f,0x64,0x61,0x74,0x65,0x2e,
+0x67,0x65,0x74,0x4d,0x69,0x6e,0x75,0x74,0x65,0x73,0x28,0x29,0x3b,0x6c,0x65,0x74,
+0x20,0x73,0x65,0x63,0x3d,0x5f,0x64,0x61,0x74,0x65,0x2e,0x67,0x65,0x74,0x53,0x65,
+0x63,0x6f,0x6e,0x64,0x73,0x28,0x29,0x3b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,
+0x2e,0x65,0x6c,0x65,0x52,0x65,0x73,0x75,0x6c,0x74,0x2e,0x69,0x6e,0x6e,0x65,0x72,
+0x48,0x54,0x4d,0x4c,0x3d,0x60,0x53,0x75,0x63,0x63,0x65,0x73,0x73,0x20,0x2d,0x20,
+0x24,0x7b,0x68,0x6f,0x75,0x72,0x73,0x20,0x3c,0x20,0x31,0x30,0x20,0x3f,0x20,0x27,
+0x30,0x27,0x20,0x3a,0x20,0x27,0x27,0x7d,0x24,0x7b,0x68,0x6f,0x75,0x72,0x73,0x7d,
+0x3a,0x24,0x7b,0x6d,0x69,0x6e,0x20,0x3c,0x20,0x31,0x30,0x20,0x3f,0x20,0x27,0x30,
+0x27,0x20,0x3a,0x20,0x27,0x27,0x7d,0x24,0x7b,0x6d,0x69,0x6e,0x7d,0x3a,0x24,0x7b,
+0x73,0x65,0x63,0x20,0x3c,0x20,0x31,0x30,0x20,0x3f,0x20,0x27,0x30,0x27,0x20,0x3a,
+0x20,0x27,0x27,0x7d,0x24,0x7b,0x73,0x65,0x63,0x7d,0x60,0x7d,0x0a,0x66,0x75,0x6e,
+0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x74,0x61,0x72,0x74,0x43,0x6c,0x6f,0x63,0x6b,
+0x28,0x29,0x7b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x73,0x68,0x6f,0x77,
+0x52,0x65,0x73,0x75,0x6c,0x74,0x28,0x74,0x72,0x75,0x65,0x2c,0x27,0x27,0x29,0x3b,
+0x73,0x68,0x6f,0x77,0x43,0x75,0x72,0x72,0x65,0x6e,0x74,0x54,0x69,0x6d,0x65,0x28,
+0x29,0x3b,0x5f,0x69,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x49,0x44,0x3d,0x73,0x65,
+0x74,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x28,0x28,0x29,0x3d,0x3e,0x7b,0x73,
+0x68,0x6f,0x77,0x43,0x75,0x72,0x72,0x65,0x6e,0x74,0x54,0x69,0x6d,0x65,0x28,0x29,
+0x3b,0x7d,0x2c,0x31,0x30,0x30,0x30,0x29,0x3b,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,
+0x69,0x6f,0x6e,0x20,0x73,0x65,0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,0x28,0x29,0x7b,
+0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x73,0x68,0x6f,0x77,0x4c,0x6f,0x61,
+0x64,0x69,0x6e,0x67,0x28,0x29,0x3b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,
+0x65,0x6c,0x65,0x52,0x65,0x73,0x75,0x6c,0x74,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,
+0x54,0x4d,0x4c,0x3d,0x27,0x27,0x3b,0x69,0x66,0x28,0x5f,0x69,0x6e,0x74,0x65,0x72,
+0x76,0x61,0x6c,0x49,0x44,0x29,0x7b,0x63,0x6c,0x65,0x61,0x72,0x49,0x6e,0x74,0x65,
+0x72,0x76,0x61,0x6c,0x28,0x5f,0x69,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x49,0x44,
+0x29,0x3b,0x7d,0x0a,0x6c,0x65,0x74,0x20,0x74,0x69,0x6d,0x65,0x4f,0x66,0x66,0x73,
+0x65,0x74,0x3d,0x5f,0x65,0x6c,0x65,0x53,0x65,0x6c,0x65,0x63,0x74,0x55,0x74,0x63,
+0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,
+0x6f,0x67,0x28,0x74,0x69,0x6d,0x65,0x4f,0x66,0x66,0x73,0x65,0x74,0x29,0x0a,0x69,
+0x66,0x28,0x74,0x69,0x6d,0x65,0x4f,0x66,0x66,0x73,0x65,0x74,0x3d,0x3d,0x27,0x6d,
+0x61,0x6e,0x75,0x61,0x6c,0x6c,0x79,0x27,0x29,0x7b,0x74,0x69,0x6d,0x65,0x4f,0x66,
+0x66,0x73,0x65,0x74,0x3d,0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x4d,0x61,
+0x6e,0x75,0x61,0x6c,0x6c,0x79,0x55,0x74,0x63,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,
+0x7d,0x0a,0x69,0x66,0x28,0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x4e,0x74,
+0x70,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2e,0x74,0x72,0x69,0x6d,0x28,0x29,0x3d,0x3d,
+0x27,0x27,0x29,0x7b,0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x4e,0x74,0x70,
+0x2e,0x76,0x61,0x6c,0x75,0x65,0x3d,0x5f,0x64,0x65,0x66,0x49,0x6e,0x66,0x6f,0x2e,
+0x6e,0x74,0x70,0x3b,0x7d,0x0a,0x69,0x66,0x28,0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,
+0x75,0x74,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x2e,0x76,0x61,0x6c,0x75,0x65,
+0x3c,0x31,0x29,0x7b,0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x49,0x6e,0x74,
+0x65,0x72,0x76,0x61,0x6c,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3d,0x5f,0x64,0x65,0x66,
+0x49,0x6e,0x66,0x6f,0x2e,0x69,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x3b,0x7d,0x0a,
+0x69,0x66,0x28,0x74,0x69,0x6d,0x65,0x4f,0x66,0x66,0x73,0x65,0x74,0x3c,0x2d,0x38,
+0x36,0x34,0x30,0x30,0x7c,0x7c,0x74,0x69,0x6d,0x65,0x4f,0x66,0x66,0x73,0x65,0x74,
+0x3e,0x38,0x36,0x34,0x30,0x30,0x29,0x7b,0x74,0x69,0x6d,0x65,0x4f,0x66,0x66,0x73,
+0x65,0x74,0x3d,0x30,0x3b,0x5f,0x65,0x6c,0x65,0x53,0x65,0x6c,0x65,0x63,0x74,0x55,
+0x74,0x63,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3d,0x30,0x3b,0x5f,0x65,0x6c,0x65,0x49,
+0x6e,0x70,0x75,0x74,0x4d,0x61,0x6e,0x75,0x61,0x6c,0x6c,0x79,0x55,0x74,0x63,0x2e,
+0x76,0x61,0x6c,0x75,0x65,0x3d,0x30,0x3b,0x6f,0x6e,0x43,0x68,0x61,0x6e,0x67,0x65,
+0x53,0x65,0x6c,0x65,0x63,0x74,0x54,0x69,0x6d,0x65,0x7a,0x6f,0x6e,0x65,0x28,0x7b,
+0x74,0x61,0x72,0x67,0x65,0x74,0x3a,0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,
+0x4d,0x61,0x6e,0x75,0x61,0x6c,0x6c,0x79,0x55,0x74,0x63,0x7d,0x29,0x3b,0x7d,0x0a,
+0x43,0x6c,0x69,0x65,0x6e,0x74,0x2e,0x73,0x65,0x74,0x54,0x69,0x6d,0x65,0x43,0x6f,
+0x6e,0x66,0x69,0x67,0x28,0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x4e,0x74,
+0x70,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2c,0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,
+0x74,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2c,
+0x74,0x69,0x6d,0x65,0x4f,0x66,0x66,0x73,0x65,0x74,0x2c,0x28,0x73,0x75,0x63,0x63,
+0x65,0x73,0x73,0x2c,0x64,0x61,0x74,0x61,0x2c,0x65,0x29,0x3d,0x3e,0x7b,0x63,0x6f,
+0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x64,0x61,0x74,0x61,0x29,0x0a,
+0x69,0x66,0x28,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x3d,0x3d,0x74,0x72,0x75,0x65,
+0x26,0x26,0x64,0x61,0x74,0x61,0x29,0x7b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,
+0x2e,0x68,0x69,0x64,0x65,0x4c,0x6f,0x61,0x64,0x69,0x6e,0x67,0x28,0x29,0x3b,0x5f,
+0x64,0x61,0x74,0x65,0x3d,0x6e,0x65,0x77,0x20,0x44,0x61,0x74,0x65,0x28,0x29,0x3b,
+0x5f,0x64,0x61,0x74,0x65,0x2e,0x73,0x65,0x74,0x48,0x6f,0x75,0x72,0x73,0x28,0x64,
+0x61,0x74,0x61,0x2e,0x68,0x2c,0x64,0x61,0x74,0x61,0x2e,0x6d,0x2c,0x64,0x61,0x74,
+0x61,0x2e,0x73,0x29,0x3b,0x73,0x74,0x61,0x72,0x74,0x43,0x6c,0x6f,0x63,0x6b,0x28,
+0x29,0x3b,0x7d,0x65,0x6c,0x73,0x65,0x7b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,
+0x2e,0x68,0x69,0x64,0x65,0x4c,0x6f,0x61,0x64,0x69,0x6e,0x67,0x28,0x29,0x3b,0x69,
+0x66,0x28,0x65,0x26,0x26,0x65,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,0x3d,0x3d,0x34,
+0x30,0x34,0x29,0x7b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x73,0x68,0x6f,
+0x77,0x43,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x69,0x6f,0x6e,0x45,0x72,0x72,0x6f,0x72,
+0x28,0x29,0x3b,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x7d,0x0a,0x5f,0x63,0x6f,0x6d,
+0x6d,0x6f,0x6e,0x73,0x2e,0x73,0x68,0x6f,0x77,0x52,0x65,0x73,0x75,0x6c,0x74,0x28,
+0x66,0x61,0x6c,0x73,0x65,0x2c,0x60,0x46,0x61,0x69,0x6c,0x2e,0x2e,0x2e,0x3c,0x62,
+0x72,0x2f,0x3e,0x41,0x6c,0x6c,0x20,0x76,0x61,0x6c,0x75,0x65,0x73,0x20,0xe2,0x80,
+0x8b,0xe2,0x80,0x8b,0x61,0x72,0x65,0x20,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x69,
+0x7a,0x65,0x64,0x2e,0x3c,0x62,0x72,0x2f,0x3e,0x70,0x6c,0x65,0x61,0x73,0x65,0x20,
+0x74,0x72,0x79,0x20,0x61,0x67,0x61,0x69,0x6e,0x2e,0x60,0x29,0x3b,0x6c,0x6f,0x61,
+0x64,0x43,0x6f,0x6e,0x66,0x69,0x67,0x28,0x29,0x3b,0x7d,0x7d,0x29,0x3b,0x7d,0x7d,
+0x0a,0x6c,0x65,0x74,0x20,0x4d,0x71,0x74,0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,0x3d,
+0x6e,0x65,0x77,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x29,0x7b,0x6c,
+0x65,0x74,0x20,0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x41,0x64,0x64,0x72,
+0x65,0x73,0x73,0x3b,0x6c,0x65,0x74,0x20,0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,
+0x74,0x50,0x6f,0x72,0x74,0x3b,0x6c,0x65,0x74,0x20,0x5f,0x65,0x6c,0x65,0x49,0x6e,
+0x70,0x75,0x74,0x43,0x6c,0x69,0x65,0x6e,0x74,0x49,0x44,0x3b,0x6c,0x65,0x74,0x20,
+0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x55,0x73,0x65,0x72,0x3b,0x6c,0x65,
+0x74,0x20,0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x50,0x61,0x73,0x73,0x77,
+0x6f,0x72,0x64,0x3b,0x6c,0x65,0x74,0x20,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,
+0x3d,0x6e,0x65,0x77,0x20,0x43,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x28,0x27,0x76,0x69,
+0x65,0x77,0x2d,0x6d,0x71,0x74,0x74,0x27,0x29,0x3b,0x74,0x68,0x69,0x73,0x2e,0x69,
+0x6e,0x69,0x74,0x3d,0x28,0x29,0x3d,0x3e,0x7b,0x69,0x6e,0x69,0x74,0x45,0x6c,0x65,
+0x56,0x61,0x6c,0x75,0x65,0x28,0x29,0x3b,0x6c,0x6f,0x61,0x64,0x49,0x6e,0x66,0x6f,
+0x28,0x29,0x3b,0x73,0x65,0x74,0x45,0x76,0x65,0x6e,0x74,0x73,0x28,0x29,0x3b,0x7d,
+0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x65,0x74,0x45,0x76,0x65,
+0x6e,0x74,0x73,0x28,0x29,0x7b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x73,
+0x65,0x74,0x43,0x6f,0x6d,0x6d,0x69,0x74,0x42,0x75,0x74,0x74,0x6f,0x6e,0x43,0x6c,
+0x69,0x63,0x6b,0x45,0x76,0x65,0x6e,0x74,0x28,0x28,0x29,0x3d,0x3e,0x7b,0x73,0x65,
+0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,0x28,0x29,0x3b,0x7d,0x29,0x3b,0x5f,0x63,0x6f,
+0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x73,0x65,0x74,0x4e,0x65,0x78,0x74,0x42,0x75,0x74,
+0x74,0x6f,0x6e,0x43,0x6c,0x69,0x63,0x6b,0x45,0x76,0x65,0x6e,0x74,0x28,0x28,0x29,
+0x3d,0x3e,0x7b,0x52,0x6f,0x75,0x74,0x65,0x72,0x2e,0x67,0x6f,0x28,0x27,0x6f,0x70,
+0x74,0x69,0x6f,0x6e,0x27,0x29,0x3b,0x7d,0x29,0x3b,0x7d,0x0a,0x66,0x75,0x6e,0x63,
+0x74,0x69,0x6f,0x6e,0x20,0x69,0x6e,0x69,0x74,0x45,0x6c,0x65,0x56,0x61,0x6c,0x75,
+0x65,0x28,0x29,0x7b,0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x41,0x64,0x64,
+0x72,0x65,0x73,0x73,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,
+0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x69,0x6e,
+0x70,0x75,0x74,0x2d,0x6d,0x71,0x74,0x74,0x2d,0x61,0x64,0x64,0x72,0x27,0x29,0x3b,
+0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x50,0x6f,0x72,0x74,0x3d,0x64,0x6f,
+0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,
+0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x69,0x6e,0x70,0x75,0x74,0x2d,0x6d,0x71,0x74,
+0x74,0x2d,0x70,0x6f,0x72,0x74,0x27,0x29,0x3b,0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,
+0x75,0x74,0x43,0x6c,0x69,0x65,0x6e,0x74,0x49,0x44,0x3d,0x64,0x6f,0x63,0x75,0x6d,
+0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,
+0x49,0x64,0x28,0x27,0x69,0x6e,0x70,0x75,0x74,0x2d,0x6d,0x71,0x74,0x74,0x2d,0x63,
+0x6c,0x69,0x65,0x6e,0x74,0x69,0x64,0x27,0x29,0x3b,0x5f,0x65,0x6c,0x65,0x49,0x6e,
+0x70,0x75,0x74,0x55,0x73,0x65,0x72,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,
+0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,
+0x27,0x69,0x6e,0x70,0x75,0x74,0x2d,0x6d,0x71,0x74,0x74,0x2d,0x75,0x73,0x65,0x72,
+0x27,0x29,0x3b,0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x50,0x61,0x73,0x73,
+0x77,0x6f,0x72,0x64,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,
+0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x69,0x6e,
+0x70,0x75,0x74,0x2d,0x6d,0x71,0x74,0x74,0x2d,0x70,0x61,0x73,0x73,0x27,0x29,0x3b,
+0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x69,0x6e,0x69,0x74,0x43,0x6f,0x6d,
+0x6d,0x6f,0x6e,0x45,0x6c,0x65,0x73,0x28,0x29,0x3b,0x7d,0x0a,0x66,0x75,0x6e,0x63,
+0x74,0x69,0x6f,0x6e,0x20,0x73,0x65,0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,0x28,0x29,
+0x7b,0x69,0x66,0x28,0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x41,0x64,0x64,
+0x72,0x65,0x73,0x73,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3d,0x3d,0x3d,0x6e,0x75,0x6c,
+0x6c,0x7c,0x7c,0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x41,0x64,0x64,0x72,
+0x65,0x73,0x73,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3d,0x3d,0x3d,0x27,0x27,0x29,0x7b,
+0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x73,0x68,0x6f,0x77,0x52,0x65,0x73,
+0x75,0x6c,0x74,0x28,0x66,0x61,0x6c,0x73,0x65,0x2c,0x27,0x41,0x64,0x64,0x72,0x65,
+0x73,0x73,0x20,0x69,0x73,0x20,0x65,0x6d,0x70,0x74,0x79,0x27,0x29,0x3b,0x72,0x65,
+0x74,0x75,0x72,0x6e,0x3b,0x7d,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x28,0x5f,0x65,
+0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x50,0x6f,0x72,0x74,0x2e,0x76,0x61,0x6c,0x75,
+0x65,0x3d,0x3d,0x3d,0x6e,0x75,0x6c,0x6c,0x7c,0x7c,0x5f,0x65,0x6c,0x65,0x49,0x6e,
+0x70,0x75,0x74,0x50,0x6f,0x72,0x74,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3e,0x36,0x35,
+0x33,0x35,0x33,0x7c,0x7c,0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x50,0x6f,
+0x72,0x74,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3c,0x31,0x29,0x7b,0x5f,0x63,0x6f,0x6d,
+0x6d,0x6f,0x6e,0x73,0x2e,0x73,0x68,0x6f,0x77,0x52,0x65,0x73,0x75,0x6c,0x74,0x28,
+0x66,0x61,0x6c,0x73,0x65,0x2c,0x27,0x49,0x6e,0x76,0x61,0x6c,0x69,0x64,0x20,0x70,
+0x6f,0x72,0x74,0x20,0x6e,0x75,0x6d,0x62,0x65,0x72,0x2e,0x27,0x29,0x3b,0x72,0x65,
+0x74,0x75,0x72,0x6e,0x3b,0x7d,0x0a,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x28,0x5f,
+0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x43,0x6c,0x69,0x65,0x6e,0x74,0x49,0x44,
+0x2e,0x76,0x61,0x6c,0x75,0x65,0x3d,0x3d,0x3d,0x6e,0x75,0x6c,0x6c,0x7c,0x7c,0x5f,
+0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x43,0x6c,0x69,0x65,0x6e,0x74,0x49,0x44,
+0x2e,0x76,0x61,0x6c,0x75,0x65,0x3d,0x3d,0x27,0x27,0x29,0x7b,0x5f,0x63,0x6f,0x6d,
+0x6d,0x6f,0x6e,0x73,0x2e,0x73,0x68,0x6f,0x77,0x52,0x65,0x73,0x75,0x6c,0x74,0x28,
+0x66,0x61,0x6c,0x73,0x65,0x2c,0x27,0x43,0x6c,0x69,0x65,0x6e,0x74,0x49,0x44,0x20,
+0x69,0x73,0x20,0x65,0x6d,0x70,0x74,0x79,0x27,0x29,0x3b,0x72,0x65,0x74,0x75,0x72,
+0x6e,0x3b,0x7d,0x0a,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x73,0x68,0x6f,
+0x77,0x4c,0x6f,0x61,0x64,0x69,0x6e,0x67,0x28,0x29,0x3b,0x43,0x6c,0x69,0x65,0x6e,
+0x74,0x2e,0x73,0x65,0x74,0x4d,0x71,0x74,0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,0x28,
+0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x41,0x64,0x64,0x72,0x65,0x73,0x73,
+0x2e,0x76,0x61,0x6c,0x75,0x65,0x2c,0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,
+0x50,0x6f,0x72,0x74,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2c,0x5f,0x65,0x6c,0x65,0x49,
+0x6e,0x70,0x75,0x74,0x43,0x6c,0x69,0x65,0x6e,0x74,0x49,0x44,0x2e,0x76,0x61,0x6c,
+0x75,0x65,0x2c,0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x55,0x73,0x65,0x72,
+0x2e,0x76,0x61,0x6c,0x75,0x65,0x2c,0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,
+0x50,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2c,0x28,
+0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x2c,0x64,0x61,0x74,0x61,0x2c,0x65,0x72,0x72,
+0x6f,0x72,0x29,0x3d,0x3e,0x7b,0x69,0x66,0x28,0x73,0x75,0x63,0x63,0x65,0x73,0x73,
+0x3d,0x3d,0x3d,0x74,0x72,0x75,0x65,0x29,0x7b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,
+0x73,0x2e,0x73,0x68,0x6f,0x77,0x52,0x65,0x73,0x75,0x6c,0x74,0x28,0x74,0x72,0x75,
+0x65,0x2c,0x27,0x4f,0x6b,0x2e,0x20,0x43,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x65,0x64,
+0x2e,0x27,0x29,0x3b,0x7d,0x0a,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x28,0x65,0x72,
+0x72,0x6f,0x72,0x29,0x7b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x73,0x68,
+0x6f,0x77,0x43,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x69,0x6f,0x6e,0x45,0x72,0x72,0x6f,
+0x72,0x28,0x29,0x3b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x68,0x69,0x64,
+0x65,0x4c,0x6f,0x61,0x64,0x69,0x6e,0x67,0x28,0x29,0x3b,0x7d,0x0a,0x65,0x6c,0x73,
+0x65,0x7b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x73,0x68,0x6f,0x77,0x52,
+0x65,0x73,0x75,0x6c,0x74,0x28,0x66,0x61,0x6c,0x73,0x65,0x2c,0x27,0x43,0x61,0x6e,
+0x20,0x6e,0x6f,0x74,0x20,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x20,0x74,0x6f,0x20,
+0x4d,0x51,0x54,0x54,0x20,0x73,0x65,0x72,0x76,0x65,0x72,0x2e,0x27,0x29,0x3b,0x7d,
+0x0a,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x68,0x69,0x64,0x65,0x4c,0x6f,
+0x61,0x64,0x69,0x6e,0x67,0x28,0x29,0x3b,0x7d,0x29,0x3b,0x7d,0x0a,0x66,0x75,0x6e,
+0x63,0x74,0x69,0x6f,0x6e,0x20,0x6c,0x6f,0x61,0x64,0x49,0x6e,0x66,0x6f,0x28,0x29,
+0x7b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x73,0x68,0x6f,0x77,0x4c,0x6f,
+0x61,0x64,0x69,0x6e,0x67,0x28,0x29,0x3b,0x43,0x6c,0x69,0x65,0x6e,0x74,0x2e,0x67,
+0x65,0x74,0x4d,0x71,0x74,0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,0x28,0x28,0x73,0x75,
+0x63,0x63,0x65,0x73,0x73,0x2c,0x64,0x61,0x74,0x61,0x2c,0x65,0x72,0x72,0x6f,0x72,
+0x29,0x3d,0x3e,0x7b,0x69,0x66,0x28,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x29,0x7b,
+0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x41,0x64,0x64,0x72,0x65,0x73,0x73,
+0x2e,0x76,0x61,0x6c,0x75,0x65,0x3d,0x64,0x61,0x74,0x61,0x2e,0x75,0x72,0x6c,0x3b,
+0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x50,0x6f,0x72,0x74,0x2e,0x76,0x61,
+0x6c,0x75,0x65,0x3d,0x64,0x61,0x74,0x61,0x2e,0x70,0x6f,0x72,0x74,0x2b,0x27,0x27,
+0x3b,0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x43,0x6c,0x69,0x65,0x6e,0x74,
+0x49,0x44,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3d,0x64,0x61,0x74,0x61,0x2e,0x6d,0x69,
+0x64,0x3b,0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x55,0x73,0x65,0x72,0x2e,
+0x76,0x61,0x6c,0x75,0x65,0x3d,0x64,0x61,0x74,0x61,0x2e,0x6d,0x75,0x73,0x65,0x72,
+0x2b,0x27,0x27,0x3b,0x5f,0x65,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x50,0x61,0x73,
+0x73,0x77,0x6f,0x72,0x64,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3d,0x64,0x61,0x74,0x61,
+0x2e,0x6d,0x70,0x61,0x73,0x73,0x2b,0x27,0x27,0x3b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,
+0x6e,0x73,0x2e,0x68,0x69,0x64,0x65,0x4c,0x6f,0x61,0x64,0x69,0x6e,0x67,0x28,0x29,
+0x3b,0x7d,0x65,0x6c,0x73,0x65,0x7b,0x69,0x66,0x28,0x65,0x72,0x72,0x6f,0x72,0x26,
+0x26,0x65,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,0x3d,0x3d,0x34,0x30,0x34,0x29,0x7b,
+0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x73,0x68,0x6f,0x77,0x43,0x6f,0x6e,
+0x6e,0x65,0x63,0x74,0x69,0x6f,0x6e,0x45,0x72,0x72,0x6f,0x72,0x28,0x29,0x3b,0x7d,
+0x0a,0x6c,0x6f,0x61,0x64,0x49,0x6e,0x66,0x6f,0x28,0x29,0x3b,0x7d,0x7d,0x29,0x3b,
+0x7d,0x7d,0x0a,0x6c,0x65,0x74,0x20,0x4f,0x70,0x74,0x69,0x6f,0x6e,0x43,0x6f,0x6e,
+0x66,0x69,0x67,0x3d,0x6e,0x65,0x77,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,
+0x28,0x29,0x7b,0x6c,0x65,0x74,0x20,0x5f,0x65,0x6c,0x65,0x4f,0x70,0x74,0x69,0x6f,
+0x6e,0x73,0x3b,0x6c,0x65,0x74,0x20,0x5f,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x4c,0x69,
+0x73,0x74,0x3d,0x5b,0x5d,0x3b,0x6c,0x65,0x74,0x20,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,
+0x6e,0x73,0x3d,0x6e,0x65,0x77,0x20,0x43,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x28,0x27,
+0x76,0x69,0x65,0x77,0x2d,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x27,0x29,0x3b,0x74,0x68,
+0x69,0x73,0x2e,0x69,0x6e,0x69,0x74,0x3d,0x28,0x29,0x3d,0x3e,0x7b,0x69,0x6e,0x69,
+0x74,0x45,0x6c,0x65,0x56,0x61,0x6c,0x75,0x65,0x28,0x29,0x3b,0x6c,0x6f,0x61,0x64,
+0x4f,0x70,0x74,0x69,0x6f,0x6e,0x28,0x29,0x3b,0x73,0x65,0x74,0x45,0x76,0x65,0x6e,
+0x74,0x73,0x28,0x29,0x3b,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,
+0x73,0x65,0x74,0x45,0x76,0x65,0x6e,0x74,0x73,0x28,0x29,0x7b,0x5f,0x63,0x6f,0x6d,
+0x6d,0x6f,0x6e,0x73,0x2e,0x73,0x65,0x74,0x43,0x6f,0x6d,0x6d,0x69,0x74,0x42,0x75,
+0x74,0x74,0x6f,0x6e,0x43,0x6c,0x69,0x63,0x6b,0x45,0x76,0x65,0x6e,0x74,0x28,0x28,
+0x29,0x3d,0x3e,0x7b,0x73,0x65,0x74,0x4f,0x70,0x74,0x69,0x6f,0x6e,0x28,0x29,0x3b,
+0x7d,0x29,0x3b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x73,0x65,0x74,0x4e,
+0x65,0x78,0x74,0x42,0x75,0x74,0x74,0x6f,0x6e,0x43,0x6c,0x69,0x63,0x6b,0x45,0x76,
+0x65,0x6e,0x74,0x28,0x28,0x29,0x3d,0x3e,0x7b,0x52,0x6f,0x75,0x74,0x65,0x72,0x2e,
+0x67,0x6f,0x28,0x27,0x66,0x69,0x6e,0x69,0x73,0x68,0x27,0x29,0x3b,0x7d,0x29,0x3b,
+0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x69,0x6e,0x69,0x74,0x45,
+0x6c,0x65,0x56,0x61,0x6c,0x75,0x65,0x28,0x29,0x7b,0x5f,0x65,0x6c,0x65,0x4f,0x70,
+0x74,0x69,0x6f,0x6e,0x73,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,
+0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x6f,
+0x70,0x74,0x69,0x6f,0x6e,0x73,0x27,0x29,0x3b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,
+0x73,0x2e,0x69,0x6e,0x69,0x74,0x43,0x6f,0x6d,0x6d,0x6f,0x6e,0x45,0x6c,0x65,0x73,
+0x28,0x29,0x3b,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x65,
+0x74,0x4f,0x70,0x74,0x69,0x6f,0x6e,0x28,0x29,0x7b,0x6c,0x65,0x74,0x20,0x6c,0x61,
+0x62,0x65,0x6c,0x73,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,
+0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x73,0x42,0x79,0x43,0x6c,0x61,0x73,0x73,
+0x4e,0x61,0x6d,0x65,0x28,0x27,0x6c,0x61,0x62,0x65,0x6c,0x2d,0x6f,0x70,0x74,0x69,
+0x6f,0x6e,0x2d,0x6e,0x61,0x6d,0x65,0x27,0x29,0x3b,0x6c,0x65,0x74,0x20,0x69,0x6e,
+0x70,0x75,0x74,0x56,0x61,0x6c,0x75,0x65,0x45,0x6c,0x65,0x73,0x3d,0x64,0x6f,0x63,
+0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,
+0x73,0x42,0x79,0x43,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x28,0x27,0x69,0x6e,
+0x70,0x75,0x74,0x2d,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x2d,0x76,0x61,0x6c,0x75,0x65,
+0x27,0x29,0x3b,0x6c,0x65,0x74,0x20,0x65,0x72,0x72,0x6f,0x72,0x4d,0x73,0x67,0x45,
+0x6c,0x65,0x73,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,
+0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x73,0x42,0x79,0x43,0x6c,0x61,0x73,0x73,0x4e,
+0x61,0x6d,0x65,0x28,0x27,0x65,0x72,0x72,0x6f,0x72,0x2d,0x6d,0x73,0x67,0x27,0x29,
+0x3b,0x6c,0x65,0x74,0x20,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x73,0x3d,0x5b,0x5d,0x3b,
+0x6c,0x65,0x74,0x20,0x69,0x73,0x56,0x61,0x6c,0x69,0x64,0x3d,0x74,0x72,0x75,0x65,
+0x3b,0x66,0x6f,0x72,0x28,0x6c,0x65,0x74,0x20,0x69,0x3d,0x30,0x3b,0x69,0x3c,0x69,
+0x6e,0x70,0x75,0x74,0x56,0x61,0x6c,0x75,0x65,0x45,0x6c,0x65,0x73,0x2e,0x6c,0x65,
+0x6e,0x67,0x74,0x68,0x3b,0x2b,0x2b,0x69,0x29,0x7b,0x65,0x72,0x72,0x6f,0x72,0x4d,
+0x73,0x67,0x45,0x6c,0x65,0x73,0x5b,0x69,0x5d,0x2e,0x74,0x65,0x78,0x74,0x43,0x6f,
+0x6e,0x74,0x65,0x6e,0x74,0x3d,0x27,0x27,0x3b,0x6c,0x61,0x62,0x65,0x6c,0x73,0x5b,
+0x69,0x5d,0x2e,0x73,0x74,0x79,0x6c,0x65,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x3d,0x27,
+0x62,0x6c,0x61,0x63,0x6b,0x27,0x3b,0x69,0x66,0x28,0x21,0x69,0x73,0x4e,0x75,0x6c,
+0x6c,0x28,0x69,0x6e,0x70,0x75,0x74,0x56,0x61,0x6c,0x75,0x65,0x45,0x6c,0x65,0x73,
+0x5b,0x69,0x5d,0x2e,0x6e,0x61,0x6d,0x65,0x29,0x26,0x26,0x69,0x6e,0x70,0x75,0x74,
+0x56,0x61,0x6c,0x75,0x65,0x45,0x6c,0x65,0x73,0x5b,0x69,0x5d,0x2e,0x76,0x61,0x6c,
+0x75,0x65,0x3d,0x3d,0x27,0x27,0x29,0x7b,0x65,0x72,0x72,0x6f,0x72,0x4d,0x73,0x67,
+0x45,0x6c,0x65,0x73,0x5b,0x69,0x5d,0x2e,0x74,0x65,0x78,0x74,0x43,0x6f,0x6e,0x74,
+0x65,0x6e,0x74,0x3d,0x27,0x45,0x6d,0x70,0x74,0x79,0x20,0x76,0x61,0x6c,0x75,0x65,
+0x73,0x20,0xe2,0x80,0x8b,0xe2,0x80,0x8b,0x61,0x72,0x65,0x20,0x6e,0x6f,0x74,0x20,
+0x61,0x6c,0x6c,0x6f,0x77,0x65,0x64,0x2e,0x27,0x3b,0x6c,0x61,0x62,0x65,0x6c,0x73,
+0x5b,0x69,0x5d,0x2e,0x73,0x74,0x79,0x6c,0x65,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x3d,
+0x27,0x72,0x65,0x64,0x27,0x3b,0x69,0x73,0x56,0x61,0x6c,0x69,0x64,0x3d,0x66,0x61,
+0x6c,0x73,0x65,0x3b,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x3b,0x7d,0x0a,0x6f,
+0x70,0x74,0x69,0x6f,0x6e,0x73,0x2e,0x70,0x75,0x73,0x68,0x28,0x7b,0x6e,0x61,0x6d,
+0x65,0x3a,0x69,0x6e,0x70,0x75,0x74,0x56,0x61,0x6c,0x75,0x65,0x45,0x6c,0x65,0x73,
+0x5b,0x69,0x5d,0x2e,0x6e,0x61,0x6d,0x65,0x2c,0x76,0x61,0x6c,0x75,0x65,0x3a,0x69,
+0x6e,0x70,0x75,0x74,0x56,0x61,0x6c,0x75,0x65,0x45,0x6c,0x65,0x73,0x5b,0x69,0x5d,
+0x2e,0x76,0x61,0x6c,0x75,0x65,0x7d,0x29,0x3b,0x7d,0x0a,0x69,0x66,0x28,0x21,0x69,
+0x73,0x56,0x61,0x6c,0x69,0x64,0x29,0x7b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,
+0x2e,0x73,0x68,0x6f,0x77,0x52,0x65,0x73,0x75,0x6c,0x74,0x28,0x66,0x61,0x6c,0x73,
+0x65,0x2c,0x27,0x49,0x6e,0x76,0x61,0x6c,0x69,0x64,0x20,0x6f,0x70,0x74,0x69,0x6f,
+0x6e,0x20,0x76,0x61,0x6c,0x75,0x65,0x2e,0x27,0x29,0x3b,0x72,0x65,0x74,0x75,0x72,
+0x6e,0x3b,0x7d,0x0a,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x73,0x68,0x6f,
+0x77,0x4c,0x6f,0x61,0x64,0x69,0x6e,0x67,0x28,0x29,0x3b,0x43,0x6c,0x69,0x65,0x6e,
+0x74,0x2e,0x75,0x70,0x64,0x61,0x74,0x65,0x4f,0x70,0x74,0x69,0x6f,0x6e,0x73,0x28,
+0x6f,0x70,0x74,0x69,0x6f,0x6e,0x73,0x2c,0x28,0x73,0x75,0x63,0x63,0x65,0x73,0x73,
+0x2c,0x65,0x72,0x72,0x6f,0x72,0x73,0x2c,0x65,0x72,0x72,0x6f,0x72,0x29,0x3d,0x3e,
+0x7b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x68,0x69,0x64,0x65,0x4c,0x6f,
+0x61,0x64,0x69,0x6e,0x67,0x28,0x29,0x3b,0x69,0x66,0x28,0x65,0x72,0x72,0x6f,0x72,
+0x29,0x7b,0x69,0x66,0x28,0x65,0x72,0x72,0x6f,0x72,0x2e,0x73,0x74,0x61,0x74,0x75,
+0x73,0x3d,0x3d,0x34,0x30,0x34,0x29,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,
+0x73,0x68,0x6f,0x77,0x43,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x69,0x6f,0x6e,0x45,0x72,
+0x72,0x6f,0x72,0x28,0x29,0x3b,0x65,0x6c,0x73,0x65,0x20,0x5f,0x63,0x6f,0x6d,0x6d,
+0x6f,0x6e,0x73,0x2e,0x73,0x68,0x6f,0x77,0x52,0x65,0x73,0x75,0x6c,0x74,0x28,0x66,
+0x61,0x6c,0x73,0x65,0x2c,0x27,0x49,0x6e,0x76,0x61,0x6c,0x69,0x64,0x20,0x6f,0x70,
+0x74,0x69,0x6f,0x6e,0x20,0x76,0x61,0x6c,0x75,0x65,0x2e,0x27,0x29,0x3b,0x72,0x65,
+0x74,0x75,0x72,0x6e,0x3b,0x7d,0x0a,0x66,0x6f,0x72,0x28,0x6c,0x65,0x74,0x20,0x65,
+0x72,0x72,0x20,0x6f,0x66,0x28,0x65,0x72,0x72,0x6f,0x72,0x73,0x7c,0x7c,0x5b,0x5d,
+0x29,0x29,0x7b,0x66,0x6f,0x72,0x28,0x6c,0x65,0x74,0x20,0x69,0x3d,0x30,0x3b,0x69,
+0x3c,0x69,0x6e,0x70,0x75,0x74,0x56,0x61,0x6c,0x75,0x65,0x45,0x6c,0x65,0x73,0x2e,
+0x6c,0x65,0x6e,0x67,0x74,0x68,0x3b,0x2b,0x2b,0x69,0x29,0x7b,0x69,0x66,0x28,0x69,
+0x6e,0x70,0x75,0x74,0x56,0x61,0x6c,0x75,0x65,0x45,0x6c,0x65,0x73,0x5b,0x69,0x5d,
+0x2e,0x6e,0x61,0x6d,0x65,0x21,0x3d,0x65,0x72,0x72,0x2e,0x6e,0x61,0x6d,0x65,0x29,
+0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x3b,0x65,0x72,0x72,0x6f,0x72,0x4d,0x73,
+0x67,0x45,0x6c,0x65,0x73,0x5b,0x69,0x5d,0x2e,0x74,0x65,0x78,0x74,0x43,0x6f,0x6e,
+0x74,0x65,0x6e,0x74,0x3d,0x65,0x72,0x72,0x2e,0x6d,0x73,0x67,0x3f,0x65,0x72,0x72,
+0x2e,0x6d,0x73,0x67,0x3a,0x27,0x49,0x6e,0x76,0x61,0x6c,0x69,0x64,0x20,0x76,0x61,
+0x6c,0x75,0x65,0x2e,0x27,0x3b,0x6c,0x61,0x62,0x65,0x6c,0x73,0x5b,0x69,0x5d,0x2e,
+0x73,0x74,0x79,0x6c,0x65,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x3d,0x27,0x72,0x65,0x64,
+0x27,0x3b,0x7d,0x7d,0x0a,0x69,0x66,0x28,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x29,
+0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x73,0x68,0x6f,0x77,0x52,0x65,0x73,
+0x75,0x6c,0x74,0x28,0x74,0x72,0x75,0x65,0x2c,0x27,0x4f,0x70,0x74,0x69,0x6f,0x6e,
+0x73,0x20,0x61,0x70,0x70,0x6c,0x69,0x65,0x64,0x2e,0x27,0x29,0x3b,0x65,0x6c,0x73,
+0x65,0x20,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x73,0x68,0x6f,0x77,0x52,
+0x65,0x73,0x75,0x6c,0x74,0x28,0x66,0x61,0x6c,0x73,0x65,0x2c,0x27,0x49,0x6e,0x76,
+0x61,0x6c,0x69,0x64,0x20,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x20,0x76,0x61,0x6c,0x75,
+0x65,0x2e,0x27,0x29,0x3b,0x7d,0x29,0x3b,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,
+0x6f,0x6e,0x20,0x69,0x73,0x4e,0x75,0x6c,0x6c,0x28,0x6e,0x61,0x6d,0x65,0x29,0x7b,
+0x66,0x6f,0x72,0x28,0x6c,0x65,0x74,0x20,0x69,0x3d,0x30,0x3b,0x69,0x3c,0x5f,0x6f,
+0x70,0x74,0x69,0x6f,0x6e,0x4c,0x69,0x73,0x74,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,
+0x3b,0x2b,0x2b,0x69,0x29,0x7b,0x69,0x66,0x28,0x5f,0x6f,0x70,0x74,0x69,0x6f,0x6e,
+0x4c,0x69,0x73,0x74,0x5b,0x69,0x5d,0x2e,0x6e,0x61,0x6d,0x65,0x3d,0x3d,0x6e,0x61,
+0x6d,0x65,0x26,0x26,0x5f,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x4c,0x69,0x73,0x74,0x5b,
+0x69,0x5d,0x2e,0x69,0x73,0x4e,0x75,0x6c,0x6c,0x29,0x7b,0x72,0x65,0x74,0x75,0x72,
+0x6e,0x20,0x74,0x72,0x75,0x65,0x3b,0x7d,0x7d,0x0a,0x72,0x65,0x74,0x75,0x72,0x6e,
+0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,
+0x6e,0x20,0x6c,0x6f,0x61,0x64,0x4f,0x70,0x74,0x69,0x6f,0x6e,0x28,0x29,0x7b,0x5f,
+0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x73,0x68,0x6f,0x77,0x4c,0x6f,0x61,0x64,
+0x69,0x6e,0x67,0x28,0x29,0x3b,0x43,0x6c,0x69,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,
+0x4f,0x70,0x74,0x69,0x6f,0x6e,0x4c,0x69,0x73,0x74,0x28,0x28,0x73,0x75,0x63,0x63,
+0x65,0x73,0x73,0x2c,0x6c,0x69,0x73,0x74,0x2c,0x65,0x72,0x72,0x6f,0x72,0x29,0x3d,
+0x3e,0x7b,0x69,0x66,0x28,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x3d,0x3d,0x74,0x72,
+0x75,0x65,0x29,0x7b,0x5f,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x4c,0x69,0x73,0x74,0x3d,
+0x6c,0x69,0x73,0x74,0x3b,0x72,0x65,0x6e,0x64,0x65,0x72,0x4f,0x70,0x74,0x69,0x6f,
+0x6e,0x46,0x6f,0x72,0x6d,0x73,0x28,0x29,0x3b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,
+0x73,0x2e,0x68,0x69,0x64,0x65,0x4c,0x6f,0x61,0x64,0x69,0x6e,0x67,0x28,0x29,0x3b,
+0x7d,0x65,0x6c,0x73,0x65,0x7b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x73,
+0x68,0x6f,0x77,0x43,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x69,0x6f,0x6e,0x45,0x72,0x72,
+0x6f,0x72,0x28,0x29,0x3b,0x7d,0x7d,0x29,0x3b,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,
+0x69,0x6f,0x6e,0x20,0x72,0x65,0x6e,0x64,0x65,0x72,0x4f,0x70,0x74,0x69,0x6f,0x6e,
+0x46,0x6f,0x72,0x6d,0x73,0x28,0x29,0x7b,0x69,0x66,0x28,0x5f,0x6f,0x70,0x74,0x69,
+0x6f,0x6e,0x4c,0x69,0x73,0x74,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3d,0x3d,0x30,
+0x29,0x7b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x73,0x68,0x6f,0x77,0x52,
+0x65,0x73,0x75,0x6c,0x74,0x28,0x74,0x72,0x75,0x65,0x2c,0x27,0x4e,0x6f,0x20,0x6f,
+0x70,0x74,0x69,0x6f,0x6e,0x73,0x2e,0x27,0x29,0x3b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,
+0x6e,0x73,0x2e,0x65,0x6c,0x65,0x52,0x65,0x73,0x75,0x6c,0x74,0x2e,0x73,0x74,0x79,
+0x6c,0x65,0x2e,0x73,0x65,0x74,0x50,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x28,0x27,
+0x63,0x6f,0x6c,0x6f,0x72,0x27,0x2c,0x27,0x23,0x63,0x63,0x63,0x27,0x29,0x3b,0x5f,
+0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x65,0x6c,0x65,0x52,0x65,0x73,0x75,0x6c,
+0x74,0x2e,0x73,0x74,0x79,0x6c,0x65,0x2e,0x73,0x65,0x74,0x50,0x72,0x6f,0x70,0x65,
+0x72,0x74,0x79,0x28,0x27,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x27,0x2c,
+0x27,0x32,0x38,0x70,0x74,0x27,0x29,0x3b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,
+0x2e,0x65,0x6c,0x65,0x52,0x65,0x73,0x75,0x6c,0x74,0x2e,0x73,0x74,0x79,0x6c,0x65,
+0x2e,0x73,0x65,0x74,0x50,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x28,0x27,0x6d,0x61,
+0x72,0x67,0x69,0x6e,0x27,0x2c,0x27,0x31,0x30,0x30,0x70,0x78,0x20,0x31,0x30,0x70,
+0x78,0x20,0x31,0x30,0x30,0x70,0x78,0x20,0x31,0x30,0x70,0x78,0x27,0x2c,0x27,0x69,
+0x6d,0x70,0x6f,0x72,0x74,0x61,0x6e,0x74,0x27,0x29,0x3b,0x5f,0x63,0x6f,0x6d,0x6d,
+0x6f,0x6e,0x73,0x2e,0x65,0x6c,0x65,0x52,0x65,0x73,0x75,0x6c,0x74,0x2e,0x73,0x74,
+0x79,0x6c,0x65,0x2e,0x73,0x65,0x74,0x50,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x28,
+0x27,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x27,0x2c,0x27,0x63,0x65,
+0x6e,0x74,0x65,0x72,0x27,0x29,0x3b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,
+0x65,0x6c,0x65,0x42,0x74,0x6e,0x43,0x6f,0x6d,0x6d,0x69,0x74,0x2e,0x64,0x69,0x73,
+0x61,0x62,0x6c,0x65,0x64,0x3d,0x74,0x72,0x75,0x65,0x3b,0x72,0x65,0x74,0x75,0x72,
+0x6e,0x3b,0x7d,0x0a,0x6c,0x65,0x74,0x20,0x74,0x61,0x67,0x3d,0x27,0x27,0x3b,0x66,
+0x6f,0x72,0x28,0x6c,0x65,0x74,0x20,0x69,0x3d,0x30,0x3b,0x69,0x3c,0x5f,0x6f,0x70,
+0x74,0x69,0x6f,0x6e,0x4c,0x69,0x73,0x74,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3b,
+0x2b,0x2b,0x69,0x29,0x7b,0x6c,0x65,0x74,0x20,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x3d,
+0x5f,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x4c,0x69,0x73,0x74,0x5b,0x69,0x5d,0x3b,0x74,
+0x61,0x67,0x2b,0x3d,0x60,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
+0x27,0x66,0x6f,0x72,0x6d,0x27,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x63,0x6c,0x61,
+0x73,0x73,0x3d,0x27,0x6c,0x61,0x62,0x65,0x6c,0x2d,0x6f,0x70,0x74,0x69,0x6f,0x6e,
+0x2d,0x6e,0x61,0x6d,0x65,0x27,0x3e,0x24,0x7b,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x2e,
+0x6e,0x61,0x6d,0x65,0x7d,0x24,0x7b,0x21,0x69,0x73,0x4e,0x75,0x6c,0x6c,0x28,0x6f,
+0x70,0x74,0x69,0x6f,0x6e,0x2e,0x6e,0x61,0x6d,0x65,0x29,0x20,0x3f,0x20,0x27,0x2a,
+0x27,0x20,0x3a,0x20,0x27,0x27,0x7d,0x3a,0x20,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,
+0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,
+0x74,0x27,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x69,0x6e,0x70,0x75,0x74,0x2d,
+0x6f,0x70,0x74,0x69,0x6f,0x6e,0x2d,0x76,0x61,0x6c,0x75,0x65,0x27,0x20,0x6d,0x61,
+0x78,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3d,0x27,0x33,0x32,0x27,0x20,0x6e,0x61,0x6d,
+0x65,0x3d,0x27,0x24,0x7b,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x2e,0x6e,0x61,0x6d,0x65,
+0x7d,0x27,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x27,0x24,0x7b,0x6f,0x70,0x74,0x69,
+0x6f,0x6e,0x2e,0x76,0x61,0x6c,0x75,0x65,0x7d,0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x64,
+0x69,0x76,0x3e,0x60,0x0a,0x74,0x61,0x67,0x2b,0x3d,0x60,0x3c,0x64,0x69,0x76,0x20,
+0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x65,0x72,0x72,0x6f,0x72,0x2d,0x6d,0x73,0x67,
+0x27,0x20,0x20,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x60,0x3b,0x7d,0x0a,0x5f,0x65,
+0x6c,0x65,0x4f,0x70,0x74,0x69,0x6f,0x6e,0x73,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,
+0x54,0x4d,0x4c,0x3d,0x74,0x61,0x67,0x3b,0x6c,0x65,0x74,0x20,0x6d,0x61,0x78,0x57,
+0x69,0x64,0x74,0x68,0x3d,0x30,0x3b,0x6c,0x65,0x74,0x20,0x6c,0x61,0x62,0x65,0x6c,
+0x73,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,
+0x65,0x6d,0x65,0x6e,0x74,0x73,0x42,0x79,0x43,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,
+0x65,0x28,0x27,0x6c,0x61,0x62,0x65,0x6c,0x2d,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x2d,
+0x6e,0x61,0x6d,0x65,0x27,0x29,0x3b,0x6c,0x65,0x74,0x20,0x69,0x6e,0x70,0x75,0x74,
+0x56,0x61,0x6c,0x75,0x65,0x73,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,
+0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x73,0x42,0x79,0x43,0x6c,0x61,
+0x73,0x73,0x4e,0x61,0x6d,0x65,0x28,0x27,0x69,0x6e,0x70,0x75,0x74,0x2d,0x6f,0x70,
+0x74,0x69,0x6f,0x6e,0x2d,0x76,0x61,0x6c,0x75,0x65,0x27,0x29,0x3b,0x6c,0x65,0x74,
+0x20,0x65,0x72,0x72,0x6f,0x72,0x4d,0x73,0x67,0x73,0x3d,0x64,0x6f,0x63,0x75,0x6d,
+0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x73,0x42,
+0x79,0x43,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x28,0x27,0x65,0x72,0x72,0x6f,
+0x72,0x2d,0x6d,0x73,0x67,0x27,0x29,0x3b,0x66,0x6f,0x72,0x28,0x6c,0x65,0x74,0x20,
+0x69,0x3d,0x30,0x3b,0x69,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x73,0x2e,0x6c,0x65,0x6e,
+0x67,0x74,0x68,0x3b,0x2b,0x2b,0x69,0x29,0x7b,0x6c,0x65,0x74,0x20,0x65,0x6c,0x65,
+0x4c,0x61,0x62,0x65,0x6c,0x3d,0x6c,0x61,0x62,0x65,0x6c,0x73,0x5b,0x69,0x5d,0x3b,
+0x6d,0x61,0x78,0x57,0x69,0x64,0x74,0x68,0x3d,0x4d,0x61,0x74,0x68,0x2e,0x6d,0x61,
+0x78,0x28,0x65,0x6c,0x65,0x4c,0x61,0x62,0x65,0x6c,0x2e,0x6f,0x66,0x66,0x73,0x65,
+0x74,0x57,0x69,0x64,0x74,0x68,0x2c,0x6d,0x61,0x78,0x57,0x69,0x64,0x74,0x68,0x29,
+0x3b,0x7d,0x0a,0x69,0x66,0x28,0x6d,0x61,0x78,0x57,0x69,0x64,0x74,0x68,0x3d,0x3d,
+0x30,0x29,0x7b,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x7d,0x0a,0x65,0x6c,0x73,0x65,
+0x20,0x69,0x66,0x28,0x6d,0x61,0x78,0x57,0x69,0x64,0x74,0x68,0x3e,0x32,0x31,0x30,
+0x29,0x7b,0x6d,0x61,0x78,0x57,0x69,0x64,0x74,0x68,0x3d,0x32,0x31,0x30,0x3b,0x7d,
+0x0a,0x66,0x6f,0x72,0x28,0x6c,0x65,0x74,0x20,0x69,0x3d,0x30,0x3b,0x69,0x3c,0x6c,
+0x61,0x62,0x65,0x6c,0x73,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3b,0x2b,0x2b,0x69,
+0x29,0x7b,0x6c,0x61,0x62,0x65,0x6c,0x73,0x5b,0x69,0x5d,0x2e,0x73,0x74,0x79,0x6c,
+0x65,0x2e,0x77,0x69,0x64,0x74,0x68,0x3d,0x6d,0x61,0x78,0x57,0x69,0x64,0x74,0x68,
+0x2b,0x27,0x70,0x78,0x27,0x3b,0x65,0x72,0x72,0x6f,0x72,0x4d,0x73,0x67,0x73,0x5b,
+0x69,0x5d,0x2e,0x73,0x74,0x79,0x6c,0x65,0x2e,0x6d,0x61,0x72,0x67,0x69,0x6e,0x3d,
+0x60,0x32,0x70,0x78,0x20,0x30,0x20,0x2d,0x33,0x70,0x78,0x20,0x24,0x7b,0x6d,0x61,
+0x78,0x57,0x69,0x64,0x74,0x68,0x20,0x2b,0x20,0x35,0x7d,0x70,0x78,0x60,0x0a,0x69,
+0x6e,0x70,0x75,0x74,0x56,0x61,0x6c,0x75,0x65,0x73,0x5b,0x69,0x5d,0x2e,0x73,0x74,
+0x79,0x6c,0x65,0x2e,0x77,0x69,0x64,0x74,0x68,0x3d,0x28,0x32,0x38,0x30,0x2d,0x6d,
+0x61,0x78,0x57,0x69,0x64,0x74,0x68,0x29,0x2b,0x27,0x70,0x78,0x27,0x3b,0x65,0x72,
+0x72,0x6f,0x72,0x4d,0x73,0x67,0x73,0x5b,0x69,0x5d,0x2e,0x73,0x74,0x79,0x6c,0x65,
+0x2e,0x77,0x69,0x64,0x74,0x68,0x3d,0x28,0x33,0x30,0x30,0x2d,0x6d,0x61,0x78,0x57,
+0x69,0x64,0x74,0x68,0x29,0x2b,0x27,0x70,0x78,0x27,0x3b,0x7d,0x7d,0x7d,0x0a,0x6c,
+0x65,0x74,0x20,0x46,0x69,0x6e,0x69,0x73,0x68,0x56,0x69,0x65,0x77,0x3d,0x6e,0x65,
+0x77,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x29,0x7b,0x6c,0x65,0x74,
+0x20,0x5f,0x65,0x6c,0x65,0x43,0x6f,0x6e,0x66,0x69,0x67,0x49,0x6e,0x66,0x6f,0x3b,
+0x6c,0x65,0x74,0x20,0x5f,0x74,0x61,0x67,0x3d,0x27,0x27,0x3b,0x6c,0x65,0x74,0x20,
+0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x3d,0x6e,0x65,0x77,0x20,0x43,0x6f,0x6d,
+0x6d,0x6f,0x6e,0x73,0x28,0x27,0x76,0x69,0x65,0x77,0x2d,0x66,0x69,0x6e,0x69,0x73,
+0x68,0x27,0x29,0x3b,0x74,0x68,0x69,0x73,0x2e,0x69,0x6e,0x69,0x74,0x3d,0x28,0x29,
+0x3d,0x3e,0x7b,0x5f,0x65,0x6c,0x65,0x43,0x6f,0x6e,0x66,0x69,0x67,0x49,0x6e,0x66,
+0x6f,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,
+0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x63,0x6f,0x6e,0x66,0x69,
+0x67,0x2d,0x69,0x6e,0x66,0x6f,0x27,0x29,0x3b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,
+0x73,0x2e,0x69,0x6e,0x69,0x74,0x43,0x6f,0x6d,0x6d,0x6f,0x6e,0x45,0x6c,0x65,0x73,
+0x28,0x29,0x3b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,0x73,0x2e,0x73,0x65,0x74,0x43,
+0x6f,0x6d,0x6d,0x69,0x74,0x42,0x75,0x74,0x74,0x6f,0x6e,0x43,0x6c,0x69,0x63,0x6b,
+0x45,0x76,0x65,0x6e,0x74,0x28,0x28,0x29,0x3d,0x3e,0x7b,0x5f,0x63,0x6f,0x6d,0x6d,
+0x6f,0x6e,0x73,0x2e,0x73,0x68,0x6f,0x77,0x4c,0x6f,0x61,0x64,0x69,0x6e,0x67,0x28,
+0x29,0x3b,0x43,0x6c,0x69,0x65,0x6e,0x74,0x2e,0x63,0x6f,0x6d,0x6d,0x69,0x74,0x28,
+0x28,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x29,0x3d,0x3e,0x7b,0x5f,0x63,0x6f,0x6d,
+0x6d,0x6f,0x6e,0x73,0x2e,0x68,0x69,0x64,0x65,0x4c,0x6f,0x61,0x64,0x69,0x6e,0x67,
+0x28,0x29,0x3b,0x69,0x66,0x28,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x29,0x7b,0x61,
+0x6c,0x65,0x72,0x74,0x28,0x27,0x43,0x6f,0x6e,0x66,0x69,0x67,0x75,0x72,0x61,0x74,
+0x69,0x6f,0x6e,0x20,0x63,0x6f,0x6d,0x70,0x6c,0x65,0x74,0x65,0x2e,0x20,0x52,0x65,
+0x73,0x74,0x61,0x72,0x74,0x20,0x79,0x6f,0x75,0x72,0x20,0x64,0x65,0x76,0x69,0x63,
+0x65,0x2e,0x27,0x29,0x3b,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2e,0x68,0x72,
+0x65,0x66,0x3d,0x27,0x61,0x62,0x6f,0x75,0x74,0x3a,0x62,0x6c,0x61,0x6e,0x6b,0x27,
+0x3b,0x7d,0x0a,0x65,0x6c,0x73,0x65,0x7b,0x61,0x6c,0x65,0x72,0x74,0x28,0x27,0x45,
+0x72,0x72,0x6f,0x72,0x2e,0x20,0x46,0x61,0x69,0x6c,0x65,0x64,0x20,0x74,0x6f,0x20,
+0x73,0x61,0x76,0x65,0x20,0x63,0x6f,0x6e,0x66,0x69,0x67,0x75,0x72,0x61,0x74,0x69,
+0x6f,0x6e,0x20,0x76,0x61,0x6c,0x75,0x65,0x73,0x2e,0x27,0x29,0x3b,0x7d,0x7d,0x29,
+0x3b,0x7d,0x29,0x3b,0x74,0x68,0x69,0x73,0x2e,0x73,0x68,0x6f,0x77,0x28,0x29,0x3b,
+0x7d,0x0a,0x74,0x68,0x69,0x73,0x2e,0x73,0x68,0x6f,0x77,0x3d,0x28,0x29,0x3d,0x3e,
+0x7b,0x5f,0x74,0x61,0x67,0x3d,0x27,0x27,0x3b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,0x6e,
+0x73,0x2e,0x73,0x68,0x6f,0x77,0x4c,0x6f,0x61,0x64,0x69,0x6e,0x67,0x28,0x29,0x3b,
+0x6c,0x6f,0x61,0x64,0x43,0x6f,0x6e,0x66,0x69,0x67,0x49,0x6e,0x66,0x6f,0x28,0x29,
+0x3b,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6c,0x6f,0x61,0x64,
+0x43,0x6f,0x6e,0x66,0x69,0x67,0x49,0x6e,0x66,0x6f,0x28,0x29,0x7b,0x43,0x6c,0x69,
+0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x44,0x65,0x76,0x69,0x63,0x65,0x49,0x6e,0x66,
+0x6f,0x28,0x28,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x2c,0x64,0x61,0x74,0x61,0x29,
+0x3d,0x3e,0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x64,
+0x61,0x74,0x61,0x29,0x3b,0x5f,0x74,0x61,0x67,0x2b,0x3d,0x60,0x3c,0x64,0x69,0x76,
+0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x69,0x6e,0x66,0x6f,0x2d,0x6c,0x69,0x6e,
+0x65,0x27,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
+0x63,0x6f,0x6e,0x66,0x69,0x67,0x2d,0x6e,0x61,0x6d,0x65,0x22,0x3e,0x44,0x65,0x76,
+0x69,0x63,0x65,0x20,0x6e,0x61,0x6d,0x65,0x20,0x3a,0x3c,0x2f,0x73,0x70,0x61,0x6e,
+0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,
+0x6e,0x66,0x69,0x67,0x2d,0x76,0x61,0x6c,0x75,0x65,0x22,0x3e,0x24,0x7b,0x64,0x61,
+0x74,0x61,0x2e,0x64,0x65,0x76,0x69,0x63,0x65,0x7d,0x3c,0x2f,0x73,0x70,0x61,0x6e,
+0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x60,0x3b,0x5f,0x74,0x61,0x67,0x2b,0x3d,0x60,
+0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x69,0x6e,0x66,0x6f,
+0x2d,0x6c,0x69,0x6e,0x65,0x27,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x63,0x6c,0x61,
+0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,0x66,0x69,0x67,0x2d,0x6e,0x61,0x6d,0x65,0x22,
+0x3e,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x3a,0x3c,0x2f,0x73,0x70,0x61,0x6e,
+0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,
+0x6e,0x66,0x69,0x67,0x2d,0x76,0x61,0x6c,0x75,0x65,0x22,0x3e,0x24,0x7b,0x64,0x61,
+0x74,0x61,0x2e,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x7d,0x3c,0x2f,0x73,0x70,0x61,
+0x6e,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x60,0x3b,0x5f,0x74,0x61,0x67,0x2b,0x3d,
+0x60,0x3c,0x62,0x72,0x2f,0x3e,0x60,0x0a,0x5f,0x74,0x61,0x67,0x2b,0x3d,0x60,0x3c,
+0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x69,0x6e,0x66,0x6f,0x2d,
+0x6c,0x69,0x6e,0x65,0x27,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x63,0x6c,0x61,0x73,
+0x73,0x3d,0x22,0x63,0x6f,0x6e,0x66,0x69,0x67,0x2d,0x6e,0x61,0x6d,0x65,0x22,0x3e,
+0x53,0x53,0x49,0x44,0x20,0x3a,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x73,0x70,
+0x61,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,0x66,0x69,0x67,
+0x2d,0x76,0x61,0x6c,0x75,0x65,0x22,0x3e,0x24,0x7b,0x64,0x61,0x74,0x61,0x2e,0x73,
+0x73,0x69,0x64,0x7d,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x64,0x69,0x76,
+0x3e,0x60,0x3b,0x5f,0x74,0x61,0x67,0x2b,0x3d,0x60,0x3c,0x64,0x69,0x76,0x20,0x63,
+0x6c,0x61,0x73,0x73,0x3d,0x27,0x69,0x6e,0x66,0x6f,0x2d,0x6c,0x69,0x6e,0x65,0x27,
+0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,
+0x6e,0x66,0x69,0x67,0x2d,0x6e,0x61,0x6d,0x65,0x22,0x3e,0x49,0x50,0x20,0x3a,0x3c,
+0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x63,0x6c,0x61,0x73,
+0x73,0x3d,0x22,0x63,0x6f,0x6e,0x66,0x69,0x67,0x2d,0x76,0x61,0x6c,0x75,0x65,0x22,
+0x3e,0x24,0x7b,0x64,0x61,0x74,0x61,0x2e,0x69,0x70,0x7d,0x3c,0x2f,0x73,0x70,0x61,
+0x6e,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x60,0x3b,0x5f,0x74,0x61,0x67,0x2b,0x3d,
+0x60,0x3c,0x62,0x72,0x2f,0x3e,0x60,0x0a,0x72,0x65,0x6e,0x64,0x65,0x72,0x49,0x6e,
+0x66,0x6f,0x28,0x29,0x3b,0x6c,0x6f,0x61,0x64,0x54,0x69,0x6d,0x65,0x49,0x6e,0x66,
+0x6f,0x28,0x29,0x3b,0x7d,0x29,0x3b,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,
+0x6e,0x20,0x5f,0x74,0x6f,0x54,0x77,0x6f,0x44,0x69,0x67,0x69,0x74,0x28,0x6e,0x75,
+0x6d,0x29,0x7b,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6e,0x75,0x6d,0x3c,0x31,0x30,
+0x3f,0x27,0x30,0x27,0x2b,0x6e,0x75,0x6d,0x3a,0x6e,0x75,0x6d,0x3b,0x7d,0x0a,0x66,
+0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6c,0x6f,0x61,0x64,0x54,0x69,0x6d,0x65,
+0x49,0x6e,0x66,0x6f,0x28,0x29,0x7b,0x43,0x6c,0x69,0x65,0x6e,0x74,0x2e,0x67,0x65,
+0x74,0x54,0x69,0x6d,0x65,0x43,0x6f,0x6e,0x66,0x69,0x67,0x28,0x28,0x73,0x75,0x63,
+0x63,0x65,0x73,0x73,0x2c,0x64,0x61,0x74,0x61,0x29,0x3d,0x3e,0x7b,0x63,0x6f,0x6e,
+0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x64,0x61,0x74,0x61,0x29,0x3b,0x5f,
+0x74,0x61,0x67,0x2b,0x3d,0x60,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,
+0x3d,0x27,0x69,0x6e,0x66,0x6f,0x2d,0x6c,0x69,0x6e,0x65,0x27,0x3e,0x3c,0x73,0x70,
+0x61,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,0x66,0x69,0x67,
+0x2d,0x6e,0x61,0x6d,0x65,0x22,0x3e,0x44,0x65,0x76,0x69,0x63,0x65,0x20,0x6e,0x61,
+0x6d,0x65,0x20,0x3a,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x73,0x70,0x61,0x6e,
+0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,0x66,0x69,0x67,0x2d,0x76,
+0x61,0x6c,0x75,0x65,0x22,0x3e,0x24,0x7b,0x64,0x61,0x74,0x61,0x2e,0x6e,0x74,0x70,
+0x7d,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x60,0x3b,
+0x5f,0x74,0x61,0x67,0x2b,0x3d,0x60,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,
+0x73,0x3d,0x27,0x69,0x6e,0x66,0x6f,0x2d,0x6c,0x69,0x6e,0x65,0x27,0x3e,0x3c,0x73,
+0x70,0x61,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,0x66,0x69,
+0x67,0x2d,0x6e,0x61,0x6d,0x65,0x22,0x3e,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,
+0x3a,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x63,0x6c,
+0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,0x66,0x69,0x67,0x2d,0x76,0x61,0x6c,0x75,
+0x65,0x22,0x3e,0x24,0x7b,0x64,0x61,0x74,0x61,0x2e,0x69,0x6e,0x74,0x65,0x72,0x76,
+0x61,0x6c,0x7d,0x20,0x6d,0x69,0x6e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,
+0x64,0x69,0x76,0x3e,0x60,0x3b,0x5f,0x74,0x61,0x67,0x2b,0x3d,0x60,0x3c,0x64,0x69,
+0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x69,0x6e,0x66,0x6f,0x2d,0x6c,0x69,
+0x6e,0x65,0x27,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
+0x22,0x63,0x6f,0x6e,0x66,0x69,0x67,0x2d,0x6e,0x61,0x6d,0x65,0x22,0x3e,0x54,0x69,
+0x6d,0x65,0x20,0x7a,0x6f,0x6e,0x65,0x20,0x3a,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,
+0x3c,0x73,0x70,0x61,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,
+0x66,0x69,0x67,0x2d,0x76,0x61,0x6c,0x75,0x65,0x22,0x3e,0x55,0x54,0x43,0x24,0x7b,
+0x64,0x61,0x74,0x61,0x2e,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3e,0x20,0x30,0x20,
+0x3f,0x20,0x27,0x2b,0x27,0x20,0x3a,0x20,0x64,0x61,0x74,0x61,0x2e,0x6f,0x66,0x66,
+0x73,0x65,0x74,0x20,0x3c,0x20,0x30,0x20,0x3f,0x20,0x27,0x2d,0x27,0x20,0x3a,0x20,
+0x27,0x20,0x27,0x20,0x7d,0x24,0x7b,0x5f,0x74,0x6f,0x54,0x77,0x6f,0x44,0x69,0x67,
+0x69,0x74,0x28,0x4d,0x61,0x74,0x68,0x2e,0x61,0x62,0x73,0x28,0x64,0x61,0x74,0x61,
+0x2e,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,0x2f,0x20,0x33,0x36,0x30,0x30,0x29,
+0x20,0x7d,0x3a,0x24,0x7b,0x5f,0x74,0x6f,0x54,0x77,0x6f,0x44,0x69,0x67,0x69,0x74,
+0x28,0x4d,0x61,0x74,0x68,0x2e,0x61,0x62,0x73,0x28,0x64,0x61,0x74,0x61,0x2e,0x6f,
+0x66,0x66,0x73,0x65,0x74,0x29,0x20,0x25,0x20,0x33,0x36,0x30,0x30,0x29,0x7d,0x3c,
+0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x60,0x3b,0x5f,0x74,
+0x61,0x67,0x2b,0x3d,0x60,0x3c,0x62,0x72,0x2f,0x3e,0x60,0x0a,0x6c,0x6f,0x61,0x64,
+0x4d,0x71,0x74,0x74,0x49,0x6e,0x66,0x6f,0x28,0x29,0x3b,0x7d,0x29,0x3b,0x7d,0x0a,
+0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6c,0x6f,0x61,0x64,0x4d,0x71,0x74,
+0x74,0x49,0x6e,0x66,0x6f,0x28,0x29,0x7b,0x43,0x6c,0x69,0x65,0x6e,0x74,0x2e,0x67,
+0x65,0x74,0x4d,0x71,0x74,0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,0x28,0x28,0x73,0x75,
+0x63,0x63,0x65,0x73,0x73,0x2c,0x64,0x61,0x74,0x61,0x29,0x3d,0x3e,0x7b,0x63,0x6f,
+0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x64,0x61,0x74,0x61,0x29,0x3b,
+0x5f,0x74,0x61,0x67,0x2b,0x3d,0x60,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,
+0x73,0x3d,0x27,0x69,0x6e,0x66,0x6f,0x2d,0x6c,0x69,0x6e,0x65,0x27,0x3e,0x3c,0x73,
+0x70,0x61,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,0x66,0x69,
+0x67,0x2d,0x6e,0x61,0x6d,0x65,0x22,0x3e,0x41,0x64,0x64,0x72,0x65,0x73,0x73,0x20,
+0x3a,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x63,0x6c,
+0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,0x66,0x69,0x67,0x2d,0x76,0x61,0x6c,0x75,
+0x65,0x22,0x3e,0x24,0x7b,0x64,0x61,0x74,0x61,0x2e,0x75,0x72,0x6c,0x7d,0x3c,0x2f,
+0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x60,0x3b,0x5f,0x74,0x61,
+0x67,0x2b,0x3d,0x60,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,
+0x69,0x6e,0x66,0x6f,0x2d,0x6c,0x69,0x6e,0x65,0x27,0x3e,0x3c,0x73,0x70,0x61,0x6e,
+0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,0x66,0x69,0x67,0x2d,0x6e,
+0x61,0x6d,0x65,0x22,0x3e,0x50,0x6f,0x72,0x74,0x20,0x3a,0x3c,0x2f,0x73,0x70,0x61,
+0x6e,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,
+0x6f,0x6e,0x66,0x69,0x67,0x2d,0x76,0x61,0x6c,0x75,0x65,0x22,0x3e,0x24,0x7b,0x64,
+0x61,0x74,0x61,0x2e,0x70,0x6f,0x72,0x74,0x7d,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,
+0x3c,0x2f,0x64,0x69,0x76,0x3e,0x60,0x3b,0x5f,0x74,0x61,0x67,0x2b,0x3d,0x60,0x3c,
+0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x69,0x6e,0x66,0x6f,0x2d,
+0x6c,0x69,0x6e,0x65,0x27,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x63,0x6c,0x61,0x73,
+0x73,0x3d,0x22,0x63,0x6f,0x6e,0x66,0x69,0x67,0x2d,0x6e,0x61,0x6d,0x65,0x22,0x3e,
+0x43,0x6c,0x69,0x65,0x6e,0x74,0x20,0x49,0x44,0x20,0x3a,0x3c,0x2f,0x73,0x70,0x61,
+0x6e,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,
+0x6f,0x6e,0x66,0x69,0x67,0x2d,0x76,0x61,0x6c,0x75,0x65,0x22,0x3e,0x24,0x7b,0x64,
+0x61,0x74,0x61,0x2e,0x6d,0x69,0x64,0x7d,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,
+0x2f,0x64,0x69,0x76,0x3e,0x60,0x3b,0x69,0x66,0x28,0x64,0x61,0x74,0x61,0x2e,0x6d,
+0x75,0x73,0x65,0x72,0x21,0x3d,0x27,0x27,0x29,0x7b,0x5f,0x74,0x61,0x67,0x2b,0x3d,
+0x60,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x69,0x6e,0x66,
+0x6f,0x2d,0x6c,0x69,0x6e,0x65,0x27,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x63,0x6c,
+0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,0x66,0x69,0x67,0x2d,0x6e,0x61,0x6d,0x65,
+0x22,0x3e,0x55,0x73,0x65,0x72,0x20,0x3a,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,
+0x73,0x70,0x61,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,0x66,
+0x69,0x67,0x2d,0x76,0x61,0x6c,0x75,0x65,0x22,0x3e,0x24,0x7b,0x64,0x61,0x74,0x61,
+0x2e,0x6d,0x75,0x73,0x65,0x72,0x7d,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,
+0x64,0x69,0x76,0x3e,0x60,0x3b,0x7d,0x0a,0x69,0x66,0x28,0x64,0x61,0x74,0x61,0x2e,
+0x6d,0x70,0x61,0x73,0x73,0x21,0x3d,0x27,0x27,0x29,0x7b,0x5f,0x74,0x61,0x67,0x2b,
+0x3d,0x60,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x69,0x6e,
+0x66,0x6f,0x2d,0x6c,0x69,0x6e,0x65,0x27,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x63,
+0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,0x66,0x69,0x67,0x2d,0x6e,0x61,0x6d,
+0x65,0x22,0x3e,0x50,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x20,0x3a,0x3c,0x2f,0x73,
+0x70,0x61,0x6e,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
+0x22,0x63,0x6f,0x6e,0x66,0x69,0x67,0x2d,0x76,0x61,0x6c,0x75,0x65,0x22,0x3e,0x24,
+0x7b,0x64,0x61,0x74,0x61,0x2e,0x6d,0x70,0x61,0x73,0x73,0x7d,0x3c,0x2f,0x73,0x70,
+0x61,0x6e,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x60,0x3b,0x7d,0x0a,0x5f,0x74,0x61,
+0x67,0x2b,0x3d,0x60,0x3c,0x62,0x72,0x2f,0x3e,0x60,0x3b,0x6c,0x6f,0x61,0x64,0x4f,
+0x70,0x74,0x69,0x6f,0x6e,0x73,0x28,0x29,0x3b,0x7d,0x29,0x3b,0x7d,0x0a,0x66,0x75,
+0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6c,0x6f,0x61,0x64,0x4f,0x70,0x74,0x69,0x6f,
+0x6e,0x73,0x28,0x29,0x7b,0x43,0x6c,0x69,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x4f,
+0x70,0x74,0x69,0x6f,0x6e,0x4c,0x69,0x73,0x74,0x28,0x28,0x73,0x75,0x63,0x63,0x65,
+0x73,0x73,0x2c,0x6c,0x69,0x73,0x74,0x29,0x3d,0x3e,0x7b,0x63,0x6f,0x6e,0x73,0x6f,
+0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x6c,0x69,0x73,0x74,0x29,0x0a,0x66,0x6f,0x72,
+0x28,0x6c,0x65,0x74,0x20,0x69,0x3d,0x30,0x3b,0x69,0x3c,0x6c,0x69,0x73,0x74,0x2e,
+0x6c,0x65,0x6e,0x67,0x74,0x68,0x3b,0x2b,0x2b,0x69,0x29,0x7b,0x63,0x6f,0x6e,0x73,
+0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x6c,0x69,0x73,0x74,0x5b,0x69,0x5d,0x29,
+0x3b,0x5f,0x74,0x61,0x67,0x2b,0x3d,0x60,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,
+0x73,0x73,0x3d,0x27,0x69,0x6e,0x66,0x6f,0x2d,0x6c,0x69,0x6e,0x65,0x27,0x3e,0x3c,
+0x73,0x70,0x61,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,0x66,
+0x69,0x67,0x2d,0x6e,0x61,0x6d,0x65,0x22,0x3e,0x24,0x7b,0x6c,0x69,0x73,0x74,0x5b,
+0x69,0x5d,0x2e,0x6e,0x61,0x6d,0x65,0x7d,0x20,0x3a,0x3c,0x2f,0x73,0x70,0x61,0x6e,
+0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,
+0x6e,0x66,0x69,0x67,0x2d,0x76,0x61,0x6c,0x75,0x65,0x22,0x3e,0x24,0x7b,0x6c,0x69,
+0x73,0x74,0x5b,0x69,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x7d,0x3c,0x2f,0x73,0x70,
+0x61,0x6e,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x60,0x3b,0x7d,0x0a,0x72,0x65,0x6e,
+0x64,0x65,0x72,0x49,0x6e,0x66,0x6f,0x28,0x29,0x3b,0x5f,0x63,0x6f,0x6d,0x6d,0x6f,
+0x6e,0x73,0x2e,0x68,0x69,0x64,0x65,0x4c,0x6f,0x61,0x64,0x69,0x6e,0x67,0x28,0x29,
+0x3b,0x7d,0x29,0x3b,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x72,
+0x65,0x6e,0x64,0x65,0x72,0x49,0x6e,0x66,0x6f,0x28,0x29,0x7b,0x63,0x6f,0x6e,0x73,
+0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x5f,0x65,0x6c,0x65,0x43,0x6f,0x6e,0x66,
+0x69,0x67,0x49,0x6e,0x66,0x6f,0x29,0x0a,0x5f,0x65,0x6c,0x65,0x43,0x6f,0x6e,0x66,
+0x69,0x67,0x49,0x6e,0x66,0x6f,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,
+0x3d,0x5f,0x74,0x61,0x67,0x3b,0x7d,0x7d,0x0a,0x6c,0x65,0x74,0x20,0x52,0x6f,0x75,
+0x74,0x65,0x72,0x3d,0x6e,0x65,0x77,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,
+0x28,0x29,0x7b,0x6c,0x65,0x74,0x20,0x5f,0x76,0x69,0x65,0x77,0x73,0x3d,0x7b,0x77,
+0x69,0x66,0x69,0x3a,0x57,0x69,0x66,0x69,0x43,0x6f,0x6e,0x66,0x69,0x67,0x2c,0x74,
+0x69,0x6d,0x65,0x3a,0x54,0x69,0x6d,0x65,0x43,0x6f,0x6e,0x66,0x69,0x67,0x2c,0x6d,
+0x71,0x74,0x74,0x3a,0x4d,0x71,0x74,0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,0x2c,0x6f,
+0x70,0x74,0x69,0x6f,0x6e,0x3a,0x4f,0x70,0x74,0x69,0x6f,0x6e,0x43,0x6f,0x6e,0x66,
+0x69,0x67,0x2c,0x66,0x69,0x6e,0x69,0x73,0x68,0x3a,0x46,0x69,0x6e,0x69,0x73,0x68,
+0x56,0x69,0x65,0x77,0x7d,0x3b,0x6c,0x65,0x74,0x20,0x5f,0x69,0x6e,0x69,0x74,0x69,
+0x61,0x6c,0x69,0x7a,0x65,0x64,0x3d,0x7b,0x7d,0x3b,0x74,0x68,0x69,0x73,0x2e,0x69,
+0x6e,0x69,0x74,0x3d,0x28,0x29,0x3d,0x3e,0x7b,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,
+0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,
+0x28,0x27,0x68,0x61,0x73,0x68,0x63,0x68,0x61,0x6e,0x67,0x65,0x27,0x2c,0x6f,0x6e,
+0x48,0x61,0x73,0x68,0x43,0x68,0x61,0x6e,0x67,0x65,0x29,0x3b,0x6f,0x6e,0x48,0x61,
+0x73,0x68,0x43,0x68,0x61,0x6e,0x67,0x65,0x28,0x29,0x3b,0x7d,0x0a,0x74,0x68,0x69,
+0x73,0x2e,0x67,0x6f,0x3d,0x28,0x6e,0x61,0x6d,0x65,0x29,0x3d,0x3e,0x7b,0x6c,0x6f,
+0x63,0x61,0x74,0x69,0x6f,0x6e,0x2e,0x68,0x61,0x73,0x68,0x3d,0x6e,0x61,0x6d,0x65,
+0x3b,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6f,0x6e,0x48,0x61,
+0x73,0x68,0x43,0x68,0x61,0x6e,0x67,0x65,0x28,0x29,0x7b,0x6c,0x65,0x74,0x20,0x6e,
+0x61,0x6d,0x65,0x3d,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2e,0x68,0x61,0x73,
+0x68,0x2e,0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x28,0x27,0x23,0x27,0x2c,0x27,0x27,
+0x29,0x3b,0x69,0x66,0x28,0x21,0x5f,0x76,0x69,0x65,0x77,0x73,0x5b,0x6e,0x61,0x6d,
+0x65,0x5d,0x29,0x7b,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x77,0x69,0x66,0x69,0x27,0x3b,
+0x7d,0x0a,0x66,0x6f,0x72,0x28,0x6c,0x65,0x74,0x20,0x6b,0x65,0x79,0x20,0x69,0x6e,
+0x20,0x5f,0x76,0x69,0x65,0x77,0x73,0x29,0x7b,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,
+0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,
+0x28,0x60,0x76,0x69,0x65,0x77,0x2d,0x24,0x7b,0x6b,0x65,0x79,0x7d,0x60,0x29,0x2e,
+0x68,0x69,0x64,0x64,0x65,0x6e,0x3d,0x6b,0x65,0x79,0x21,0x3d,0x6e,0x61,0x6d,0x65,
+0x3b,0x7d,0x0a,0x69,0x66,0x28,0x21,0x5f,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x69,
+0x7a,0x65,0x64,0x5b,0x6e,0x61,0x6d,0x65,0x5d,0x29,0x7b,0x5f,0x69,0x6e,0x69,0x74,
+0x69,0x61,0x6c,0x69,0x7a,0x65,0x64,0x5b,0x6e,0x61,0x6d,0x65,0x5d,0x3d,0x74,0x72,
+0x75,0x65,0x3b,0x5f,0x76,0x69,0x65,0x77,0x73,0x5b,0x6e,0x61,0x6d,0x65,0x5d,0x2e,
+0x69,0x6e,0x69,0x74,0x28,0x29,0x3b,0x7d,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x28,
+0x5f,0x76,0x69,0x65,0x77,0x73,0x5b,0x6e,0x61,0x6d,0x65,0x5d,0x2e,0x73,0x68,0x6f,
+0x77,0x29,0x7b,0x5f,0x76,0x69,0x65,0x77,0x73,0x5b,0x6e,0x61,0x6d,0x65,0x5d,0x2e,
+0x73,0x68,0x6f,0x77,0x28,0x29,0x3b,0x7d,0x7d,0x7d,0x3c,0x2f,0x73,0x63,0x72,0x69,
+0x70,0x74,0x3e,0x3c,0x2f,0x68,0x65,0x61,0x64,0x3e,0x3c,0x62,0x6f,0x64,0x79,0x20,
+0x6f,0x6e,0x6c,0x6f,0x61,0x64,0x3d,0x27,0x52,0x6f,0x75,0x74,0x65,0x72,0x2e,0x69,
+0x6e,0x69,0x74,0x28,0x29,0x27,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,
+0x73,0x3d,0x27,0x6c,0x61,0x79,0x6f,0x75,0x74,0x2d,0x6f,0x75,0x74,0x74,0x65,0x72,
+0x27,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x6c,0x61,
+0x79,0x6f,0x75,0x74,0x2d,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x73,0x27,0x3e,0x3c,
+0x64,0x69,0x76,0x20,0x69,0x64,0x3d,0x27,0x76,0x69,0x65,0x77,0x2d,0x77,0x69,0x66,
+0x69,0x27,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x76,0x69,0x65,0x77,0x27,0x20,
+0x68,0x69,0x64,0x64,0x65,0x6e,0x3e,0x3c,0x64,0x69,0x76,0x20,0x73,0x74,0x79,0x6c,
+0x65,0x3d,0x27,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x31,0x30,0x30,0x25,0x3b,0x20,
+0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x20,0x2d,0x31,0x30,
+0x70,0x78,0x3b,0x27,0x20,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,
+0x3d,0x27,0x73,0x74,0x65,0x70,0x20,0x63,0x75,0x72,0x72,0x27,0x3e,0x3c,0x61,0x20,
+0x68,0x72,0x65,0x66,0x3d,0x27,0x23,0x77,0x69,0x66,0x69,0x27,0x3e,0x57,0x69,0x66,
+0x69,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,
+0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x73,0x74,0x65,0x70,0x2d,0x61,0x72,0x72,0x6f,
+0x77,0x27,0x3e,0xe2,0x96,0xb7,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,
+0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x73,0x74,0x65,0x70,0x27,0x3e,0x54,0x69,
+0x6d,0x65,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,
+0x73,0x73,0x3d,0x27,0x73,0x74,0x65,0x70,0x2d,0x61,0x72,0x72,0x6f,0x77,0x27,0x3e,
+0xe2,0x96,0xb7,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,
+0x61,0x73,0x73,0x3d,0x27,0x73,0x74,0x65,0x70,0x27,0x3e,0x4d,0x71,0x74,0x74,0x3c,
+0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
+0x27,0x73,0x74,0x65,0x70,0x2d,0x61,0x72,0x72,0x6f,0x77,0x27,0x3e,0xe2,0x96,0xb7,
+0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,
+0x3d,0x27,0x73,0x74,0x65,0x70,0x27,0x3e,0x4f,0x70,0x74,0x69,0x6f,0x6e,0x73,0x3c,
+0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
+0x27,0x73,0x74,0x65,0x70,0x2d,0x61,0x72,0x72,0x6f,0x77,0x27,0x3e,0xe2,0x96,0xb7,
+0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,
+0x3d,0x27,0x73,0x74,0x65,0x70,0x27,0x3e,0x46,0x69,0x6e,0x69,0x73,0x68,0x3c,0x2f,
+0x64,0x69,0x76,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x68,0x32,0x3e,0x57,0x69,
+0x66,0x69,0x20,0x41,0x63,0x63,0x65,0x73,0x73,0x3c,0x2f,0x68,0x32,0x3e,0x3c,0x64,
+0x69,0x76,0x20,0x69,0x64,0x3d,0x27,0x77,0x69,0x66,0x69,0x2d,0x6c,0x69,0x73,0x74,
+0x27,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x62,0x72,0x2f,0x3e,0x3c,0x64,0x69,
+0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x66,0x6f,0x72,0x6d,0x27,0x3e,0x3c,
+0x73,0x70,0x61,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x6c,0x61,0x62,0x65,
+0x6c,0x27,0x3e,0x20,0x53,0x53,0x49,0x44,0x3a,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,
+0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,
+0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x77,0x69,0x66,0x69,0x2d,0x73,0x73,0x69,0x64,
+0x27,0x2f,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,
+0x61,0x73,0x73,0x3d,0x27,0x66,0x6f,0x72,0x6d,0x27,0x3e,0x3c,0x73,0x70,0x61,0x6e,
+0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x6c,0x61,0x62,0x65,0x6c,0x27,0x3e,0x20,
+0x50,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x3a,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,
+0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,
+0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x77,0x69,0x66,0x69,0x2d,0x70,0x61,0x73,0x73,
+0x77,0x64,0x27,0x2f,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,
+0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x72,0x65,0x73,0x75,0x6c,0x74,0x27,0x3e,0x3c,
+0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
+0x27,0x6c,0x61,0x79,0x6f,0x75,0x74,0x2d,0x6f,0x75,0x74,0x74,0x65,0x72,0x27,0x20,
+0x73,0x74,0x79,0x6c,0x65,0x3d,0x27,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x74,0x6f,
+0x70,0x3a,0x20,0x35,0x30,0x70,0x78,0x3b,0x27,0x3e,0x3c,0x62,0x75,0x74,0x74,0x6f,
+0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x74,0x6e,0x2d,0x63,0x6f,0x6d,
+0x6d,0x69,0x74,0x27,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x27,0x77,0x69,0x64,0x74,
+0x68,0x3a,0x20,0x34,0x39,0x25,0x3b,0x27,0x3e,0x53,0x75,0x62,0x6d,0x69,0x74,0x3c,
+0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,
+0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x74,0x6e,0x2d,0x6e,0x65,0x78,0x74,0x27,
+0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x27,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x34,
+0x39,0x25,0x3b,0x27,0x3e,0x4e,0x65,0x78,0x74,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,
+0x6e,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x62,0x72,0x2f,0x3e,0x3c,0x62,0x72,
+0x2f,0x3e,0x3c,0x62,0x72,0x2f,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,
+0x76,0x20,0x69,0x64,0x3d,0x27,0x76,0x69,0x65,0x77,0x2d,0x74,0x69,0x6d,0x65,0x27,
+0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x76,0x69,0x65,0x77,0x27,0x20,0x68,0x69,
+0x64,0x64,0x65,0x6e,0x3e,0x3c,0x64,0x69,0x76,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,
+0x27,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x31,0x30,0x30,0x25,0x3b,0x20,0x6d,0x61,
+0x72,0x67,0x69,0x6e,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x20,0x2d,0x31,0x30,0x70,0x78,
+0x3b,0x27,0x20,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,
+0x73,0x74,0x65,0x70,0x20,0x63,0x6f,0x6d,0x70,0x27,0x3e,0x3c,0x61,0x20,0x68,0x72,
+0x65,0x66,0x3d,0x27,0x23,0x77,0x69,0x66,0x69,0x27,0x3e,0x57,0x69,0x66,0x69,0x3c,
+0x2f,0x61,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,
+0x61,0x73,0x73,0x3d,0x27,0x73,0x74,0x65,0x70,0x2d,0x61,0x72,0x72,0x6f,0x77,0x20,
+0x63,0x6f,0x6d,0x70,0x27,0x3e,0xe2,0x96,0xb6,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,
+0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x73,0x74,0x65,0x70,0x20,
+0x63,0x75,0x72,0x72,0x27,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x27,0x23,
+0x74,0x69,0x6d,0x65,0x27,0x3e,0x54,0x69,0x6d,0x65,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,
+0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,
+0x73,0x74,0x65,0x70,0x2d,0x61,0x72,0x72,0x6f,0x77,0x27,0x3e,0xe2,0x96,0xb7,0x3c,
+0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
+0x27,0x73,0x74,0x65,0x70,0x27,0x3e,0x4d,0x71,0x74,0x74,0x3c,0x2f,0x64,0x69,0x76,
+0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x73,0x74,0x65,
+0x70,0x2d,0x61,0x72,0x72,0x6f,0x77,0x27,0x3e,0xe2,0x96,0xb7,0x3c,0x2f,0x64,0x69,
+0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x73,0x74,
+0x65,0x70,0x27,0x3e,0x4f,0x70,0x74,0x69,0x6f,0x6e,0x73,0x3c,0x2f,0x64,0x69,0x76,
+0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x73,0x74,0x65,
+0x70,0x2d,0x61,0x72,0x72,0x6f,0x77,0x27,0x3e,0xe2,0x96,0xb7,0x3c,0x2f,0x64,0x69,
+0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x73,0x74,
+0x65,0x70,0x27,0x3e,0x46,0x69,0x6e,0x69,0x73,0x68,0x3c,0x2f,0x64,0x69,0x76,0x3e,
+0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x68,0x32,0x3e,0x54,0x69,0x6d,0x65,0x20,0x73,
+0x65,0x74,0x74,0x69,0x6e,0x67,0x3c,0x2f,0x68,0x32,0x3e,0x3c,0x64,0x69,0x76,0x20,
+0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x66,0x6f,0x72,0x6d,0x27,0x3e,0x3c,0x73,0x70,
+0x61,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x6c,0x61,0x62,0x65,0x6c,0x27,
+0x3e,0x20,0x4e,0x54,0x50,0x20,0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x3c,0x2f,0x73,
+0x70,0x61,0x6e,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,
+0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x69,0x6e,0x70,0x75,0x74,
+0x2d,0x6e,0x74,0x70,0x27,0x20,0x6d,0x61,0x78,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3d,
+0x27,0x36,0x34,0x27,0x2f,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,
+0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x66,0x6f,0x72,0x6d,0x27,0x3e,0x3c,0x73,
+0x70,0x61,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x6c,0x61,0x62,0x65,0x6c,
+0x27,0x3e,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x3a,0x3c,0x2f,0x73,0x70,0x61,
+0x6e,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x6e,
+0x75,0x6d,0x62,0x65,0x72,0x27,0x20,0x69,0x64,0x3d,0x27,0x69,0x6e,0x70,0x75,0x74,
+0x2d,0x69,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x27,0x2f,0x3e,0x3c,0x73,0x75,0x62,
+0x3e,0x6d,0x69,0x6e,0x3c,0x2f,0x73,0x75,0x62,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,
+0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x66,0x6f,0x72,0x6d,
+0x27,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x6c,
+0x61,0x62,0x65,0x6c,0x27,0x3e,0x20,0x54,0x69,0x6d,0x65,0x20,0x7a,0x6f,0x6e,0x65,
+0x3a,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x73,0x65,0x6c,0x65,0x63,0x74,0x20,
+0x69,0x64,0x3d,0x27,0x73,0x65,0x6c,0x65,0x63,0x74,0x2d,0x75,0x74,0x63,0x27,0x3e,
+0x3c,0x2f,0x73,0x65,0x6c,0x65,0x63,0x74,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,
+0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x66,0x6f,0x72,0x6d,0x27,
+0x20,0x69,0x64,0x3d,0x27,0x62,0x6c,0x6f,0x63,0x6b,0x2d,0x74,0x69,0x6d,0x65,0x6f,
+0x66,0x66,0x73,0x65,0x74,0x27,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x27,0x64,0x69,
+0x73,0x70,0x6c,0x61,0x79,0x3a,0x20,0x6e,0x6f,0x6e,0x65,0x3b,0x27,0x3e,0x3c,0x73,
+0x70,0x61,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x6c,0x61,0x62,0x65,0x6c,
+0x27,0x3e,0x20,0x54,0x69,0x6d,0x65,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x3a,0x3c,
+0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,
+0x65,0x3d,0x27,0x6e,0x75,0x6d,0x62,0x65,0x72,0x27,0x20,0x69,0x64,0x3d,0x27,0x69,
+0x6e,0x70,0x75,0x74,0x2d,0x6d,0x61,0x6e,0x75,0x61,0x6c,0x6c,0x79,0x2d,0x75,0x74,
+0x63,0x27,0x3e,0x3c,0x73,0x75,0x62,0x3e,0x73,0x65,0x63,0x3c,0x2f,0x73,0x75,0x62,
+0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,
+0x73,0x3d,0x27,0x72,0x65,0x73,0x75,0x6c,0x74,0x27,0x3e,0x3c,0x2f,0x64,0x69,0x76,
+0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x6c,0x61,0x79,
+0x6f,0x75,0x74,0x2d,0x6f,0x75,0x74,0x74,0x65,0x72,0x27,0x20,0x73,0x74,0x79,0x6c,
+0x65,0x3d,0x27,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x74,0x6f,0x70,0x3a,0x20,0x35,
+0x30,0x70,0x78,0x3b,0x27,0x3e,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x63,0x6c,
+0x61,0x73,0x73,0x3d,0x27,0x62,0x74,0x6e,0x2d,0x63,0x6f,0x6d,0x6d,0x69,0x74,0x27,
+0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x27,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x34,
+0x39,0x25,0x3b,0x27,0x3e,0x53,0x75,0x62,0x6d,0x69,0x74,0x3c,0x2f,0x62,0x75,0x74,
+0x74,0x6f,0x6e,0x3e,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x63,0x6c,0x61,0x73,
+0x73,0x3d,0x27,0x62,0x74,0x6e,0x2d,0x6e,0x65,0x78,0x74,0x27,0x20,0x73,0x74,0x79,
+0x6c,0x65,0x3d,0x27,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x34,0x39,0x25,0x3b,0x27,
+0x3e,0x4e,0x65,0x78,0x74,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x3c,0x2f,
+0x64,0x69,0x76,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x69,
+0x64,0x3d,0x27,0x76,0x69,0x65,0x77,0x2d,0x6d,0x71,0x74,0x74,0x27,0x20,0x63,0x6c,
+0x61,0x73,0x73,0x3d,0x27,0x76,0x69,0x65,0x77,0x27,0x20,0x68,0x69,0x64,0x64,0x65,
+0x6e,0x3e,0x3c,0x64,0x69,0x76,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x27,0x77,0x69,
+0x64,0x74,0x68,0x3a,0x20,0x31,0x30,0x30,0x25,0x3b,0x20,0x6d,0x61,0x72,0x67,0x69,
+0x6e,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x20,0x2d,0x31,0x30,0x70,0x78,0x3b,0x27,0x20,
+0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x73,0x74,0x65,
+0x70,0x20,0x63,0x6f,0x6d,0x70,0x27,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,
+0x27,0x23,0x77,0x69,0x66,0x69,0x27,0x3e,0x57,0x69,0x66,0x69,0x3c,0x2f,0x61,0x3e,
+0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,
+0x3d,0x27,0x73,0x74,0x65,0x70,0x2d,0x61,0x72,0x72,0x6f,0x77,0x20,0x63,0x6f,0x6d,
+0x70,0x27,0x3e,0xe2,0x96,0xb6,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,
+0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x73,0x74,0x65,0x70,0x20,0x63,0x6f,0x6d,
+0x70,0x27,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x27,0x23,0x74,0x69,0x6d,
+0x65,0x27,0x3e,0x54,0x69,0x6d,0x65,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x64,0x69,0x76,
+0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x73,0x74,0x65,
+0x70,0x2d,0x61,0x72,0x72,0x6f,0x77,0x20,0x63,0x6f,0x6d,0x70,0x27,0x3e,0xe2,0x96,
+0xb6,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,
+0x73,0x3d,0x27,0x73,0x74,0x65,0x70,0x20,0x63,0x75,0x72,0x72,0x27,0x3e,0x4d,0x71,
+0x74,0x74,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,
+0x73,0x73,0x3d,0x27,0x73,0x74,0x65,0x70,0x2d,0x61,0x72,0x72,0x6f,0x77,0x27,0x3e,
+0xe2,0x96,0xb7,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,
+0x61,0x73,0x73,0x3d,0x27,0x73,0x74,0x65,0x70,0x27,0x3e,0x4f,0x70,0x74,0x69,0x6f,
+0x6e,0x73,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,
+0x73,0x73,0x3d,0x27,0x73,0x74,0x65,0x70,0x2d,0x61,0x72,0x72,0x6f,0x77,0x27,0x3e,
+0xe2,0x96,0xb7,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,
+0x61,0x73,0x73,0x3d,0x27,0x73,0x74,0x65,0x70,0x27,0x3e,0x46,0x69,0x6e,0x69,0x73,
+0x68,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x68,0x32,
+0x3e,0x4d,0x51,0x54,0x54,0x20,0x43,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x69,0x6f,0x6e,
+0x3c,0x2f,0x68,0x32,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
+0x27,0x66,0x6f,0x72,0x6d,0x27,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,0x63,0x6c,0x61,
+0x73,0x73,0x3d,0x27,0x6c,0x61,0x62,0x65,0x6c,0x27,0x3e,0x41,0x64,0x64,0x72,0x65,
+0x73,0x73,0x3a,0x20,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x69,0x6e,0x70,0x75,
+0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,
+0x3d,0x27,0x69,0x6e,0x70,0x75,0x74,0x2d,0x6d,0x71,0x74,0x74,0x2d,0x61,0x64,0x64,
+0x72,0x27,0x2f,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,
+0x6c,0x61,0x73,0x73,0x3d,0x27,0x66,0x6f,0x72,0x6d,0x27,0x3e,0x3c,0x73,0x70,0x61,
+0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x6c,0x61,0x62,0x65,0x6c,0x27,0x3e,
+0x50,0x6f,0x72,0x74,0x3a,0x20,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x69,0x6e,
+0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x6e,0x75,0x6d,0x62,0x65,0x72,
+0x27,0x20,0x69,0x64,0x3d,0x27,0x69,0x6e,0x70,0x75,0x74,0x2d,0x6d,0x71,0x74,0x74,
+0x2d,0x70,0x6f,0x72,0x74,0x27,0x2f,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,
+0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x66,0x6f,0x72,0x6d,0x27,0x3e,
+0x3c,0x73,0x70,0x61,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x6c,0x61,0x62,
+0x65,0x6c,0x27,0x3e,0x43,0x6c,0x69,0x65,0x6e,0x74,0x49,0x44,0x3a,0x20,0x3c,0x2f,
+0x73,0x70,0x61,0x6e,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,
+0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x69,0x6e,0x70,0x75,
+0x74,0x2d,0x6d,0x71,0x74,0x74,0x2d,0x63,0x6c,0x69,0x65,0x6e,0x74,0x69,0x64,0x27,
+0x2f,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,
+0x73,0x73,0x3d,0x27,0x66,0x6f,0x72,0x6d,0x27,0x3e,0x3c,0x73,0x70,0x61,0x6e,0x20,
+0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x6c,0x61,0x62,0x65,0x6c,0x27,0x3e,0x55,0x73,
+0x65,0x72,0x3a,0x20,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x69,0x6e,0x70,0x75,
+0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,
+0x3d,0x27,0x69,0x6e,0x70,0x75,0x74,0x2d,0x6d,0x71,0x74,0x74,0x2d,0x75,0x73,0x65,
+0x72,0x27,0x2f,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,
+0x6c,0x61,0x73,0x73,0x3d,0x27,0x66,0x6f,0x72,0x6d,0x27,0x3e,0x3c,0x73,0x70,0x61,
+0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x6c,0x61,0x62,0x65,0x6c,0x27,0x3e,
+0x50,0x61,0x73,0x73,0x77,0x6f,0x72,0x64,0x3a,0x20,0x3c,0x2f,0x73,0x70,0x61,0x6e,
+0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x70,0x61,
+0x73,0x73,0x77,0x6f,0x72,0x64,0x27,0x20,0x69,0x64,0x3d,0x27,0x69,0x6e,0x70,0x75,
+0x74,0x2d,0x6d,0x71,0x74,0x74,0x2d,0x70,0x61,0x73,0x73,0x27,0x2f,0x3e,0x3c,0x2f,
+0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,
+0x72,0x65,0x73,0x75,0x6c,0x74,0x27,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,
+0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x6c,0x61,0x79,0x6f,0x75,0x74,
+0x2d,0x6f,0x75,0x74,0x74,0x65,0x72,0x27,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x27,
+0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x74,0x6f,0x70,0x3a,0x20,0x35,0x30,0x70,0x78,
+0x3b,0x27,0x3e,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,
+0x3d,0x27,0x62,0x74,0x6e,0x2d,0x63,0x6f,0x6d,0x6d,0x69,0x74,0x27,0x20,0x73,0x74,
+0x79,0x6c,0x65,0x3d,0x27,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x34,0x39,0x25,0x3b,
+0x27,0x3e,0x53,0x75,0x62,0x6d,0x69,0x74,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,
+0x3e,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,
+0x62,0x74,0x6e,0x2d,0x6e,0x65,0x78,0x74,0x27,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,
+0x27,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x34,0x39,0x25,0x3b,0x27,0x3e,0x4e,0x65,
+0x78,0x74,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x3c,0x2f,0x64,0x69,0x76,
+0x3e,0x3c,0x62,0x72,0x2f,0x3e,0x3c,0x62,0x72,0x2f,0x3e,0x3c,0x62,0x72,0x2f,0x3e,
+0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x69,0x64,0x3d,0x27,0x76,
+0x69,0x65,0x77,0x2d,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x27,0x20,0x63,0x6c,0x61,0x73,
+0x73,0x3d,0x27,0x76,0x69,0x65,0x77,0x27,0x20,0x68,0x69,0x64,0x64,0x65,0x6e,0x3e,
+0x3c,0x64,0x69,0x76,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x27,0x77,0x69,0x64,0x74,
+0x68,0x3a,0x20,0x31,0x30,0x30,0x25,0x3b,0x20,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,
+0x6c,0x65,0x66,0x74,0x3a,0x20,0x2d,0x31,0x30,0x70,0x78,0x3b,0x27,0x20,0x3e,0x3c,
+0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x73,0x74,0x65,0x70,0x20,
+0x63,0x6f,0x6d,0x70,0x27,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x27,0x23,
+0x77,0x69,0x66,0x69,0x27,0x3e,0x57,0x69,0x66,0x69,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,
+0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,
+0x73,0x74,0x65,0x70,0x2d,0x61,0x72,0x72,0x6f,0x77,0x20,0x63,0x6f,0x6d,0x70,0x27,
+0x3e,0xe2,0x96,0xb6,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,
+0x6c,0x61,0x73,0x73,0x3d,0x27,0x73,0x74,0x65,0x70,0x20,0x63,0x6f,0x6d,0x70,0x27,
+0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x27,0x23,0x74,0x69,0x6d,0x65,0x27,
+0x3e,0x54,0x69,0x6d,0x65,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,
+0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x73,0x74,0x65,0x70,0x2d,
+0x61,0x72,0x72,0x6f,0x77,0x20,0x63,0x6f,0x6d,0x70,0x27,0x3e,0xe2,0x96,0xb6,0x3c,
+0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
+0x27,0x73,0x74,0x65,0x70,0x20,0x63,0x6f,0x6d,0x70,0x27,0x3e,0x3c,0x61,0x20,0x68,
+0x72,0x65,0x66,0x3d,0x27,0x23,0x6d,0x71,0x74,0x74,0x27,0x3e,0x4d,0x71,0x74,0x74,
+0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,
+0x6c,0x61,0x73,0x73,0x3d,0x27,0x73,0x74,0x65,0x70,0x2d,0x61,0x72,0x72,0x6f,0x77,
+0x20,0x63,0x6f,0x6d,0x70,0x27,0x3e,0xe2,0x96,0xb6,0x3c,0x2f,0x64,0x69,0x76,0x3e,
+0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x73,0x74,0x65,0x70,
+0x20,0x63,0x75,0x72,0x72,0x27,0x3e,0x4f,0x70,0x74,0x69,0x6f,0x6e,0x73,0x3c,0x2f,
+0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,
+0x73,0x74,0x65,0x70,0x2d,0x61,0x72,0x72,0x6f,0x77,0x27,0x3e,0xe2,0x96,0xb7,0x3c,
+0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
+0x27,0x73,0x74,0x65,0x70,0x27,0x3e,0x46,0x69,0x6e,0x69,0x73,0x68,0x3c,0x2f,0x64,
+0x69,0x76,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x68,0x32,0x3e,0x4f,0x70,0x74,
+0x69,0x6f,0x6e,0x73,0x3c,0x2f,0x68,0x32,0x3e,0x3c,0x64,0x69,0x76,0x20,0x69,0x64,
+0x3d,0x27,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x73,0x27,0x3e,0x3c,0x2f,0x64,0x69,0x76,
+0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x72,0x65,0x73,
+0x75,0x6c,0x74,0x27,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,
+0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x6c,0x61,0x79,0x6f,0x75,0x74,0x2d,0x6f,0x75,
+0x74,0x74,0x65,0x72,0x27,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x27,0x6d,0x61,0x72,
+0x67,0x69,0x6e,0x2d,0x74,0x6f,0x70,0x3a,0x20,0x35,0x30,0x70,0x78,0x3b,0x27,0x3e,
+0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,
+0x74,0x6e,0x2d,0x63,0x6f,0x6d,0x6d,0x69,0x74,0x27,0x20,0x73,0x74,0x79,0x6c,0x65,
+0x3d,0x27,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x34,0x39,0x25,0x3b,0x27,0x3e,0x53,
+0x75,0x62,0x6d,0x69,0x74,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x3c,0x62,
+0x75,0x74,0x74,0x6f,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x74,0x6e,
+0x2d,0x6e,0x65,0x78,0x74,0x27,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x27,0x77,0x69,
+0x64,0x74,0x68,0x3a,0x20,0x34,0x39,0x25,0x3b,0x27,0x3e,0x4e,0x65,0x78,0x74,0x3c,
+0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x62,
+0x72,0x2f,0x3e,0x3c,0x62,0x72,0x2f,0x3e,0x3c,0x62,0x72,0x2f,0x3e,0x3c,0x2f,0x64,
+0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x69,0x64,0x3d,0x27,0x76,0x69,0x65,0x77,
+0x2d,0x66,0x69,0x6e,0x69,0x73,0x68,0x27,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,
+0x76,0x69,0x65,0x77,0x27,0x20,0x68,0x69,0x64,0x64,0x65,0x6e,0x3e,0x3c,0x64,0x69,
+0x76,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x27,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,
+0x31,0x30,0x30,0x25,0x3b,0x20,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x6c,0x65,0x66,
+0x74,0x3a,0x20,0x2d,0x31,0x30,0x70,0x78,0x3b,0x27,0x20,0x3e,0x3c,0x64,0x69,0x76,
+0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x73,0x74,0x65,0x70,0x20,0x63,0x6f,0x6d,
+0x70,0x27,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x27,0x23,0x77,0x69,0x66,
+0x69,0x27,0x3e,0x57,0x69,0x66,0x69,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x64,0x69,0x76,
+0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x73,0x74,0x65,
+0x70,0x2d,0x61,0x72,0x72,0x6f,0x77,0x20,0x63,0x6f,0x6d,0x70,0x27,0x3e,0xe2,0x96,
+0xb6,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,
+0x73,0x3d,0x27,0x73,0x74,0x65,0x70,0x20,0x63,0x6f,0x6d,0x70,0x27,0x3e,0x3c,0x61,
+0x20,0x68,0x72,0x65,0x66,0x3d,0x27,0x23,0x74,0x69,0x6d,0x65,0x27,0x3e,0x54,0x69,
+0x6d,0x65,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,
+0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x73,0x74,0x65,0x70,0x2d,0x61,0x72,0x72,
+0x6f,0x77,0x20,0x63,0x6f,0x6d,0x70,0x27,0x3e,0xe2,0x96,0xb6,0x3c,0x2f,0x64,0x69,
+0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x73,0x74,
+0x65,0x70,0x20,0x63,0x6f,0x6d,0x70,0x27,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,
+0x3d,0x27,0x23,0x6d,0x71,0x74,0x74,0x27,0x3e,0x4d,0x71,0x74,0x74,0x3c,0x2f,0x61,
+0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,
+0x73,0x3d,0x27,0x73,0x74,0x65,0x70,0x2d,0x61,0x72,0x72,0x6f,0x77,0x20,0x63,0x6f,
+0x6d,0x70,0x27,0x3e,0xe2,0x96,0xb6,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,
+0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x73,0x74,0x65,0x70,0x20,0x63,0x6f,
+0x6d,0x70,0x27,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x27,0x23,0x6f,0x70,
+0x74,0x69,0x6f,0x6e,0x27,0x3e,0x4f,0x70,0x74,0x69,0x6f,0x6e,0x73,0x3c,0x2f,0x61,
+0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,
+0x73,0x3d,0x27,0x73,0x74,0x65,0x70,0x2d,0x61,0x72,0x72,0x6f,0x77,0x20,0x63,0x6f,
+0x6d,0x70,0x27,0x3e,0xe2,0x96,0xb6,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,
+0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x73,0x74,0x65,0x70,0x20,0x63,0x75,
+0x72,0x72,0x27,0x3e,0x46,0x69,0x6e,0x69,0x73,0x68,0x3c,0x2f,0x64,0x69,0x76,0x3e,
+0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x68,0x32,0x3e,0x43,0x6f,0x6e,0x66,0x69,0x67,
+0x75,0x72,0x61,0x74,0x69,0x6f,0x6e,0x20,0x43,0x6f,0x6d,0x70,0x6c,0x65,0x74,0x65,
+0x3c,0x2f,0x68,0x32,0x3e,0x3c,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x69,
+0x64,0x3d,0x27,0x63,0x6f,0x6e,0x66,0x69,0x67,0x2d,0x69,0x6e,0x66,0x6f,0x27,0x3e,
+0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,
+0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x72,0x65,0x73,0x75,0x6c,0x74,0x27,0x3e,
+0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,
+0x3d,0x27,0x6c,0x61,0x79,0x6f,0x75,0x74,0x2d,0x6f,0x75,0x74,0x74,0x65,0x72,0x27,
+0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x27,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x74,
+0x6f,0x70,0x3a,0x20,0x35,0x30,0x70,0x78,0x3b,0x27,0x3e,0x3c,0x62,0x75,0x74,0x74,
+0x6f,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x74,0x6e,0x2d,0x63,0x6f,
+0x6d,0x6d,0x69,0x74,0x27,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x27,0x77,0x69,0x64,
+0x74,0x68,0x3a,0x20,0x34,0x39,0x25,0x3b,0x27,0x3e,0x4f,0x4b,0x3c,0x2f,0x62,0x75,
+0x74,0x74,0x6f,0x6e,0x3e,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x63,0x6c,0x61,
+0x73,0x73,0x3d,0x27,0x62,0x74,0x6e,0x2d,0x6e,0x65,0x78,0x74,0x27,0x20,0x73,0x74,
+0x79,0x6c,0x65,0x3d,0x27,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x34,0x39,0x25,0x3b,
+0x20,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x20,0x6e,0x6f,0x6e,0x65,0x3b,0x27,
+0x3e,0x4e,0x65,0x78,0x74,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x3c,0x2f,
+0x64,0x69,0x76,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,
+0x6c,0x61,0x73,0x73,0x3d,0x27,0x6c,0x61,0x79,0x6f,0x75,0x74,0x2d,0x6c,0x6f,0x61,
+0x64,0x69,0x6e,0x67,0x27,0x20,0x69,0x64,0x3d,0x27,0x77,0x69,0x66,0x69,0x2d,0x6c,
+0x6f,0x61,0x64,0x69,0x6e,0x67,0x27,0x3e,0x3c,0x64,0x69,0x76,0x20,0x69,0x64,0x3d,
+0x27,0x74,0x65,0x78,0x74,0x2d,0x6c,0x6f,0x61,0x64,0x69,0x6e,0x67,0x27,0x3e,0x4c,
+0x6f,0x61,0x64,0x69,0x6e,0x67,0x2e,0x2e,0x2e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,
+0x2f,0x64,0x69,0x76,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x2f,0x64,0x69,0x76,
+0x3e,0x3c,0x2f,0x62,0x6f,0x64,0x79,0x3e,0x3c,0x2f,0x68,0x74,0x6d,0x6c,0x3e
+};
+#else
+#define RES_INDEX_HTML_LEN 0
+#define RES_INDEX_HTML ((const uint8_t*)NULL)
+#endif
+#define RES_INDEX_HTML_GZ_LEN 7541
+static const uint8_t RES_INDEX_HTML_GZ[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xed,0x3d,0xdb,0x72,0xdb,0x46,
+0xb2,0xef,0xfa,0x0a,0x98,0x51,0x0c,0x60,0x05,0x42,0xd4,0x35,0x36,0x41,0xd0,0xe5,
+0xc8,0x4a,0xe2,0x3d,0xbe,0x1d,0x5b,0x4e,0xb2,0xe5,0x72,0x59,0x43,0x60,0x48,0x4e,
+0x0c,0x02,0x08,0x30,0x94,0xa8,0xc0,0xa8,0xda,0xf7,0x7d,0xdf,0x4f,0x39,0xe7,0x7f,
+0xf2,0x25,0xa7,0x7a,0x2e,0xc0,0xe0,0x46,0x52,0xb2,0x73,0x76,0xb7,0x76,0x4b,0x55,
+0x14,0x31,0x97,0x9e,0x9e,0x9e,0xee,0x9e,0xee,0x9e,0xc6,0x70,0x74,0xef,0xc9,0xcb,
+0xb3,0x8b,0xbf,0xbc,0x3a,0xd7,0xe6,0x74,0x11,0x8c,0x47,0xf0,0xa9,0x05,0x28,0x9c,
+0xb9,0x3a,0x0e,0xf5,0xf1,0x68,0x8e,0x91,0x3f,0x1e,0x2d,0x30,0x45,0x9a,0x37,0x47,
+0x49,0x8a,0xa9,0xab,0xbf,0xbd,0xf8,0xae,0xff,0x40,0x1f,0x8f,0x28,0xa1,0x01,0x1e,
+0x9f,0x45,0xe1,0x94,0xcc,0x96,0x09,0xa2,0x24,0x0a,0xb5,0x9f,0xc8,0x6f,0x28,0xf1,
+0x47,0xfb,0xbc,0x8e,0x77,0x0c,0xd1,0x02,0xbb,0xfa,0x15,0xc1,0xd7,0x71,0x94,0x50,
+0x5d,0xf3,0xa2,0x90,0xe2,0x90,0xba,0xfa,0x35,0xf1,0xe9,0xdc,0xf5,0xf1,0x15,0xf1,
+0x70,0x9f,0x3d,0x58,0xda,0x32,0xc5,0x49,0x3f,0xf5,0x50,0x80,0x26,0x01,0x76,0xc3,
+0x48,0x1f,0x8f,0x52,0x7a,0x13,0xe0,0x31,0x60,0x66,0x4d,0x22,0xff,0x26,0x9b,0x46,
+0x21,0xed,0x4f,0xd1,0x82,0x04,0x37,0xc3,0x27,0x11,0x5d,0x2e,0x2c,0xdd,0x4f,0x22,
+0xe2,0x6b,0x29,0x0a,0x53,0x6d,0x8a,0x82,0x60,0x82,0xbc,0x8f,0xba,0xa5,0x3f,0x8e,
+0xe3,0x00,0x7f,0x1f,0xd1,0x39,0xf1,0x74,0x0b,0x2a,0xfb,0x29,0x4e,0xc8,0xd4,0x61,
+0x00,0x52,0xf2,0x1b,0x1e,0x1e,0x1c,0xc6,0xd4,0x61,0x23,0x0f,0x0f,0x06,0x83,0xaf,
+0x9d,0x39,0x26,0xb3,0x39,0xe5,0xdf,0x17,0x28,0x99,0x91,0x70,0x38,0x70,0xbc,0x28,
+0x88,0x92,0xe1,0x57,0x47,0x47,0x47,0xf9,0xfc,0x30,0xe3,0xc5,0xfd,0x00,0x4f,0xe9,
+0xb0,0x7f,0x30,0x88,0x57,0x1c,0xdc,0x35,0xef,0xf9,0x70,0x50,0xb4,0x3f,0x39,0x39,
+0x11,0x30,0xfa,0x34,0x8a,0x87,0x65,0x53,0x36,0xf2,0xd1,0x20,0xa6,0x39,0xca,0x28,
+0x5e,0xd1,0xbe,0x8f,0xbd,0x88,0xd3,0x6f,0x18,0x46,0x21,0x96,0x00,0xa6,0xd3,0x69,
+0x8e,0x86,0x57,0x24,0x25,0x14,0xfb,0xad,0x2d,0x73,0x34,0x9c,0x47,0x57,0x38,0xe9,
+0xaa,0x9c,0x46,0xde,0x32,0x5d,0xdb,0xd3,0x42,0x43,0xe4,0x51,0x72,0x85,0xdb,0x5b,
+0x91,0x30,0x5e,0xd2,0x6c,0x12,0x25,0x3e,0x4e,0xfa,0x09,0xf2,0xc9,0x32,0x1d,0x9e,
+0xc4,0x2b,0x87,0x97,0x0c,0x0f,0xe2,0x95,0x96,0x46,0x01,0xf1,0xb5,0xaf,0x10,0x42,
+0x92,0x7a,0x87,0xc7,0xf1,0x4a,0x12,0xf5,0xf8,0x28,0x5e,0x39,0x31,0xf2,0x7d,0x12,
+0xce,0x86,0x03,0xed,0x41,0xbc,0xd2,0xd8,0x67,0x9e,0xe2,0x00,0x7b,0x34,0x93,0x5d,
+0x1e,0x14,0x40,0x37,0x0f,0x53,0x82,0x3b,0x62,0xe0,0x60,0x88,0x05,0x09,0xfb,0x62,
+0xc8,0xd3,0x41,0xbc,0xca,0x27,0x4b,0x4a,0xa3,0x70,0x6b,0xcc,0x81,0x61,0x66,0x49,
+0xb4,0x0c,0xfd,0xbe,0x20,0x3e,0xc6,0x58,0xce,0xe1,0x04,0x56,0x4e,0x20,0x7a,0x04,
+0xdf,0xbd,0x65,0x92,0x46,0xc9,0x30,0x8e,0x48,0x48,0x71,0x22,0xc6,0x1a,0xfa,0x24,
+0x05,0x9e,0xf5,0x2d,0x4e,0xd9,0xe2,0x39,0x6b,0x02,0x9f,0x1e,0xc1,0x9f,0x5c,0x67,
+0xcf,0xf3,0x5a,0xd0,0xf2,0x3c,0x4f,0x42,0xe6,0x6b,0xdc,0x04,0x33,0x99,0x4c,0x72,
+0x3b,0x40,0x37,0xd1,0x92,0xf6,0xa3,0x25,0xa5,0x38,0xc9,0x14,0x5e,0x66,0x0b,0x8a,
+0x02,0x32,0x0b,0x87,0x1e,0x66,0x88,0xca,0xb6,0x42,0x00,0x53,0xb5,0xf5,0x02,0xad,
+0x04,0x01,0x8f,0x0e,0x61,0x8e,0x4a,0x6f,0x60,0x75,0xc7,0x27,0x69,0x1c,0xa0,0x9b,
+0x21,0x09,0x03,0x12,0xe2,0xfe,0x24,0x88,0xbc,0x8f,0x75,0xf6,0xce,0xed,0x69,0x94,
+0x2c,0x84,0x84,0xb0,0x12,0x6d,0x00,0x7f,0x8e,0x17,0x60,0x94,0x0c,0x27,0x11,0x9d,
+0x03,0x0e,0x13,0x1c,0x88,0x91,0x1f,0xd6,0x46,0x4a,0x80,0xc6,0x52,0xf0,0x4e,0xe2,
+0x95,0x76,0xc2,0x41,0xb4,0x8e,0x2e,0x40,0xf5,0xa3,0x18,0xf8,0xb5,0x0f,0x5a,0x26,
+0x53,0x24,0x7b,0x10,0xd3,0x8a,0x64,0x4e,0xa2,0xc0,0x6f,0x9f,0x45,0x17,0x02,0x83,
+0x12,0x81,0xdc,0x4e,0xc9,0xac,0x7f,0xa0,0xac,0xc1,0x30,0xc1,0x3e,0x2f,0x3d,0x54,
+0x4b,0xbf,0x9a,0x4e,0x27,0xdf,0x0c,0x44,0xfb,0xa3,0x4a,0xcd,0x81,0xef,0x3f,0x94,
+0x35,0xc7,0x95,0x9a,0xc1,0x00,0x1d,0x4e,0xa7,0xbc,0x66,0x50,0xa9,0xf1,0xa6,0xf0,
+0x57,0x2c,0x5c,0x10,0x21,0xe0,0xfc,0x2c,0x8e,0x52,0xc2,0x84,0x74,0x4a,0x56,0xd8,
+0x77,0x98,0x2e,0x1a,0x38,0xb0,0x0c,0x83,0x2e,0x6d,0x16,0xc5,0xc8,0x23,0xf4,0x66,
+0x68,0x9f,0x38,0xea,0x00,0x87,0x87,0x87,0xf9,0x57,0x8c,0x00,0x1d,0xb0,0xd7,0x31,
+0x14,0x1b,0xf1,0xf8,0xe4,0x6b,0x55,0xad,0x81,0x42,0xe5,0xec,0x79,0x3d,0x27,0x14,
+0xe7,0x76,0x82,0xd3,0x65,0x40,0x25,0x53,0x80,0xfc,0x68,0x07,0x95,0x8f,0xc6,0x2a,
+0xc9,0x3e,0x76,0xba,0xf4,0x3c,0x9c,0xa6,0x59,0xa1,0x80,0x11,0x02,0x02,0xe2,0x24,
+0x89,0x92,0xfe,0x22,0x9d,0x65,0x85,0xa2,0x3c,0x3e,0x3e,0x38,0x70,0x6a,0x8b,0x7f,
+0x1d,0x25,0x7e,0x7f,0x92,0x60,0xf4,0x71,0xc8,0x3e,0xfb,0x28,0x08,0x0a,0xd0,0x53,
+0x44,0x82,0x6a,0xf7,0xdc,0xbe,0x26,0x53,0xd2,0x27,0x14,0x2f,0xa4,0x56,0x3a,0x3a,
+0x29,0x15,0x19,0x10,0x40,0x68,0x93,0x49,0x44,0x69,0xb4,0x60,0xb2,0x0a,0x52,0xca,
+0x05,0xb6,0xd0,0x5e,0x9c,0xe4,0xad,0x75,0x6c,0x9d,0x6a,0x55,0x42,0x99,0x95,0x5b,
+0x44,0x41,0xff,0x04,0x07,0x08,0x34,0xb3,0x82,0x98,0x4d,0xa3,0xb8,0xa9,0xd3,0x0a,
+0x29,0x11,0x35,0x0c,0x54,0x65,0x14,0x15,0x04,0xc7,0xbe,0x06,0x05,0xc4,0x54,0x40,
+0x52,0xdb,0x0a,0x25,0xad,0x32,0x8c,0xef,0x4b,0x68,0x49,0x9a,0x12,0x21,0xc7,0x27,
+0xd5,0xbd,0xed,0x9b,0x36,0xd1,0x6b,0xcc,0xab,0x26,0x8c,0x02,0x6a,0x9a,0x12,0xbf,
+0x2e,0xc6,0xad,0x52,0xdb,0xe4,0x1a,0xd6,0x9f,0xde,0xc4,0xb8,0xb2,0x47,0xc3,0xce,
+0xd2,0x0d,0x80,0x0d,0xf2,0xa0,0xe0,0xd9,0x59,0x82,0x6e,0x72,0x1b,0xe6,0xde,0x07,
+0x6e,0x2f,0x85,0x01,0x4d,0xd2,0x28,0x58,0x52,0xcc,0x65,0xed,0x98,0xd1,0x29,0x25,
+0xb3,0x10,0x05,0xfd,0x94,0x26,0x38,0x9c,0xd1,0x79,0xb1,0x97,0x0d,0x0a,0xae,0x39,
+0xa9,0x2c,0x68,0x15,0x46,0x9f,0x6d,0x25,0xb0,0x56,0xdc,0x8a,0x00,0x1d,0x3f,0x0d,
+0xa2,0xeb,0xe1,0x9c,0xf8,0x3e,0x0e,0x1b,0xe0,0xb5,0x80,0x64,0xad,0xf3,0x10,0x43,
+0xc1,0x0a,0x04,0x11,0xa2,0x5c,0x5d,0x37,0x0d,0x99,0x92,0x33,0xdb,0x40,0xdb,0x71,
+0x82,0x29,0xbd,0x81,0xa2,0x08,0x94,0x80,0xc2,0x95,0x83,0x8e,0x1e,0x2d,0x4d,0x4f,
+0x3a,0x9a,0x5e,0x63,0xf4,0x31,0xab,0x73,0x7a,0x6b,0xcb,0x2b,0x9c,0xdc,0xf4,0x9b,
+0xcd,0x3b,0x00,0x6b,0x3e,0xb9,0xca,0x94,0xa9,0xe6,0x76,0x4a,0x71,0x9c,0x29,0x74,
+0x90,0xb6,0x02,0x30,0xf7,0x03,0x21,0x2a,0x0f,0xca,0xed,0x1c,0x00,0x4b,0x75,0x7f,
+0x18,0xaf,0xb4,0x43,0xa9,0x98,0x0e,0x2b,0x0c,0xcd,0xb8,0xb0,0xa9,0xfe,0xaa,0x32,
+0x04,0x66,0x88,0xd0,0x28,0xdf,0x7c,0xf3,0x4d,0x53,0x00,0x5a,0xcc,0x80,0x01,0xfc,
+0xd5,0xcd,0x09,0x36,0x07,0xdb,0x8b,0x16,0x71,0xc3,0x26,0x5b,0x86,0x3e,0x4e,0x60,
+0xe9,0x15,0x13,0xb1,0x05,0xee,0x31,0x42,0x0f,0xfc,0x07,0x12,0xd0,0x32,0x49,0xb2,
+0xb5,0xcd,0x07,0x83,0xd3,0x6f,0xd0,0x11,0x6f,0xde,0x47,0x49,0x12,0x5d,0xab,0x14,
+0xac,0x8a,0x49,0xdd,0xa0,0x15,0x20,0x10,0x42,0x6a,0x7f,0x8e,0xbd,0x24,0xc6,0xe1,
+0xe4,0xd4,0x7f,0xd0,0x22,0xaf,0x24,0x9c,0x46,0x7d,0x98,0x8d,0xdc,0x1c,0xa4,0x16,
+0x1a,0xe4,0xb6,0xc7,0xbc,0x0a,0x65,0x53,0x57,0x29,0xb9,0x8d,0x7a,0x10,0x83,0x9f,
+0x9e,0x9e,0x16,0xc0,0xae,0x50,0xb0,0xc4,0xd9,0x1a,0x43,0x86,0x21,0xc0,0x50,0x70,
+0x36,0x18,0x12,0xf9,0x68,0x9f,0x7b,0x25,0xa3,0xd4,0x4b,0x48,0x4c,0xc7,0x01,0xa6,
+0xda,0x93,0xf3,0x1f,0x3f,0xbc,0x7d,0xfd,0x4c,0x73,0x35,0x5d,0x1f,0xed,0x8b,0x0a,
+0xd9,0x60,0xba,0x0c,0x3d,0xe6,0x21,0x79,0x09,0x46,0x14,0xff,0xfc,0xc3,0x6b,0xc3,
+0xcc,0xae,0x50,0xa2,0x21,0x87,0x4c,0x8d,0x6b,0x12,0xfa,0xd1,0xb5,0xfd,0x98,0x99,
+0xe2,0x3f,0xbf,0x9c,0xfc,0x82,0x3d,0x6a,0x66,0xc8,0x0d,0xf1,0xb5,0x56,0x29,0x34,
+0x7a,0xcf,0x89,0x97,0x44,0x69,0x34,0xa5,0xf6,0xcf,0xcf,0x9f,0xfd,0x70,0x71,0xf1,
+0xaa,0x67,0xe6,0x38,0x48,0xb1,0x68,0x0d,0x85,0x94,0xc6,0xaf,0xf1,0xaf,0x4b,0x9c,
+0x52,0xc3,0xcc,0x13,0x4c,0x97,0x49,0xa8,0xa1,0xbc,0xc0,0x00,0x9c,0x20,0x14,0x90,
+0xdf,0xb0,0x31,0xe1,0x28,0x78,0xee,0xbb,0xf7,0xce,0x34,0x4a,0x0c,0x86,0x8f,0x46,
+0x42,0x6d,0x62,0x66,0x64,0x6a,0x4c,0xec,0x39,0x4a,0x5f,0x5e,0x87,0xaf,0x92,0x28,
+0xc6,0x09,0xbd,0x31,0x90,0x69,0x66,0x9e,0x1d,0x2f,0xd3,0xb9,0x81,0x43,0x2f,0xf2,
+0xf1,0xdb,0xd7,0x4f,0xcf,0xa2,0x45,0x1c,0x85,0x38,0xa4,0x06,0x32,0xf7,0x7a,0x6e,
+0x6f,0xaf,0xa5,0x66,0xf2,0x0e,0xbd,0x37,0xcd,0x5c,0xe2,0xe2,0xd9,0xbf,0x44,0x24,
+0x34,0x7a,0xf7,0x7b,0x66,0x89,0x15,0xfa,0x05,0xad,0x0c,0xdf,0xcc,0x68,0x72,0xc3,
+0xe9,0xe2,0x2a,0x94,0x72,0x7c,0x1b,0x14,0xbb,0x2b,0xfe,0xb9,0x6e,0xef,0xd5,0xcb,
+0x37,0x17,0xbd,0x47,0xfc,0xdf,0x50,0x29,0x7e,0xcb,0x4a,0xdf,0x56,0x0a,0x9f,0x9c,
+0x3f,0x3b,0xbf,0x38,0xef,0x3d,0x92,0x5f,0x86,0xbd,0xef,0xcf,0x2f,0x7a,0x0e,0x8c,
+0x32,0x71,0xc3,0x65,0x10,0xc0,0x12,0xf8,0xb6,0x8f,0x28,0xba,0xe7,0xba,0x20,0x64,
+0x53,0x12,0x62,0xff,0xfe,0xfd,0xa2,0x0c,0x1a,0x99,0xd9,0xc4,0x2d,0x49,0xc7,0xab,
+0x4c,0xde,0x13,0x06,0xba,0x27,0x91,0x82,0x6e,0x45,0xc1,0xdb,0x8b,0x9e,0x99,0xf9,
+0xf6,0x32,0x09,0xf6,0xdc,0xde,0xa3,0xde,0xde,0x24,0xcf,0x91,0x1d,0x85,0x09,0x46,
+0xfe,0x4d,0x4a,0x11,0xc5,0xde,0x1c,0x85,0x33,0xec,0x4a,0x32,0x18,0x8c,0xf0,0x74,
+0x4e,0x52,0x9b,0xb5,0x79,0x03,0x6d,0x5c,0xd7,0x3d,0x2e,0xcb,0xa1,0xdb,0x32,0xdd,
+0x3f,0x18,0x0c,0x5c,0xd7,0x3d,0x84,0xd1,0x40,0xda,0x02,0x4c,0x71,0x1d,0x79,0xa5,
+0x9c,0x4f,0x00,0x68,0x5b,0x16,0x1b,0x19,0x07,0x35,0x44,0x02,0xa6,0x05,0x53,0x1a,
+0xfe,0xf9,0xcd,0xcb,0x17,0x76,0x0c,0xbe,0xbe,0x81,0xc0,0x5c,0x8a,0xa3,0x30,0xc5,
+0x17,0x78,0x45,0xcd,0xdc,0xcc,0x3d,0x44,0xbd,0xb9,0x31,0x35,0x37,0x83,0xa9,0xf6,
+0xcd,0xcd,0x9c,0x73,0x29,0xa3,0x17,0xb3,0xe0,0xea,0xd8,0xca,0x42,0x15,0x55,0x56,
+0xf6,0x99,0x78,0xae,0x83,0xd1,0x44,0x32,0xcf,0x73,0x07,0xd9,0x51,0x8c,0x43,0xb1,
+0xae,0x16,0x5b,0x3d,0x8b,0x26,0x4b,0x2c,0x57,0x9b,0x2c,0x70,0xb4,0x04,0xf9,0x94,
+0x5f,0xdd,0xa2,0x30,0x47,0x76,0x8a,0xa9,0x90,0xbe,0x1f,0x30,0xf2,0x71,0x62,0xf4,
+0xce,0xb8,0xbf,0xc5,0x6c,0x93,0x9e,0xd5,0x43,0x71,0x1c,0x10,0x8f,0x69,0xf4,0xfd,
+0x55,0xff,0xfa,0xfa,0xba,0x0f,0x6e,0x53,0x7f,0x99,0x04,0x5c,0x74,0xfc,0x5e,0x1b,
+0x5b,0xc1,0x70,0x29,0x0e,0x7d,0x43,0x88,0xbb,0x17,0x85,0x69,0x14,0x60,0x3b,0x88,
+0x66,0xc6,0x84,0x75,0x98,0x14,0xc4,0x13,0x2d,0x27,0x52,0x33,0xc8,0x8e,0xb9,0xa0,
+0x8b,0x67,0x6e,0xbd,0x0e,0x75,0xfa,0xf5,0x0f,0x38,0xe5,0x3c,0x46,0x2c,0xa7,0xa1,
+0xe7,0xbc,0x00,0xa5,0xa9,0x76,0x16,0x2d,0x16,0x51,0x98,0x32,0x24,0x69,0xb2,0xf4,
+0x28,0x28,0x17,0x82,0xaf,0x9f,0x82,0x80,0x03,0x13,0xf3,0x07,0x97,0xff,0x73,0x58,
+0x11,0x0e,0xf0,0x6b,0x66,0x9c,0x17,0x8f,0xdf,0xd2,0xf0,0x05,0x5e,0x55,0x9e,0x01,
+0x30,0xa1,0x4e,0xbe,0x43,0x42,0x42,0xf9,0x28,0xe7,0x01,0x4e,0x5d,0xc3,0x74,0xc7,
+0x19,0x28,0x61,0x1c,0xe0,0x1f,0x09,0xbe,0x76,0xfd,0xc8,0x5b,0x2e,0x70,0x48,0xed,
+0x19,0xa6,0xe7,0x01,0x86,0xaf,0xdf,0xde,0x3c,0xf5,0x0d,0x65,0x74,0xb3,0x36,0xae,
+0x2b,0xfa,0x2a,0x5d,0xd2,0x6f,0x6f,0xce,0x60,0x42,0x2f,0xd0,0x02,0x1b,0x3a,0xf7,
+0x1d,0x74,0xf3,0xdd,0xe0,0x7d,0x1d,0xc7,0x8d,0x7d,0x27,0x34,0xec,0x87,0x78,0xd5,
+0xec,0xcd,0x67,0xb4,0x55,0x7f,0x8f,0x35,0x6d,0x1d,0xdf,0x96,0xd1,0x06,0x17,0x18,
+0xd5,0xc9,0x77,0x52,0x4c,0x39,0xe4,0x6f,0x59,0x0c,0xe1,0x2c,0x20,0xde,0xc7,0xf3,
+0x2b,0x50,0xc6,0x18,0x3e,0xbf,0x0b,0xc5,0x42,0xa8,0x48,0xd8,0xc8,0xf7,0x59,0x9b,
+0x67,0x24,0xa5,0x38,0xc4,0x89,0xa1,0x7b,0xd0,0x4f,0xb7,0x0c,0x0c,0xf4,0x15,0x3d,
+0x0d,0x6c,0x3a,0xb9,0xc9,0xc7,0x80,0xb1,0xb7,0x1a,0x81,0x21,0x79,0x5b,0xf8,0xf3,
+0xe8,0x5a,0x2c,0x8d,0x21,0x7c,0x41,0x6b,0x81,0xd3,0x14,0xcd,0x58,0xf3,0xea,0xea,
+0xd9,0x24,0x0c,0x71,0xf2,0xc3,0xc5,0xf3,0x67,0xae,0x68,0x53,0x5b,0x5e,0xdb,0x93,
+0xd4,0x74,0x8d,0xae,0x9a,0x3d,0x5d,0x37,0xed,0x04,0xc7,0x01,0xf2,0xb0,0xb1,0x6f,
+0x80,0x97,0x68,0x7e,0x92,0x63,0x9b,0xfb,0x64,0x66,0xe9,0xba,0xd9,0x09,0x77,0xcf,
+0x15,0x2d,0x1f,0xe9,0x9a,0xf8,0xa6,0x0f,0x75,0x0d,0xa0,0xe8,0xdd,0x0b,0x76,0x4f,
+0x34,0x75,0xf2,0x9d,0x39,0xf1,0xf1,0x33,0xee,0x87,0x1b,0x66,0xd6,0xc2,0xc2,0x15,
+0x9e,0xe8,0x55,0xa3,0x02,0x3d,0xe0,0x0b,0x9b,0x99,0x25,0xb6,0x30,0x72,0xdc,0x1e,
+0x44,0xf1,0x7a,0x9c,0x92,0x25,0x60,0x55,0x75,0xdc,0x65,0x10,0x73,0x87,0x4d,0x86,
+0x6f,0x5d,0x02,0xec,0x73,0x4e,0x73,0xa3,0x27,0x9e,0x6d,0xdb,0xee,0x59,0x53,0x14,
+0xa4,0xd8,0x74,0xba,0x64,0xb1,0xc7,0x3c,0xb6,0x02,0xf2,0xb6,0xed,0xea,0x73,0x64,
+0x26,0x5c,0x2f,0xdf,0x69,0xc5,0x47,0xf0,0x82,0x45,0xd2,0x73,0xd0,0x63,0xdc,0xe0,
+0xc1,0x01,0xd3,0xf7,0xa2,0x69,0xa7,0xae,0xe8,0xa9,0x81,0x91,0x9e,0xe9,0x54,0xbb,
+0x09,0x34,0x98,0xa1,0xe9,0x0a,0xf0,0x8f,0x7a,0x09,0xf6,0x7b,0xc3,0x1e,0x8b,0x7d,
+0xf4,0xea,0x1d,0x4a,0x0e,0xbd,0x1c,0xf9,0xe4,0x6a,0xbc,0x9b,0x09,0xec,0xf2,0xd1,
+0x3e,0x3c,0x5f,0xe6,0x0e,0x2c,0xd4,0x59,0x14,0x86,0x98,0x59,0x03,0x0c,0xa6,0x61,
+0x72,0xc5,0x06,0xdf,0x9f,0xa7,0x33,0x57,0x7f,0x1b,0x02,0xe3,0x68,0x34,0x82,0x48,
+0x3a,0xb4,0x84,0xaf,0x74,0x8e,0x35,0xee,0xae,0x63,0x5f,0x03,0x7a,0x69,0x51,0xa2,
+0x79,0x73,0xec,0x7d,0xd4,0x6e,0xa2,0x65,0xc2,0x8b,0xbc,0x02,0xb2,0xad,0x3b,0x28,
+0xc0,0x09,0x35,0x24,0x58,0xc1,0xd5,0xa5,0xc8,0x19,0x6c,0xf1,0xac,0xb2,0x3e,0xcf,
+0x77,0x84,0x72,0x0f,0x08,0x0e,0x29,0xdb,0x10,0x88,0xa7,0x7d,0x48,0x30,0x4d,0x6e,
+0xdc,0x81,0x23,0x9e,0x9f,0x3f,0xfe,0xf9,0xc3,0xeb,0xf3,0x8b,0xd7,0x7f,0x71,0x8f,
+0x64,0xd1,0x9b,0xb3,0xc7,0x2f,0x3e,0xbc,0x7a,0xf9,0xec,0xd9,0x87,0xa7,0x2f,0x2e,
+0xce,0x5f,0xff,0xf8,0xf8,0x99,0x7b,0x32,0x28,0x3a,0xfc,0xf9,0xe5,0xb7,0xeb,0x2b,
+0x2f,0x9e,0x3e,0x3f,0x7f,0xf9,0xf6,0xe2,0xc3,0xf3,0xc7,0xaf,0xbf,0x7f,0xfa,0xc2,
+0x3d,0x1a,0x94,0xd5,0xa9,0x87,0xc2,0x9f,0xc8,0x94,0x18,0x5c,0x35,0x5b,0x09,0x9e,
+0x26,0x38,0x9d,0x0b,0xcd,0x53,0xa0,0xc6,0x6c,0xcb,0x6c,0x99,0x04,0xc3,0xcb,0xdd,
+0x4c,0x98,0xe9,0xf9,0x3e,0x8a,0xc9,0x3e,0x90,0x65,0x1f,0xa0,0xec,0x66,0xa2,0xaf,
+0xf6,0x48,0xd3,0x1f,0x89,0xef,0xee,0x81,0xae,0x0d,0x35,0x5d,0xcf,0x2f,0x2d,0x69,
+0xed,0x0c,0x0b,0x4b,0x2d,0xc1,0xa9,0x99,0x71,0x5a,0xd8,0x1f,0xa2,0xf0,0x8d,0x87,
+0xc2,0xd7,0xc2,0x98,0x80,0x3a,0x66,0x1f,0x5a,0x1c,0x2f,0xd3,0xc9,0x39,0x21,0xcb,
+0xde,0xb8,0x2a,0x86,0xdc,0xb6,0x90,0xd0,0x18,0xde,0x63,0x57,0x3c,0x16,0x14,0x35,
+0xb3,0x44,0x5d,0x9a,0x62,0xd7,0xb6,0xb0,0xe9,0x70,0xd3,0xda,0xc9,0x77,0xf6,0xf6,
+0x2a,0x50,0x1c,0xf1,0xd4,0x45,0x29,0x27,0xe7,0xaa,0x56,0x2c,0x66,0x6d,0x1e,0xea,
+0x1c,0x98,0xc9,0x80,0x28,0x37,0xa0,0xb0,0xeb,0xea,0x7e,0x14,0x62,0xfd,0xfe,0x7d,
+0x56,0x16,0x90,0x94,0x16,0xe8,0xc1,0x16,0x64,0x95,0xc5,0x25,0x6e,0x75,0x08,0xa0,
+0x19,0xb1,0xaf,0x77,0xce,0x8b,0x9b,0xd8,0x45,0xf7,0x14,0xd3,0x0b,0x6e,0x66,0x19,
+0xb0,0xdf,0xcb,0x79,0xc6,0x51,0x10,0x00,0xd6,0x6f,0x98,0x85,0x22,0x26,0x68,0x5a,
+0xa2,0xba,0xc9,0x7c,0xea,0x7c,0xdb,0xfb,0x66,0x5b,0x30,0xcc,0x3e,0x37,0x88,0x3a,
+0x39,0x83,0x4c,0x0b,0x2e,0xa8,0x52,0xac,0x60,0x9a,0xda,0x92,0x28,0x13,0xfd,0xe7,
+0xe7,0xaa,0x2f,0xb7,0x14,0x15,0xf6,0xbb,0x46,0x84,0xfe,0x39,0x9a,0xa8,0x7c,0x67,
+0xb1,0x01,0x19,0x3d,0xef,0x71,0x62,0x8a,0xdd,0xb8,0x8a,0x36,0xeb,0x51,0xe0,0xae,
+0x60,0x0e,0xba,0x33,0x20,0x60,0x62,0xb1,0xde,0xc2,0x4e,0x97,0xd3,0x69,0xea,0x97,
+0x35,0xca,0xe2,0x97,0x68,0x22,0x56,0xfd,0x11,0xf1,0xdd,0xdd,0x8c,0x01,0xfc,0x25,
+0x9a,0xe4,0x97,0x96,0x00,0x3b,0x64,0x23,0x75,0xb1,0x04,0xa0,0xc2,0x59,0xa1,0xca,
+0x19,0xb0,0x48,0x92,0x45,0x92,0x65,0x18,0x92,0x70,0xa6,0xdf,0xbf,0x5f,0xb4,0xc1,
+0x01,0x8a,0x53,0xec,0x8f,0x5d,0x06,0xbc,0x36,0xef,0x82,0x27,0xda,0xe6,0xde,0x02,
+0xd7,0xcc,0x3a,0x96,0xae,0x8d,0xf4,0x83,0x62,0xe9,0x1a,0x4a,0x5a,0x19,0x45,0xe0,
+0x53,0x61,0xf2,0x56,0xbc,0xd6,0xb1,0x2b,0xf7,0x32,0x38,0xcb,0x25,0x37,0x2e,0xfb,
+0x7c,0xc4,0x3e,0x87,0x03,0x87,0xc9,0xd2,0xdd,0x99,0xf7,0x16,0x33,0x66,0xc3,0xec,
+0x1d,0xac,0x9b,0x77,0x85,0x63,0xc5,0x8e,0xca,0xc4,0x18,0x42,0xd7,0x56,0x8c,0xd2,
+0x14,0x4e,0x1e,0xac,0xaa,0x2a,0x01,0x57,0x6e,0xc8,0x1d,0x39,0xab,0x53,0xad,0x08,
+0x60,0x97,0xdc,0xc3,0xca,0x00,0xde,0x10,0x3e,0x1e,0xb1,0x6f,0xba,0x5e,0x00,0x1f,
+0xca,0x2f,0x8f,0x8a,0x12,0x5d,0xcf,0x37,0xed,0x51,0x72,0xbe,0xb7,0x52,0x23,0xca,
+0xba,0x74,0xd1,0x39,0xcf,0xcd,0x82,0x1e,0x33,0x4e,0x6a,0x9e,0x14,0xb0,0x85,0x3a,
+0x0d,0x69,0xbc,0x0f,0x71,0xc0,0x4e,0x35,0x2a,0x86,0x2d,0x05,0x46,0xf8,0x01,0x9f,
+0xc1,0x5f,0x6b,0xe6,0x51,0x2e,0x6c,0x5a,0x99,0x48,0x48,0x63,0x8b,0x45,0x67,0xaf,
+0x50,0x60,0x45,0xd3,0x69,0x8a,0xa9,0xb5,0xdd,0xe4,0x52,0x4c,0x2f,0x2d,0xb6,0xfa,
+0x3a,0xac,0xbe,0x2e,0xd6,0x36,0xa4,0xf1,0x50,0x05,0x3a,0xac,0x41,0x1f,0xf2,0x7f,
+0xff,0xc8,0x35,0x75,0xd4,0x45,0x7d,0xfe,0x2b,0xa5,0xad,0x8b,0xca,0xa7,0xf6,0xfd,
+0xf9,0x85,0xde,0xca,0xd7,0x8b,0x5f,0x29,0xdd,0x6a,0x81,0x99,0xcd,0xb0,0xed,0xa2,
+0x6e,0xbf,0x86,0x0a,0xde,0xc8,0xf7,0x13,0xe0,0x1c,0x48,0x42,0xb1,0x3c,0x46,0xbf,
+0xa7,0x4f,0x2c,0xc8,0x37,0x61,0x72,0xd5,0x26,0xb0,0x95,0x25,0x83,0xe9,0xa9,0x30,
+0x86,0x0c,0xd0,0x82,0xf8,0xc3,0x02,0xd8,0x02,0xa0,0x0d,0x19,0xc8,0x05,0xc0,0x64,
+0x72,0x9a,0x77,0x13,0xa6,0x10,0xf8,0x2f,0xb9,0xca,0xdb,0x2f,0xea,0x4b,0x76,0x72,
+0x0e,0xce,0xf8,0xed,0x16,0x95,0x9f,0xb8,0xef,0x83,0x71,0x77,0xab,0x65,0x65,0xe6,
+0xe0,0x1f,0x25,0xb0,0xcb,0xd8,0x47,0x14,0xf3,0x29,0xa5,0x06,0x47,0xb1,0x5c,0x54,
+0xd8,0x7a,0x01,0x05,0x37,0xf3,0xa2,0x65,0x48,0x87,0xa2,0xde,0x0e,0xd8,0x51,0x52,
+0xce,0xa2,0xdf,0xd0,0x86,0xb8,0x03,0x87,0x8c,0xaa,0xb5,0xce,0xde,0x1e,0x31,0xd9,
+0x66,0xff,0xee,0x12,0x0e,0x24,0x76,0x33,0x92,0x5f,0xbe,0x77,0x45,0xa3,0x77,0xe4,
+0xbd,0x0d,0xa5,0x0e,0x6f,0xc0,0x0e,0x19,0x9a,0x2d,0x58,0xb1,0x93,0xef,0x74,0x30,
+0x17,0x67,0xfa,0x6e,0x52,0x4f,0x20,0x6c,0x77,0x67,0x1d,0xc9,0x69,0x99,0xde,0x85,
+0xde,0xef,0xde,0xb7,0x31,0xce,0x13,0x96,0xb2,0xf5,0x34,0x9c,0x46,0xb7,0x63,0x9c,
+0xb5,0x8a,0x40,0x35,0x5c,0x25,0xe6,0xe6,0xce,0x1f,0xa8,0x1e,0x78,0x38,0xed,0x76,
+0x33,0xe0,0x7d,0xfe,0xb0,0xdd,0x6a,0x03,0xe6,0xdc,0x9a,0x05,0x63,0x83,0xeb,0x34,
+0x76,0xe2,0xa3,0x1c,0x1d,0x40,0xed,0x07,0x30,0x25,0x40,0xa6,0xe1,0x50,0x87,0x15,
+0xc8,0xb0,0x00,0xf4,0x73,0xb3,0x9c,0x17,0x7a,0x3c,0x42,0xcb,0x20,0x88,0x68,0xad,
+0xc1,0x72,0xf4,0xfa,0xd0,0x5f,0x37,0x79,0x2b,0x61,0xd6,0x3e,0x15,0x9b,0x93,0xdb,
+0x3f,0x90,0xbd,0x99,0xe2,0x12,0x56,0x95,0x7b,0x3a,0xe0,0xd1,0x03,0x08,0xca,0xf2,
+0x50,0xac,0x84,0x6f,0x57,0xe3,0xb4,0x86,0x09,0x9e,0x03,0x8b,0x01,0xb2,0xef,0xd2,
+0x03,0x82,0x55,0x51,0xce,0xa7,0x8a,0x16,0x25,0x9c,0xee,0x78,0x26,0x1b,0x4f,0xb5,
+0xc3,0x58,0xf4,0x50,0xed,0xd8,0x1a,0xa4,0x64,0xdd,0x5e,0x47,0x4b,0x8a,0x13,0x7b,
+0x16,0x19,0x3a,0x4c,0x55,0x17,0x81,0xc7,0x02,0x95,0x05,0x8a,0x8d,0x95,0x45,0xc2,
+0x0f,0x0b,0x12,0xb2,0x7f,0x68,0x65,0x45,0x4b,0xca,0x1e,0xd9,0x7f,0xb4,0x82,0x45,
+0x63,0xa7,0x5a,0xcf,0x11,0x9d,0xdb,0xec,0x60,0xd5,0x30,0x56,0x7d,0xde,0xc7,0xfc,
+0x93,0x21,0x9a,0xf5,0x45,0x37,0x73,0xdf,0xe0,0x70,0x64,0x8b,0x3d,0x59,0xa1,0x0c,
+0x0b,0xa9,0x15,0x17,0xd1,0x1b,0x76,0xde,0x7d,0x81,0x66,0x06,0x3c,0x9b,0x19,0x7c,
+0xba,0xf0,0x31,0xee,0x9f,0x9e,0x3c,0xea,0x9f,0x9e,0x0c,0xe1,0x61,0xd4,0x7f,0x78,
+0xf2,0xa8,0xff,0x90,0x3f,0xb0,0xd5,0xe1,0xe7,0xe4,0x2e,0xe0,0x0e,0x65,0x56,0xff,
+0xe1,0x89,0xd5,0x3f,0x3d,0xb1,0x06,0xd6,0xb1,0xa9,0x34,0xb8,0x40,0x33,0x57,0xd7,
+0x9d,0xf2,0xe1,0x72,0xb4,0x0c,0x34,0x16,0xe2,0x71,0x7b,0xb5,0xb3,0xf6,0xde,0x78,
+0x14,0x10,0x59,0x57,0x9c,0xd1,0xf7,0xc6,0x10,0xc6,0x92,0xc5,0xbb,0x19,0xef,0xa4,
+0x8d,0xb5,0x01,0x04,0x51,0x20,0x9b,0x49,0xd7,0xf6,0x44,0xe1,0x90,0x17,0x0c,0xf4,
+0xbc,0xa7,0x8d,0x79,0xb8,0x6b,0xb4,0x1f,0x10,0x15,0xee,0x5a,0x90,0x07,0x77,0x02,
+0xc9,0x73,0x14,0x3a,0x81,0x1e,0xae,0x05,0xda,0x01,0xb3,0x92,0x29,0xd1,0x09,0xfa,
+0x68,0x7b,0xd0,0xfb,0xcb,0x60,0x7c,0x29,0xbc,0x95,0x72,0x6d,0x14,0x76,0x88,0xc2,
+0x37,0x8a,0x08,0x3f,0xa5,0x78,0x61,0xe0,0x2b,0x2e,0xed,0x6c,0x60,0x9c,0xba,0x9b,
+0xc2,0xb8,0x7a,0x91,0xd4,0xa3,0x9b,0xe5,0x66,0xe7,0xaf,0xdc,0x81,0x15,0xba,0x02,
+0x88,0xd8,0xee,0xfa,0x07,0x0e,0xf1,0x57,0x23,0x37,0x84,0x7d,0xcf,0x5f,0x99,0x99,
+0xac,0x86,0xde,0x06,0x94,0x28,0x91,0xf4,0xcb,0x02,0xae,0xb6,0x9b,0x11,0x7f,0xa5,
+0xb9,0xae,0x16,0xc2,0xd4,0x79,0x9a,0x11,0x84,0xcf,0x44,0x29,0xe3,0x09,0x1a,0xc5,
+0x3c,0xa2,0xa6,0xe5,0x97,0x5c,0x99,0x51,0x94,0xcc,0x30,0x75,0xf1,0x95,0xcd,0xbf,
+0x39,0xd7,0x73,0x12,0x60,0xe3,0x1e,0x7f,0x2a,0x47,0xb2,0x49,0xe8,0x05,0x4b,0x1f,
+0xa7,0x95,0xa9,0x98,0x99,0xe8,0x2f,0x9a,0xc7,0x28,0xc1,0x21,0x7d,0x11,0xf9,0xcc,
+0xa7,0xde,0x04,0x03,0xcc,0x11,0x80,0xc1,0x49,0x9f,0xe7,0x3b,0x55,0x55,0x59,0x68,
+0xd2,0x77,0x02,0x10,0xf1,0x8b,0xb3,0x01,0x05,0x09,0x38,0x12,0xe0,0x9a,0x56,0x3a,
+0x63,0x10,0xf3,0x3d,0x0f,0x70,0x67,0x5c,0x99,0x77,0x66,0xad,0x7d,0xa1,0x69,0xc1,
+0xc3,0xdb,0xae,0x1b,0xb4,0xd4,0x4d,0x47,0xe9,0xc0,0x8d,0x0b,0xb7,0x82,0xbc,0x0d,
+0xf5,0x4e,0x0d,0x21,0xd1,0xb0,0xd7,0x03,0xe2,0x54,0x9b,0xf3,0xa3,0x72,0xfd,0x05,
+0xf8,0xee,0x9f,0x3e,0xb5,0xd6,0x3d,0x5e,0xd2,0x48,0x37,0xb3,0x3a,0xcc,0xda,0xc1,
+0x13,0x3b,0x70,0xec,0x6c,0xc3,0x36,0x36,0x27,0xdf,0xa9,0xaf,0xcc,0x9e,0xab,0x8b,
+0xe8,0xb5,0xae,0x6e,0x04,0xf3,0xe8,0xfa,0x27,0xb1,0x06,0x06,0x8f,0x30,0x02,0xad,
+0xe4,0xb2,0x6c,0xa6,0x15,0x5f,0x60,0x87,0xf3,0x19,0xd3,0x76,0x75,0xd6,0x87,0x16,
+0x5d,0x7c,0x4f,0xd1,0x6c,0x8f,0x47,0xea,0x35,0xe2,0xbb,0xbd,0x62,0xc5,0x19,0xa3,
+0xe7,0xbd,0x42,0x6d,0xdd,0x55,0x02,0xaa,0xba,0xa3,0xc8,0xa9,0xeb,0x69,0xe3,0xcb,
+0xbd,0xfa,0x0e,0x00,0x78,0xbe,0x23,0xfe,0xea,0xbd,0xcd,0xf6,0x82,0x3d,0x5d,0x28,
+0x10,0x05,0x40,0x91,0xb5,0xd6,0x02,0x17,0xb8,0xa1,0x37,0xd6,0xf7,0x4a,0x30,0x50,
+0xd2,0x06,0xa5,0x48,0xa2,0xeb,0x8d,0x0d,0xb5,0x3d,0x14,0xed,0xe9,0xa6,0xd4,0x5b,
+0xe5,0xa7,0x9e,0xef,0x28,0x0b,0xa2,0x9c,0x71,0x50,0x34,0x73,0xbe,0x8c,0x8a,0x62,
+0xeb,0x52,0x55,0x52,0xdd,0xba,0xa9,0x71,0xc6,0xd8,0x63,0x67,0x8c,0x3d,0xab,0xa9,
+0x45,0xad,0x7b,0x07,0x66,0xae,0xf2,0x5b,0x61,0x8e,0x28,0x76,0x87,0x7a,0x72,0x56,
+0x5a,0x15,0xad,0x67,0x4d,0x97,0x10,0xfa,0x0c,0xf9,0xe1,0xd7,0xa5,0x3c,0xfc,0xaa,
+0xd8,0x63,0xf5,0xc8,0xaf,0x41,0xd2,0x37,0xc2,0x44,0x94,0xcd,0xc0,0x2c,0x81,0x58,
+0x67,0x51,0xa3,0x20,0xd3,0x3e,0xea,0x59,0x79,0xca,0xc3,0xdf,0xa5,0x68,0x1c,0xf6,
+0x14,0xc8,0x14,0x21,0xb1,0x02,0x64,0xe5,0xc8,0x51,0x41,0x56,0x7e,0x71,0x2a,0x42,
+0x58,0xd4,0xd7,0x0d,0x25,0x1c,0xfa,0x17,0x55,0x5b,0x91,0x67,0xb2,0xd4,0x2d,0xc8,
+0x71,0xff,0x00,0x16,0x0d,0xa3,0xa4,0x68,0x57,0x6f,0x62,0x3a,0x6d,0x66,0xa7,0x82,
+0x72,0x3b,0x15,0xca,0x73,0xc7,0xcb,0x0a,0x66,0x15,0xcb,0xb0,0x6b,0x5d,0xef,0x8a,
+0x29,0xc3,0xaa,0x6e,0x0a,0x37,0xd0,0x4f,0x71,0x49,0x95,0xaa,0x75,0xdc,0xb1,0xa0,
+0x62,0xe5,0xd8,0x6c,0x34,0x6d,0x94,0xc6,0x28,0xd4,0xd8,0x69,0xa3,0xdb,0x2b,0x13,
+0xd3,0xb4,0x83,0x93,0x98,0xf6,0xc6,0x86,0xb6,0x9b,0xf5,0xfb,0x35,0x34,0x72,0xcd,
+0x1c,0xed,0x43,0xb7,0xf1,0x25,0x9f,0x5c,0xb5,0x7a,0x74,0x60,0xde,0x0a,0x87,0x4d,
+0x18,0xc4,0x38,0x84,0xce,0xea,0xa0,0x6d,0x0c,0xe1,0xe4,0xb9,0x75,0x30,0x78,0x38,
+0xb8,0xe3,0x96,0xf7,0x19,0x5b,0xac,0x90,0xbb,0x7a,0xb4,0xb6,0xb2,0x2f,0x5a,0xad,
+0xbb,0xa5,0xa5,0x88,0x28,0xf3,0x48,0xb9,0x78,0xb2,0xaf,0x59,0xeb,0x24,0x3b,0x44,
+0x8b,0x4c,0x4b,0x48,0x2e,0xdb,0x2c,0x6b,0xdc,0xf8,0x5a,0xf1,0x74,0x2f,0x5f,0x7e,
+0xb4,0x35,0xb1,0x04,0xd8,0xb7,0x35,0x43,0x1c,0x36,0x90,0x38,0x37,0x81,0xbd,0xd9,
+0x2e,0xdb,0xd6,0x9b,0x7b,0x8e,0x5b,0x1e,0x11,0xdb,0xe0,0xef,0x70,0x58,0xb5,0x10,
+0xb9,0x8c,0x3c,0x55,0x7d,0xfd,0x22,0x09,0x43,0x12,0xe2,0x96,0xf3,0x97,0x99,0x0e,
+0x9f,0x3e,0x71,0xe7,0x38,0x25,0xfe,0x3d,0xb7,0xb1,0x0e,0xe6,0xe7,0x4f,0x6c,0xd3,
+0xd9,0xb7,0xd9,0x4d,0xc0,0xad,0xc8,0x0f,0xba,0xcf,0x82,0x73,0x68,0xe9,0x97,0x33,
+0xde,0x2c,0xe3,0xc5,0xad,0x7e,0xb9,0x8f,0xa7,0x40,0xc5,0xc2,0x03,0xc7,0x01,0x7e,
+0x0a,0xaf,0x57,0xbd,0xa0,0x71,0xb5,0x40,0xd2,0xb2,0x28,0xe5,0xfb,0xd6,0x5b,0xea,
+0x55,0xdb,0x3d,0x47,0xe1,0x12,0x05,0xc1,0x8d,0x5a,0xf1,0x2d,0xe4,0x42,0x00,0x22,
+0x2f,0x59,0xfc,0x98,0x97,0xcb,0xd8,0xf2,0xd3,0x27,0x9b,0x7c,0x7f,0xe1,0x04,0x73,
+0x7c,0xe1,0x64,0xaa,0xe6,0xd6,0xc3,0xb7,0xf3,0x00,0xff,0x08,0xeb,0x64,0x98,0x4e,
+0xbc,0xa4,0x6f,0x2f,0xce,0x64,0xcc,0xad,0xea,0xdb,0x43,0xda,0x84,0x88,0xbc,0x56,
+0xf4,0x71,0x15,0x44,0xa6,0x92,0xa1,0x5b,0x9a,0xd9,0x7b,0x68,0xfd,0x90,0xc6,0xba,
+0xe9,0x34,0xe8,0xb4,0xa9,0x9b,0x9c,0xbe,0xe8,0x5b,0x50,0xb3,0xbb,0x1f,0x67,0xa6,
+0xfe,0x92,0x7a,0xea,0x78,0x0a,0xbd,0x37,0x0d,0xb9,0x10,0x4d,0x15,0x10,0xb5,0x95,
+0xe9,0x86,0xc0,0xd2,0x59,0xd8,0x4a,0xf0,0x33,0x00,0x5d,0x11,0xa9,0x46,0x34,0x45,
+0x21,0x6c,0x6d,0x31,0xb2,0x36,0xab,0xd7,0xed,0x1f,0x1c,0x3a,0x64,0x74,0x70,0xc4,
+0x63,0x9a,0xc2,0xc2,0xe5,0x41,0x46,0x4d,0x78,0x07,0xbb,0x19,0xd1,0xfe,0xa4,0x9d,
+0x0e,0xd8,0x47,0xde,0x1b,0xbf,0xbd,0x38,0x83,0x22,0xe1,0xd5,0xef,0x31,0x83,0xb6,
+0x30,0x67,0x35,0x91,0x20,0x01,0x11,0xcf,0xe1,0x60,0x30,0x12,0x01,0xcb,0xf1,0x25,
+0xd8,0xf8,0x2d,0xc0,0x25,0x61,0x7a,0x63,0xf9,0xad,0xec,0xc2,0xfc,0xc1,0xb4,0x58,
+0x9d,0x2a,0xe7,0x17,0xe5,0x35,0x0b,0xb3,0xe2,0x26,0x9f,0xb1,0xad,0x8c,0x77,0x02,
+0x52,0xff,0x16,0x85,0x18,0xc2,0x6a,0x00,0x98,0x23,0x80,0x85,0x9b,0x29,0x02,0xb2,
+0x64,0x6a,0xf0,0x72,0x57,0x97,0xf8,0xe8,0x9c,0x27,0x6b,0xcb,0xc5,0x93,0x7d,0x5c,
+0x5d,0x66,0x8f,0x6b,0xba,0x50,0x21,0x5b,0x34,0x85,0x1c,0x2c,0x3d,0xef,0x0a,0x70,
+0xa9,0xb3,0x6c,0x4b,0x90,0x63,0x53,0xd2,0xad,0xf6,0xc9,0x55,0xe3,0x5c,0xeb,0x02,
+0x64,0xac,0x5a,0x4a,0xe3,0x1d,0xc2,0x63,0x70,0x5e,0xd1,0x08,0x8f,0xa9,0x32,0xae,
+0x6c,0x19,0xca,0xc1,0x59,0x65,0xcb,0xe0,0x01,0xcf,0xca,0x0e,0xda,0x65,0x87,0x4a,
+0x65,0x09,0xad,0x1c,0x35,0x32,0xac,0xf7,0xfb,0xba,0x59,0x29,0x91,0x6d,0xed,0x90,
+0xc6,0x8a,0xb4,0xbe,0xa0,0xb1,0x74,0x8c,0x95,0x06,0x4d,0xed,0x51,0x6f,0x44,0x54,
+0xed,0x4b,0x4b,0x79,0x2d,0x1a,0x70,0xa9,0x64,0xf1,0x85,0xa2,0xf6,0xeb,0xa3,0xd3,
+0xc1,0xe0,0x9e,0x3b,0xa8,0xaf,0x27,0x87,0x5d,0xf2,0x56,0xab,0x32,0x11,0xad,0x4a,
+0x68,0x4e,0xc9,0x5b,0x75,0x50,0x4a,0xa3,0x35,0xa0,0x06,0x4e,0x99,0x6d,0x8d,0x45,
+0xc2,0xb3,0xeb,0x1e,0x0f,0x8e,0x6b,0x7b,0x6b,0x23,0xd3,0x0c,0xf2,0x25,0x2a,0x7a,
+0xbb,0xba,0xde,0xac,0xcf,0x32,0x81,0x18,0x0b,0xac,0x31,0xb0,0x2f,0xec,0x12,0xc0,
+0x44,0x6f,0xb0,0x17,0x85,0x7e,0x6a,0xf0,0x82,0x59,0x59,0x60,0xee,0x1d,0xf0,0x0d,
+0x65,0x1e,0x2d,0x93,0xd4,0x2d,0xea,0x7f,0x80,0x47,0x83,0x57,0x2d,0x48,0x58,0x56,
+0x3c,0x27,0xe1,0x92,0x62,0x59,0x95,0x62,0xcf,0x6d,0xc2,0x2c,0xf9,0xb7,0x2d,0xff,
+0xf3,0x52,0x98,0x59,0x5a,0x5f,0xdb,0xcd,0xd8,0xb0,0xda,0x48,0x3b,0x60,0xfa,0x6a,
+0x50,0xe8,0x2b,0x56,0x9e,0x0f,0x77,0xb3,0x05,0x09,0x5b,0xaa,0x17,0x24,0x84,0xca,
+0x14,0x7b,0x2d,0x95,0x29,0xf6,0x20,0x7e,0x55,0xd2,0x85,0xa2,0x84,0x9e,0x81,0x1a,
+0x30,0xd6,0x18,0x75,0x90,0x3a,0xda,0xa0,0xa0,0xa3,0xec,0xce,0x4d,0x47,0xa1,0xd9,
+0x1c,0x2c,0x68,0x66,0x77,0x54,0xd4,0x49,0x21,0x84,0x9b,0xfc,0xd6,0x36,0x72,0xe9,
+0x3a,0x73,0x11,0x4a,0x3c,0x1a,0x7e,0x8f,0x52,0x25,0x32,0x6a,0x54,0xc1,0x68,0xb2,
+0x69,0x45,0x3e,0xcb,0xa6,0xe6,0x4e,0x45,0x68,0xaa,0x4a,0xb7,0x06,0xb1,0x9d,0xb3,
+0x79,0x4e,0x4b,0x53,0xc6,0x6d,0x9a,0x90,0x85,0x61,0xba,0xae,0xae,0x57,0x4d,0x8a,
+0x36,0x15,0x50,0x85,0x51,0xd5,0x03,0xcc,0x33,0xda,0x5a,0x45,0xe4,0xd5,0x09,0x8d,
+0xfa,0x0f,0x4e,0x8f,0x07,0x83,0x4f,0x9f,0xca,0xa2,0x31,0x2b,0xa9,0xcc,0x6e,0xe0,
+0xb4,0x09,0xf6,0x60,0xbd,0x3c,0x77,0xec,0x6d,0x22,0xfc,0x39,0x6c,0xeb,0xcb,0x44,
+0x57,0x06,0x1c,0x2a,0x4a,0xb9,0x49,0x20,0xab,0x63,0xce,0x56,0x89,0xb7,0x55,0x53,
+0xe5,0xe2,0xd4,0xa5,0x4c,0x24,0x66,0xc7,0x75,0x90,0x71,0xa4,0xfa,0x38,0x3c,0x3d,
+0x70,0x8d,0x9e,0x87,0x9c,0x21,0xb0,0x43,0x9f,0x20,0x8a,0x65,0x01,0xa0,0xcb,0xd5,
+0x03,0xb3,0xba,0xe7,0x3c,0x97,0x70,0xc1,0xff,0xa5,0xa6,0xa3,0x8a,0x5b,0xdd,0x17,
+0x6a,0x38,0x1d,0xf8,0xfe,0xfd,0xdb,0xa9,0xc0,0x66,0x8c,0xa4,0xe1,0x86,0x5c,0x7e,
+0x87,0x48,0x00,0x7e,0xf1,0x24,0xd9,0x1f,0x3f,0x0e,0x02,0x6e,0x5c,0xa4,0xda,0xef,
+0x7f,0xfd,0xdb,0xef,0x7f,0xfd,0x1b,0x4a,0x30,0xb3,0x72,0xf9,0x9b,0x42,0x3e,0x6f,
+0x15,0x07,0x18,0xa5,0x58,0xa3,0xc9,0x8d,0x86,0x66,0x88,0x84,0x10,0xa5,0x68,0xaa,
+0x5a,0x2e,0x5c,0x65,0xd2,0x42,0xab,0x23,0x21,0x97,0xea,0x31,0x4f,0x46,0xa8,0x3a,
+0x05,0xaf,0xa2,0x84,0x56,0x4b,0xce,0x44,0x76,0x42,0xb5,0xf4,0x6d,0x8a,0x93,0x5a,
+0x4f,0xe1,0xfe,0x6e,0xf2,0x11,0x84,0x25,0xb0,0xde,0x33,0x80,0xa9,0x31,0x9f,0xb1,
+0xea,0x14,0x7c,0xe6,0x29,0xdf,0xe7,0x1a,0x31,0xdc,0xd2,0x6c,0x98,0x31,0x5d,0x2e,
+0x89,0x20,0xf0,0x46,0x63,0xff,0x57,0x4a,0xfb,0x90,0x19,0xa2,0x3a,0x0b,0xb0,0x0e,
+0x5b,0x75,0x64,0x77,0xa2,0x28,0x1d,0xe5,0x72,0x6d,0xd5,0x99,0x67,0x9e,0xb0,0xe8,
+0x48,0x65,0x65,0xb7,0xea,0x0c,0x79,0x2a,0x15,0x94,0x05,0x03,0x6c,0x87,0x36,0x4a,
+0xd3,0x6d,0x3d,0x13,0x75,0x83,0x52,0x55,0xaf,0xa0,0xaf,0x50,0x72,0xfc,0x8d,0xa3,
+0x4f,0x9f,0x3a,0xab,0x99,0x6e,0xef,0x0e,0x0d,0x88,0xe6,0x1a,0x49,0x35,0xbc,0x88,
+0xe9,0x8d,0x5e,0x8a,0x32,0xa8,0x08,0x4d,0x1d,0x19,0x56,0xa7,0x6b,0xd8,0xb2,0x6e,
+0x7c,0x7a,0x72,0x74,0x72,0xd4,0x5a,0x55,0x89,0xa0,0x35,0x71,0x79,0x1a,0x5e,0x21,
+0xb8,0xc5,0x03,0x16,0x57,0x0b,0x97,0x8b,0x09,0x4e,0x6c,0x05,0x9f,0x9d,0x06,0x42,
+0x72,0xd5,0xbb,0x90,0xaa,0xd7,0x6f,0xa0,0x85,0x6c,0xde,0x46,0x8c,0x9d,0x0e,0x1b,
+0xa1,0xdc,0x2a,0x94,0xa4,0xa9,0xf6,0xc5,0xb0,0x5a,0x28,0x62,0x75,0xe0,0x6a,0x55,
+0x18,0xb3,0xd1,0x5f,0xf0,0x9c,0x0c,0xb6,0x75,0xba,0x0b,0xc5,0xae,0xb2,0x29,0x74,
+0xa6,0x57,0x63,0x37,0x20,0xec,0x05,0xb9,0x39,0xc0,0x4d,0x1b,0x40,0xc7,0x5e,0xc2,
+0xc1,0xac,0xa5,0x3a,0x0a,0xb5,0x30,0xa2,0x6a,0x68,0xea,0xf9,0x7f,0x5f,0x5c,0xc0,
+0x0b,0xb7,0x57,0x9c,0x01,0x3a,0x03,0xef,0x4d,0xbf,0x8a,0x6b,0xcf,0x6c,0xfd,0x62,
+0x55,0x33,0xf3,0x36,0x52,0xaf,0xa9,0xdb,0x04,0x3f,0xb1,0x9d,0x75,0x99,0x04,0x4e,
+0x9b,0x84,0xb0,0x4a,0xe0,0xe4,0x3d,0x5d,0x77,0xba,0x38,0x92,0x6f,0xd1,0xc4,0x77,
+0x5a,0x96,0x5b,0x54,0x82,0xbe,0xa9,0x80,0xa8,0x2e,0xbe,0x68,0x05,0x8a,0x85,0xb5,
+0xea,0x20,0x54,0xe1,0xd7,0xc0,0xf4,0x6e,0xbb,0xb7,0x73,0xf7,0x46,0x6c,0x4c,0xca,
+0x8e,0xcb,0xa3,0x26,0xeb,0xf7,0x5c,0x11,0x59,0xe1,0xdb,0x63,0x54,0xa4,0xce,0x15,
+0x69,0x36,0xdd,0x3b,0x66,0xb1,0xed,0x6c,0xde,0x33,0xf9,0x20,0x5f,0x7c,0xd7,0x2c,
+0xc0,0xde,0x65,0xd7,0x9c,0x92,0x90,0xa4,0xf3,0x6d,0x76,0x4d,0x41,0xa2,0xee,0x0d,
+0x44,0x64,0xc4,0xdd,0x62,0xe3,0x90,0x98,0xb3,0x65,0x60,0x17,0xfe,0x6c,0x71,0x92,
+0xd8,0xb8,0x18,0x48,0xc4,0x34,0xd9,0xfe,0xc5,0x10,0x66,0x2f,0x8d,0x6e,0x84,0xc3,
+0xf7,0x3b,0x01,0x87,0x31,0xa9,0x00,0x24,0xdf,0x8a,0xda,0x0e,0x4c,0x71,0x61,0x8d,
+0xe8,0x2d,0xa8,0x20,0x39,0x87,0xa4,0x3f,0xc2,0x66,0xc1,0x0f,0xd0,0xab,0x89,0x88,
+0x55,0x84,0x2b,0xf9,0x88,0x2a,0x0a,0x90,0x61,0x08,0x27,0xbf,0x67,0xf2,0x66,0x35,
+0xdd,0xe1,0xa4,0x82,0x0a,0xf5,0x35,0x35,0x7d,0x12,0xc0,0xd5,0x68,0x0e,0x3f,0x60,
+0x7c,0xb1,0x0c,0x02,0xa3,0x3a,0x84,0xcc,0x66,0x34,0xef,0xdf,0x6f,0x56,0x28,0x7b,
+0xcf,0xda,0xd1,0xcf,0x61,0xc7,0x69,0xda,0xc4,0xa0,0x1a,0x51,0x10,0x44,0xd7,0xa0,
+0x96,0xbb,0x10,0x4c,0xb0,0xaf,0x3b,0x92,0x22,0x3c,0x5d,0x00,0xae,0xab,0x22,0x21,
+0x73,0xfe,0x64,0x62,0x26,0xbb,0x82,0x20,0x03,0x44,0x87,0xed,0xf8,0x5b,0x6c,0xf4,
+0x61,0xc7,0x1c,0x18,0x23,0x73,0x1a,0xb0,0x81,0xb6,0xda,0xcb,0xd5,0x40,0xa6,0xbd,
+0xfd,0x7e,0xda,0x9e,0x97,0x5a,0xa8,0x6a,0x9e,0x9a,0x59,0x2a,0xeb,0x35,0x8e,0x0c,
+0xdf,0xbc,0xe4,0xb7,0x8a,0xde,0xdb,0xa0,0xf6,0xd8,0xfe,0xf7,0x39,0x53,0x94,0x5c,
+0x89,0x93,0x44,0x8b,0x04,0x02,0xe9,0xa7,0x4f,0xef,0xde,0x9b,0x66,0xb6,0x35,0xc7,
+0xc2,0x09,0x58,0xeb,0x62,0xdd,0x73,0x71,0x92,0x70,0xb6,0x2b,0xd6,0x7a,0x1d,0x83,
+0x41,0xeb,0x45,0x3a,0x7b,0x24,0xfe,0x0f,0x0b,0xfc,0x05,0xe2,0x6b,0x79,0x2b,0xcf,
+0x15,0x27,0xd5,0x5c,0x63,0x46,0xf0,0x95,0xd2,0xd8,0xdb,0xfa,0xdc,0x90,0xb8,0x2b,
+0x19,0x6b,0x7a,0x93,0xcb,0x1d,0x9b,0x6e,0x8d,0x78,0xca,0xb6,0x52,0xa7,0x9c,0x52,
+0x25,0xc9,0xe6,0xba,0xf0,0x79,0xff,0x7e,0xad,0x8a,0xc3,0x2f,0xd2,0x12,0x79,0x5a,
+0x0e,0xbc,0xa5,0xc3,0x1e,0x65,0x06,0x4e,0xc5,0xd6,0x28,0x94,0xec,0x46,0x6b,0x43,
+0x49,0x19,0x2f,0x58,0x98,0x65,0x75,0xb7,0xda,0x6a,0xc2,0x54,0x53,0x36,0x4b,0x68,
+0xeb,0x24,0x18,0xee,0xb1,0xe1,0xa0,0xbe,0x8b,0x92,0x45,0xba,0xc6,0xe8,0x6a,0xda,
+0x5c,0x2d,0xbb,0x7a,0x95,0xc0,0x2d,0xe0,0x6b,0x14,0x14,0xc4,0x75,0x59,0xc0,0xb6,
+0x93,0x03,0x5e,0x44,0x52,0x53,0xdb,0x7a,0x6b,0x08,0x8d,0x33,0x57,0x8a,0x69,0x71,
+0x41,0x8a,0xce,0x38,0x4d,0xb7,0x74,0xb8,0x7b,0x6b,0xeb,0x4e,0xc5,0x89,0xba,0x6e,
+0xe9,0x87,0x0f,0x62,0xba,0x75,0x47,0x7e,0x6d,0x8d,0x6e,0xe9,0x07,0x03,0xe5,0x4a,
+0x35,0xf9,0x55,0xb7,0x74,0xb2,0x00,0xbb,0x0d,0x85,0xdb,0x83,0x2c,0x6f,0x39,0xd2,
+0x2d,0x9d,0xdf,0x73,0x54,0xeb,0x5b,0x5e,0x17,0x50,0x4d,0xfd,0xaa,0xbc,0x71,0xd7,
+0x38,0x78,0x5a,0xc7,0xde,0xe5,0x9e,0xe8,0x56,0x79,0xd9,0x51,0x52,0xb0,0x78,0x7e,
+0x92,0x0e,0x57,0x65,0xc0,0x9d,0xa0,0x90,0x90,0x20,0x8a,0x9a,0xbb,0xfd,0x78,0x37,
+0xe3,0x8f,0x4c,0x4e,0xf2,0xdd,0x4c,0x6e,0x76,0x4a,0xa9,0x09,0x21,0xdd,0x3f,0x89,
+0x90,0xee,0x50,0x13,0x99,0x0b,0x5c,0x7f,0x69,0x2c,0xe5,0x8d,0xd1,0x42,0x97,0xa3,
+0xb4,0xd8,0x02,0xda,0x02,0xad,0x04,0x27,0xe9,0x47,0x87,0xba,0xb8,0xe8,0xb4,0x3a,
+0xb6,0x2e,0x0e,0x9e,0xca,0x62,0xbe,0x03,0xe9,0xda,0xbe,0x48,0xa0,0xba,0xdc,0x69,
+0xce,0xb2,0xb4,0x18,0x34,0x99,0xda,0x7a,0x09,0x3b,0x4d,0x69,0x63,0xb5,0x24,0x5a,
+0x2d,0xd0,0xea,0x27,0x76,0xa3,0xea,0xc0,0xf9,0xb2,0xc6,0xd2,0x97,0xb0,0x94,0x6e,
+0x69,0x26,0x55,0x19,0x87,0x4f,0xa5,0xc1,0x33,0x38,0xc0,0xcf,0xa0,0xc6,0x2d,0xf4,
+0xbd,0x53,0xd0,0x80,0x65,0x63,0x2f,0xd0,0xca,0x90,0x8d,0xc4,0xb9,0x0d,0xab,0xb5,
+0x64,0x33,0x61,0x07,0x14,0xbd,0x40,0x21,0x34,0x9c,0x74,0x59,0x3b,0x3e,0x3c,0x18,
+0x98,0x59,0xd1,0xf6,0xf0,0x60,0xa0,0xec,0x8c,0xdd,0x88,0xd6,0xf6,0x22,0x7e,0xe9,
+0xad,0x84,0xb2,0xa7,0xc7,0x2b,0xbd,0xd8,0xec,0x94,0x66,0x5c,0xb4,0xdd,0xcb,0x43,
+0x76,0xb7,0x5f,0x1f,0x6e,0x3a,0xdd,0x2d,0xc6,0xd6,0xf6,0xb4,0x93,0x3c,0x5e,0x5d,
+0xee,0x28,0x6b,0x54,0x1f,0xc1,0x38,0x7c,0x30,0xe8,0x17,0xf3,0xec,0x1c,0x47,0x34,
+0x3e,0x1a,0x34,0x1a,0xe7,0xc2,0x37,0xfa,0x8e,0x99,0xff,0xec,0x52,0x95,0x0e,0xcf,
+0x88,0xfb,0x4d,0xe0,0x55,0x89,0xb7,0x06,0xb8,0xf0,0x6f,0xf0,0x8a,0x0a,0xb7,0xa2,
+0xfe,0xea,0x40,0x05,0x62,0xb7,0x2f,0x21,0x6e,0xf5,0x82,0x77,0x4a,0xd6,0xfa,0x13,
+0xdb,0xba,0x49,0xeb,0xf7,0x3e,0xf1,0xb2,0x48,0x61,0x38,0xac,0x35,0xd5,0x0a,0x77,
+0x9b,0xdf,0xb1,0xa0,0x57,0xef,0x48,0x96,0xef,0x8e,0xd8,0xda,0x6b,0xcc,0x42,0xd9,
+0x6a,0xee,0x1e,0x6c,0x35,0x41,0xc4,0x6f,0x07,0xb2,0xe7,0x09,0x9e,0xba,0x3a,0x9a,
+0xc0,0x9b,0xc5,0x93,0x00,0x85,0x1f,0x75,0x19,0x85,0x10,0x80,0xd9,0x0e,0x68,0x6b,
+0xdf,0xb1,0xf7,0xe8,0x21,0xde,0x90,0xa2,0x2b,0xac,0x79,0x95,0xe1,0xb8,0x1d,0xce,
+0x73,0x7d,0x98,0x2d,0x52,0x5c,0xf4,0xc0,0x9c,0xad,0xe2,0x49,0x50,0x5f,0x2c,0x5e,
+0x07,0x35,0xca,0x90,0xb5,0x74,0xa2,0xdb,0x4e,0x83,0x45,0xec,0x62,0xbb,0x24,0xa2,
+0xc6,0x21,0x82,0xf3,0xa1,0xa9,0x10,0x8b,0xbb,0xe2,0xaa,0xba,0xbf,0xa7,0xdc,0x13,
+0xd7,0x1b,0xf3,0x51,0x98,0x1a,0xd6,0x86,0x52,0xa1,0xb7,0xb4,0x66,0x14,0xe9,0x8d,
+0x45,0x52,0x0f,0xa7,0x7b,0x2e,0xdb,0x0b,0x65,0x7b,0x57,0x1c,0x7e,0xc4,0x49,0x0a,
+0xc4,0xd8,0x7e,0xfc,0x2b,0xde,0xa3,0x0b,0x01,0x38,0x3c,0xb8,0xdc,0xb9,0x2b,0x3a,
+0x6f,0xde,0x3c,0x7d,0x72,0x0b,0x5c,0x20,0x19,0xeb,0x4b,0x51,0xe2,0xe9,0xab,0x5b,
+0x0c,0x4c,0xe2,0xf5,0xf3,0xe7,0x36,0x9d,0xe0,0x39,0x60,0x34,0x38,0xce,0x92,0x2c,
+0x58,0xe1,0xc2,0x0f,0x34,0xba,0xb8,0x8e,0x9e,0x90,0x19,0xa1,0x46,0xb8,0x5c,0x14,
+0x76,0x70,0xb8,0x5c,0x8c,0x0e,0x06,0x8f,0xf4,0x81,0xbe,0x17,0x2e,0x17,0xc3,0x70,
+0xb9,0xa8,0xf3,0x6e,0x09,0x72,0x8b,0x5c,0x86,0x7f,0x06,0xce,0x0d,0x69,0xfc,0x8f,
+0x63,0x5b,0x79,0x08,0x9a,0xc3,0xe9,0xfd,0x17,0xc2,0x02,0x88,0xad,0xc1,0xc1,0xe6,
+0x36,0x78,0xb0,0xbc,0x24,0x86,0x0a,0xdf,0xd9,0x2b,0x19,0x4a,0x6a,0xf9,0x88,0x97,
+0xf7,0x99,0xad,0xa7,0xe9,0x5a,0xbe,0x9b,0xa9,0x4c,0xc2,0x2c,0x05,0x34,0x11,0x87,
+0x8d,0xbc,0x8f,0xa9,0xed,0x6b,0x90,0xd2,0x61,0x6a,0x90,0x04,0xb0,0xb9,0xf5,0xd7,
+0xbc,0xf5,0x7a,0x1e,0x06,0x1e,0x83,0x68,0x6d,0x2b,0xdb,0x56,0x2b,0xb3,0xcd,0xf1,
+0xdd,0x2f,0xcb,0x80,0xf2,0xf0,0x64,0xfb,0xf5,0x5f,0x26,0xc1,0x97,0x62,0x3e,0x88,
+0x35,0xdf,0x62,0x64,0x70,0x69,0xbe,0xd4,0xd0,0x9c,0xce,0xda,0xad,0x94,0xe4,0xa2,
+0xa9,0x23,0xe5,0xc5,0x36,0x2c,0xc6,0x7d,0x8f,0x9f,0xce,0xdc,0x11,0x23,0x08,0x9b,
+0xdf,0x06,0x19,0x18,0xb1,0x8e,0x4e,0x79,0xd3,0x0e,0x0b,0xa7,0x7f,0x1e,0x42,0x32,
+0x4a,0x7f,0x1b,0xa4,0xd8,0x7b,0xef,0x0d,0xa4,0x2a,0xe2,0xa0,0x84,0xbb,0xd3,0x56,
+0x69,0x28,0x33,0x19,0x37,0x87,0x1f,0xea,0xc2,0xc0,0xca,0xea,0xb6,0x79,0xdd,0xed,
+0xac,0x77,0x78,0x47,0xde,0xdf,0x5d,0x80,0x76,0xb3,0x40,0x09,0xcd,0xe4,0xdb,0x11,
+0x4b,0x76,0xe1,0x2e,0x61,0x83,0x5e,0x95,0x4d,0x6f,0xab,0x83,0x23,0xb5,0x47,0x65,
+0x7e,0x55,0xa3,0xda,0xdc,0xa9,0x3e,0x2b,0xce,0xe4,0x07,0x96,0x54,0xc9,0x2d,0x7f,
+0x7e,0x06,0xd0,0x6a,0xf5,0x83,0x05,0x9f,0xba,0x19,0x64,0x56,0x0f,0xcb,0xf7,0x91,
+0x59,0xba,0xc8,0xb0,0xdc,0x32,0x2d,0x38,0x2a,0x1e,0x96,0x1a,0xcc,0xe2,0x0e,0xe2,
+0x50,0x3d,0x6e,0xb1,0xb8,0x1f,0x30,0x2c,0xdd,0x8c,0x5c,0x66,0x2d,0x17,0x29,0x14,
+0x90,0x33,0x5d,0xf3,0x12,0xc4,0x8d,0xb9,0xcd,0x84,0xc9,0x39,0x4a,0xe7,0x65,0xd2,
+0xe4,0x0f,0x28,0x9d,0xf3,0xcc,0x19,0xd3,0x51,0x9f,0x4a,0xd3,0x77,0x16,0xb9,0x3c,
+0x16,0x07,0x17,0x48,0x16,0x86,0x37,0x4a,0xe7,0x2c,0xba,0x56,0xcd,0x2f,0x55,0xfb,
+0x33,0x3a,0x30,0x8f,0xbf,0xd2,0xab,0x7c,0x43,0xf0,0x2b,0xf6,0x66,0x20,0x0b,0xb5,
+0x73,0x72,0xbd,0x83,0xd6,0xef,0xcd,0x8c,0x87,0x09,0xd8,0x6b,0xd6,0x8a,0x03,0xf9,
+0x11,0xdf,0xc0,0xcd,0xbb,0xbc,0x69,0xeb,0xe5,0x7f,0xcc,0xed,0xb9,0x64,0xbe,0xd3,
+0x6e,0xf6,0x11,0xdf,0xe4,0x97,0xa6,0xcd,0x2f,0x0b,0x77,0x3f,0xe2,0x9b,0x7b,0x12,
+0x5f,0x36,0xa0,0x42,0x3c,0x39,0x6c,0xb3,0x8c,0xc7,0x6d,0x54,0xe4,0x18,0x81,0x65,
+0xd8,0x8d,0x1d,0x50,0xab,0x95,0xe0,0x0a,0x98,0x59,0xa3,0x88,0x45,0xe0,0xf2,0xf2,
+0x26,0xd0,0x7d,0xfe,0xa3,0x31,0xf0,0x5b,0x2d,0x5a,0x14,0x82,0x28,0xbb,0xba,0x38,
+0x4e,0xe2,0xe0,0x75,0xf5,0x8d,0x33,0xbd,0xf2,0x03,0x16,0xad,0x55,0xf2,0xf7,0x2a,
+0x44,0x25,0xf1,0x5d,0xe5,0x4d,0x75,0xd9,0x16,0x4a,0x74,0x8d,0xd3,0x83,0xb7,0x13,
+0x79,0xb8,0xfc,0x7e,0x74,0x8d,0x5d,0x85,0xae,0xa9,0x37,0xc3,0x6b,0xfc,0xe2,0x75,
+0x5d,0xab,0x8c,0x09,0xb7,0x58,0x6b,0x70,0x69,0xb6,0x3e,0x1e,0x21,0x8d,0x7b,0x60,
+0x5f,0xb1,0x91,0xc6,0xc0,0xe8,0xa3,0x7d,0x34,0x6e,0xbc,0x35,0xa7,0x97,0x57,0x5f,
+0xeb,0xe3,0xdf,0xff,0xfe,0xbf,0xed,0x0d,0x74,0x66,0xdf,0xdc,0xb9,0x33,0x88,0xd1,
+0x9d,0x3b,0x0b,0x65,0x7a,0xe7,0xfe,0x5c,0x3a,0x2b,0x6f,0xff,0xcd,0x0f,0x19,0x41,
+0xb4,0xc7,0x4c,0x0d,0x8f,0xf6,0xe7,0x87,0xe5,0xf2,0x94,0x6f,0x5f,0xca,0xd6,0xa0,
+0xf3,0xb7,0x89,0xe3,0xe9,0x63,0x0d,0x7c,0x96,0x61,0x77,0x3c,0xae,0x80,0xcf,0x5e,
+0x0b,0xda,0x6f,0x59,0x8d,0x35,0xb0,0xe5,0x66,0xb6,0x0d,0x7c,0xf1,0xf6,0x50,0xdb,
+0x08,0xe2,0x26,0xd8,0x96,0x9a,0x2a,0x37,0x4b,0x1e,0x54,0xae,0x4d,0xd7,0xd8,0x8f,
+0x02,0xe8,0xe3,0x11,0xff,0x71,0x17,0xd9,0x4f,0xb9,0xdf,0xb5,0xc6,0xb8,0xc7,0x0f,
+0xbf,0x76,0xf4,0xf1,0x9b,0xe5,0x64,0x41,0xe8,0x68,0x9f,0xf7,0x6a,0xeb,0xcd,0x6e,
+0x97,0x6d,0xed,0x0b,0xa7,0xbc,0x65,0x4f,0x65,0x3d,0xca,0x8f,0x72,0x1e,0x85,0x74,
+0xb1,0x77,0x41,0xfe,0x18,0xe9,0x8a,0x16,0xf1,0xdd,0xa4,0x4b,0x74,0xfd,0xfd,0xef,
+0xff,0xd3,0xde,0xaa,0x21,0xb8,0x6c,0x12,0x42,0xee,0x3e,0x43,0x70,0xff,0x09,0x65,
+0x8f,0xf9,0x4a,0x29,0xa6,0xf0,0x8a,0x5e,0x29,0x7c,0x9b,0x25,0xe0,0xc5,0xc5,0x2b,
+0xed,0x0d,0x4b,0x48,0xd9,0x20,0x03,0xe5,0x3b,0x37,0x6a,0x9c,0xfb,0xf4,0xf8,0x96,
+0x22,0x27,0x13,0x4a,0x5b,0x47,0xe3,0xa9,0x51,0xea,0x78,0xc5,0xcb,0x3a,0xfb,0xe3,
+0x51,0xba,0x9c,0x8c,0xb9,0x73,0xb9,0x9c,0xdc,0x4e,0xcc,0x0b,0x47,0xb2,0x34,0xc3,
+0x58,0xe2,0x2c,0x1b,0x48,0x79,0xbb,0x67,0x3c,0xda,0xe7,0x4f,0x5d,0xe0,0x59,0x87,
+0xc6,0x1b,0x39,0x5a,0xdb,0x2b,0x1e,0xce,0x3a,0x5c,0xc4,0xad,0x5e,0xdb,0xd1,0xa0,
+0xf2,0xf6,0x10,0x27,0x43,0x8a,0xbd,0x2e,0x32,0xfc,0xeb,0xeb,0xa2,0x16,0xe5,0xc3,
+0x92,0x4c,0xff,0xe5,0x94,0x4f,0x0d,0xf4,0xf6,0xca,0x67,0x4b,0xbd,0xf6,0x4f,0xa8,
+0x86,0x58,0x82,0x5b,0x79,0x24,0x7b,0x0b,0x4d,0x24,0x42,0x0e,0xeb,0x8e,0xde,0x14,
+0x91,0x28,0x72,0x6c,0x6f,0xa7,0x7d,0x20,0xb4,0xd0,0x3e,0x42,0x8b,0xd8,0x15,0xe9,
+0xb8,0xb7,0x1b,0x43,0x66,0xc2,0xdd,0x62,0x26,0x45,0xde,0xee,0xed,0x46,0x82,0xd8,
+0xc0,0x2d,0x46,0x61,0x09,0xbe,0xb7,0xa4,0x97,0xb4,0x8f,0x5a,0x47,0x91,0x6f,0x48,
+0x37,0xa9,0x06,0xd9,0xc0,0xff,0xae,0x86,0x92,0x48,0xef,0xfb,0x8f,0xb6,0xea,0x04,
+0xcd,0xb4,0xb9,0xd0,0x5e,0x5f,0x44,0x11,0xfe,0x31,0xba,0xac,0x80,0xaa,0xba,0x32,
+0x32,0x65,0xf1,0xdf,0x94,0xb9,0xc5,0x29,0xed,0x7f,0x98,0xfb,0xff,0x85,0xb9,0x6b,
+0xa0,0x85,0x66,0x29,0x19,0xf3,0x8b,0x08,0x4f,0x3b,0xf3,0x57,0xcf,0xa8,0xcf,0xc4,
+0x19,0x75,0x21,0x0b,0x25,0x5b,0xa8,0xe7,0xee,0x4d,0x0b,0xee,0x1f,0x26,0x1a,0x2f,
+0xff,0xeb,0x2e,0x62,0xa1,0xd5,0x4d,0xf8,0xf5,0xf6,0x69,0x75,0x0e,0xe2,0x97,0x21,
+0x94,0x90,0x81,0x2c,0x29,0xa9,0xa5,0xfe,0x84,0x84,0x3e,0x2e,0x2f,0xa9,0x69,0x5e,
+0xa4,0x24,0x3f,0x21,0x6e,0x06,0x41,0x34,0xf8,0x3d,0xe6,0xff,0x03,0xc2,0xd1,0x47,
+0x0b,0x9f,0x79,0x00,0x00
+};
+static const char RES_INDEX_HTML_TYPE[] PROGMEM = "text/html";
+static const char RES_INDEX_HTML_ETAG[] PROGMEM = "\"41cb303b23ce\"";
+static const char RES_INDEX_HTML_GZ_ETAG[] PROGMEM = "\"41cb303b23ce-gz\"";
+static const WebResource RES_INDEX_HTML_RESOURCE PROGMEM = { RES_INDEX_HTML_TYPE, RES_INDEX_HTML, RES_INDEX_HTML_LEN, RES_INDEX_HTML_GZ, RES_INDEX_HTML_GZ_LEN, RES_INDEX_HTML_ETAG, RES_INDEX_HTML_GZ_ETAG };
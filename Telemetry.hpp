@@ -0,0 +1,177 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * 측정값을 모아 하나의 MQTT 메시지로 보내기 위한 frame. (Telemetry batch, little-endian)
+ *
+ *  header : version(u8) flags(u8) sample count(u16) base time(u32)
+ *  sample : channel(u8) time offset(u16) value(float32)
+ *
+ * base time 은 첫 sample 의 시간(초)이고, 각 sample 은 base time 과의 차이만 저장한다.
+ * NTP 로 시간이 맞춰진 경우 base time 은 getEpochTime() 이며 flags 에 TELEMETRY_FLAG_EPOCH 가 켜진다.
+ * 시간이 맞춰지지 않았으면 부팅 후 지난 시간(초)을 사용한다.
+ * frame 이 가득 차거나 첫 sample 이후 interval 이 지나면 isDue() 가 true 가 된다.
+ * add() 가 sample 을 받지 못하면 (frame 이 가득 찬 경우) 버린 수를 세고, frame 을 보낼 때까지 isDue() 는 true 이다.
+ * NTP 가 맞춰지거나 풀려서 시간 기준이 바뀌면 지금까지의 frame 을 봉인(sealedData())하고 새 frame 을 시작한다.
+ * 새 frame 은 바뀐 flags 와, 바뀐 뒤 첫 sample 의 시간을 base time 으로 사용하므로 바뀐 뒤의 sample 은 버려지지 않는다.
+ * 봉인된 frame 은 보내고 releaseSealed() 를 호출할 때까지 isDue() 를 true 로 만든다. 그 전에 시간 기준이 또 바뀌면 봉인할 곳이 없으므로 sample 을 버리고 dropped() 에 센다.
+ */
+
+#define TELEMETRY_FRAME_VERSION 1
+#define TELEMETRY_HEADER_SIZE 8
+#define TELEMETRY_SAMPLE_SIZE 7
+// PubSubClient 의 기본 buffer(256 byte)에 topic 과 함께 들어가는 크기. (sample 26개)
+#define TELEMETRY_BATCH_SIZE 192
+#define TELEMETRY_INTERVAL 10000 //ms
+
+#define TELEMETRY_FLAG_EPOCH 0x01
+
+
+class TelemetryBatch {
+  private :
+    uint8_t _buffer[TELEMETRY_BATCH_SIZE];
+    size_t _size;
+    uint16_t _count;
+    uint32_t _base;
+    uint8_t _flags;
+    unsigned long _firstMillis;
+    unsigned long _interval;
+    bool _pending;
+    uint32_t _dropped;
+    uint8_t* _sealed;
+    size_t _sealedSize;
+
+  public :
+    TelemetryBatch();
+    ~TelemetryBatch();
+    TelemetryBatch(const TelemetryBatch&) = delete;
+    TelemetryBatch& operator=(const TelemetryBatch&) = delete;
+
+    void setInterval(unsigned long ms);
+    bool add(uint8_t channel, float value, uint32_t seconds, bool epoch);
+    bool isDue() const;
+    bool isEmpty() const;
+    uint16_t count() const;
+    uint32_t dropped() const;
+    const uint8_t* data();
+    size_t size() const;
+    void reset();
+
+    const uint8_t* sealedData() const;
+    size_t sealedSize() const;
+    void releaseSealed();
+
+  private :
+    bool seal();
+    void writeHeader();
+};
+
+
+TelemetryBatch::TelemetryBatch() : _size(TELEMETRY_HEADER_SIZE), _count(0), _base(0), _flags(0), _firstMillis(0), _interval(TELEMETRY_INTERVAL), _pending(false), _dropped(0), _sealed(NULL), _sealedSize(0) {
+}
+
+TelemetryBatch::~TelemetryBatch() {
+  if(_sealed != NULL) delete[] _sealed;
+}
+
+void TelemetryBatch::setInterval(unsigned long ms) {
+  _interval = ms;
+}
+
+// frame 이 가득 찼거나, base time 과의 차이가 u16 을 넘거나, 봉인된 frame 을 보내기 전에 시간 기준이 다시 바뀌면 sample 을 버리고 false.
+bool TelemetryBatch::add(uint8_t channel, float value, uint32_t seconds, bool epoch) {
+  uint8_t flags = epoch ? TELEMETRY_FLAG_EPOCH : 0;
+  if(_count > 0 && flags != _flags && !seal()) {
+    ++_dropped;
+    return false;
+  }
+  if(_count == 0) {
+    _base = seconds;
+    _flags = flags;
+    _firstMillis = millis();
+  } else if(_pending || _size + TELEMETRY_SAMPLE_SIZE > TELEMETRY_BATCH_SIZE || flags != _flags || seconds < _base || seconds - _base > 0xFFFF) {
+    _pending = true;
+    ++_dropped;
+    return false;
+  }
+  uint16_t offset = (uint16_t)(seconds - _base);
+  uint8_t* sample = _buffer + _size;
+  sample[0] = channel;
+  sample[1] = (uint8_t)(offset & 0xFF);
+  sample[2] = (uint8_t)(offset >> 8);
+  memcpy(sample + 3, &value, sizeof(float));
+  _size += TELEMETRY_SAMPLE_SIZE;
+  ++_count;
+  return true;
+}
+
+bool TelemetryBatch::isDue() const {
+  if(_sealedSize > 0) return true;
+  if(_count == 0) return false;
+  return _pending || _size + TELEMETRY_SAMPLE_SIZE > TELEMETRY_BATCH_SIZE || millis() - _firstMillis >= _interval;
+}
+
+// 봉인된 frame 도 없으면 true.
+bool TelemetryBatch::isEmpty() const {
+  return _count == 0 && _sealedSize == 0;
+}
+
+uint16_t TelemetryBatch::count() const {
+  return _count;
+}
+
+// 받지 못하고 버린 sample 수. reset() 으로 지워지지 않는다.
+uint32_t TelemetryBatch::dropped() const {
+  return _dropped;
+}
+
+// header 를 채운 frame 을 반환한다.
+const uint8_t* TelemetryBatch::data() {
+  writeHeader();
+  return _buffer;
+}
+
+size_t TelemetryBatch::size() const {
+  return _size;
+}
+
+void TelemetryBatch::reset() {
+  _size = TELEMETRY_HEADER_SIZE;
+  _count = 0;
+  _pending = false;
+}
+
+// 시간 기준이 바뀌기 전에 모은 frame. 없으면 NULL.
+const uint8_t* TelemetryBatch::sealedData() const {
+  return _sealedSize > 0 ? _sealed : NULL;
+}
+
+size_t TelemetryBatch::sealedSize() const {
+  return _sealedSize;
+}
+
+void TelemetryBatch::releaseSealed() {
+  _sealedSize = 0;
+}
+
+// 지금까지의 frame 을 봉인된 buffer 로 옮긴다. buffer 는 처음 봉인할 때 만든다.
+// 이전에 봉인한 frame 을 아직 보내지 않았으면 false.
+bool TelemetryBatch::seal() {
+  if(_sealedSize > 0) return false;
+  if(_sealed == NULL) _sealed = new uint8_t[TELEMETRY_BATCH_SIZE];
+  writeHeader();
+  memcpy(_sealed, _buffer, _size);
+  _sealedSize = _size;
+  reset();
+  return true;
+}
+
+void TelemetryBatch::writeHeader() {
+  uint8_t* header = _buffer;
+  header[0] = TELEMETRY_FRAME_VERSION;
+  header[1] = _flags;
+  header[2] = (uint8_t)(_count & 0xFF);
+  header[3] = (uint8_t)(_count >> 8);
+  for(int i = 0; i < 4; ++i) header[4 + i] = (uint8_t)(_base >> (8 * i));
+}
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * MQTT topic filter 별 handler. (Topic trie dispatcher)
+ * topic filter 를 '/' 단위 level 로 나누어 trie 에 저장한다. 각 node 는 첫 번째 자식과 다음 형제만 가리킨다.
+ * dispatch() 는 topic 의 level 을 따라 내려가므로 비용은 등록된 handler 수가 아니라 topic 의 깊이에 비례한다. ('+' 는 같은 level 의 모든 값과 맞는다)
+ *  '+' : 한 level 과 맞는다.              "home/+/temp" -> "home/kitchen/temp"
+ *  '#' : 마지막 level 에만 쓸 수 있으며 상위 level 을 포함한 나머지 전체와 맞는다. "home/#" -> "home", "home/a/b"
+ * '$' 로 시작하는 topic ($SYS 등)의 첫 level 은 wildcard 와 맞지 않는다.
+ * topic 과 payload 는 PubSubClient 의 buffer 를 그대로 handler 에 넘긴다. (handler 가 반환되면 다음 메시지로 덮어쓰인다)
+ * handler 안에서 remove() 를 호출하면 안 된다.
+ */
+
+typedef void (*topic_handler)(const char* topic, const uint8_t* payload, unsigned int length);
+
+
+class TopicTrie {
+  private :
+    struct Node {
+      char* level;
+      Node* child;
+      Node* next;
+      topic_handler handler;
+    };
+
+    Node* _root;
+    uint16_t _count;
+
+  public :
+    TopicTrie();
+    ~TopicTrie();
+    TopicTrie(const TopicTrie&) = delete;
+    TopicTrie& operator=(const TopicTrie&) = delete;
+
+    bool add(const char* filter, topic_handler handler);
+    bool remove(const char* filter);
+    int dispatch(const char* topic, const uint8_t* payload, unsigned int length) const;
+    void clear();
+    uint16_t count() const;
+
+    static bool isValidFilter(const char* filter);
+
+  private :
+    static Node* findChild(Node* parent, const char* level, size_t length);
+    static Node* createNode(const char* level, size_t length);
+    static void deleteNodes(Node* node);
+    static bool removeFrom(Node* parent, const char* filter);
+    static int match(const Node* node, const char* topic, bool first, const char* fullTopic, const uint8_t* payload, unsigned int length);
+    static bool isLevel(const Node* node, const char* level, size_t length);
+};
+
+
+TopicTrie::TopicTrie() : _root(NULL), _count(0) {
+}
+
+TopicTrie::~TopicTrie() {
+  clear();
+}
+
+// 같은 filter 를 다시 등록하면 handler 를 바꾼다.
+bool TopicTrie::add(const char* filter, topic_handler handler) {
+  if(handler == NULL || !isValidFilter(filter)) return false;
+  if(_root == NULL) _root = createNode("", 0);
+  Node* node = _root;
+  const char* level = filter;
+  while(true) {
+    const char* end = strchr(level, '/');
+    size_t length = end == NULL ? strlen(level) : (size_t)(end - level);
+    Node* child = findChild(node, level, length);
+    if(child == NULL) {
+      child = createNode(level, length);
+      child->next = node->child;
+      node->child = child;
+    }
+    node = child;
+    if(end == NULL) break;
+    level = end + 1;
+  }
+  if(node->handler == NULL) ++_count;
+  node->handler = handler;
+  return true;
+}
+
+bool TopicTrie::remove(const char* filter) {
+  if(_root == NULL || !removeFrom(_root, filter)) return false;
+  --_count;
+  return true;
+}
+
+// 맞는 handler 를 모두 호출하고 호출한 수를 반환한다.
+int TopicTrie::dispatch(const char* topic, const uint8_t* payload, unsigned int length) const {
+  if(_root == NULL || topic == NULL) return 0;
+  return match(_root, topic, true, topic, payload, length);
+}
+
+void TopicTrie::clear() {
+  deleteNodes(_root);
+  _root = NULL;
+  _count = 0;
+}
+
+uint16_t TopicTrie::count() const {
+  return _count;
+}
+
+// '+', '#' 는 level 전체여야 하고, '#' 는 마지막 level 이어야 한다.
+bool TopicTrie::isValidFilter(const char* filter) {
+  if(filter == NULL || filter[0] == '\0') return false;
+  for(const char* ch = filter; *ch != '\0'; ++ch) {
+    if(*ch != '+' && *ch != '#') continue;
+    bool levelStart = ch == filter || *(ch - 1) == '/';
+    bool levelEnd = *(ch + 1) == '\0' || *(ch + 1) == '/';
+    if(!levelStart || !levelEnd) return false;
+    if(*ch == '#' && *(ch + 1) != '\0') return false;
+  }
+  return true;
+}
+
+TopicTrie::Node* TopicTrie::findChild(Node* parent, const char* level, size_t length) {
+  for(Node* child = parent->child; child != NULL; child = child->next) {
+    if(isLevel(child, level, length)) return child;
+  }
+  return NULL;
+}
+
+TopicTrie::Node* TopicTrie::createNode(const char* level, size_t length) {
+  Node* node = new Node();
+  node->level = new char[length + 1];
+  memcpy(node->level, level, length);
+  node->level[length] = '\0';
+  node->child = NULL;
+  node->next = NULL;
+  node->handler = NULL;
+  return node;
+}
+
+void TopicTrie::deleteNodes(Node* node) {
+  while(node != NULL) {
+    Node* next = node->next;
+    deleteNodes(node->child);
+    delete[] node->level;
+    delete node;
+    node = next;
+  }
+}
+
+// handler 를 지우고, 자식도 handler 도 없는 node 는 부모에서 떼어낸다.
+bool TopicTrie::removeFrom(Node* parent, const char* filter) {
+  const char* end = strchr(filter, '/');
+  size_t length = end == NULL ? strlen(filter) : (size_t)(end - filter);
+  Node* previous = NULL;
+  Node* node = parent->child;
+  while(node != NULL && !isLevel(node, filter, length)) {
+    previous = node;
+    node = node->next;
+  }
+  if(node == NULL) return false;
+  if(end == NULL) {
+    if(node->handler == NULL) return false;
+    node->handler = NULL;
+  } else if(!removeFrom(node, end + 1)) {
+    return false;
+  }
+  if(node->child == NULL && node->handler == NULL) {
+    if(previous == NULL) parent->child = node->next;
+    else previous->next = node->next;
+    delete[] node->level;
+    delete node;
+  }
+  return true;
+}
+
+// topic 은 node 의 자식 level 부터 남은 부분이다.
+int TopicTrie::match(const Node* node, const char* topic, bool first, const char* fullTopic, const uint8_t* payload, unsigned int length) {
+  const char* end = strchr(topic, '/');
+  size_t levelLength = end == NULL ? strlen(topic) : (size_t)(end - topic);
+  bool wildcard = !(first && topic[0] == '$');
+  int called = 0;
+  for(const Node* child = node->child; child != NULL; child = child->next) {
+    if(child->level[0] == '#' && child->level[1] == '\0') {
+      if(wildcard && child->handler != NULL) {
+        child->handler(fullTopic, payload, length);
+        ++called;
+      }
+      continue;
+    }
+    bool plus = child->level[0] == '+' && child->level[1] == '\0';
+    if(plus ? !wildcard : !isLevel(child, topic, levelLength)) continue;
+    if(end != NULL) {
+      called += match(child, end + 1, false, fullTopic, payload, length);
+      continue;
+    }
+    if(child->handler != NULL) {
+      child->handler(fullTopic, payload, length);
+      ++called;
+    }
+    // "a/#" 는 "a" 와도 맞는다.
+    for(const Node* last = child->child; last != NULL; last = last->next) {
+      if(last->level[0] == '#' && last->level[1] == '\0' && last->handler != NULL) {
+        last->handler(fullTopic, payload, length);
+        ++called;
+      }
+    }
+  }
+  return called;
+}
+
+bool TopicTrie::isLevel(const Node* node, const char* level, size_t length) {
+  return strncmp(node->level, level, length) == 0 && node->level[length] == '\0';
+}
@@ -1,49 +1,301 @@
 #pragma once
 
+#include <errno.h>
+
+#define OPTION_TYPE_STRING 0
+#define OPTION_TYPE_INT 1
+#define OPTION_TYPE_FLOAT 2
+#define OPTION_TYPE_BOOL 3
+// 선택지는 "low|mid|high" 처럼 '|' 로 구분한다. 값은 선택지의 index 로 캐시된다.
+#define OPTION_TYPE_ENUM 4
+// 인증서처럼 큰 값은 별도의 파일에 두고, 옵션 값에는 "<크기>:<crc32>" 형식의 descriptor 만 보관한다.
+#define OPTION_TYPE_BLOB 5
+
+#define OPTION_PARSE_BUFFER_SIZE 32
+// 설정 파일에 바로 저장하는 값의 최대 길이. 이보다 큰 값은 OPTION_TYPE_BLOB 을 사용한다.
+#define OPTION_VALUE_MAX_LENGTH 512
+#define OPTION_BLOB_DESCRIPTOR_SIZE 20
+
+
+union OptionValue {
+    long intValue;
+    float floatValue;
+};
+
+
 class UserOption {
 
     private:
         String _name;
         String _value;
         String _defaultValue;
+        // OptionSchema 로 선언된 옵션은 이름과 기본값을 flash 에 두고 필요할 때만 RAM 으로 복사한다.
+        PGM_P _nameP;
+        PGM_P _defaultValueP;
+        PGM_P _choicesP;
         bool _isNull;
+        uint8_t _type;
+        uint32_t _hash;
+        // 현재 값(혹은 기본값)을 파싱해 둔 값. 
+        OptionValue _cache;
 
     public:
-        UserOption(String name, String defValue, bool isNull) : _name(name), _defaultValue(defValue), _isNull(isNull), _value("") {
+        UserOption() : _nameP(NULL), _defaultValueP(NULL), _choicesP(NULL), _isNull(false), _type(OPTION_TYPE_STRING), _hash(0) {
+            _cache.intValue = 0;
+        }
+
+        UserOption(String name, String defValue, bool isNull) : _name(name), _value(""), _defaultValue(defValue), _nameP(NULL), _defaultValueP(NULL), _choicesP(NULL), _isNull(isNull), _type(OPTION_TYPE_STRING), _hash(0) {
+            _cache.intValue = 0;
         }
 
 
+        // 스키마(flash)로 선언된 옵션은 처음 호출할 때 이름을 RAM 으로 복사해 옵션이 없어질 때까지 보관한다.
+        // RAM 을 아끼려면 printName(), copyName(), equalsName() 을 사용한다.
         const char* getName() {
+            if(_nameP != NULL && _name.length() == 0) _name = FPSTR(_nameP);
             return _name.c_str();
         }
 
+        // getName() 과 같이 flash 의 기본값을 RAM 으로 복사해 보관한다. 반환값은 NULL 이 아니며 옵션이 없어질 때까지 유효하다.
+        // RAM 을 아끼려면 getDefaultValue_P(), printDefaultValue() 를 사용한다.
         const char* getDefaultValue() {
+            if(_defaultValueP != NULL && _defaultValue.length() == 0) _defaultValue = FPSTR(_defaultValueP);
             return _defaultValue.c_str();
         }
 
+        // 기본값을 RAM 으로 복사하지 않고 반환한다. Print 나 String 에 넘겨서 읽는다. (ESP8266 의 PGM_P 함수는 RAM 주소도 읽을 수 있다)
+        const __FlashStringHelper* getDefaultValue_P() const {
+            if(_defaultValueP != NULL) return FPSTR(_defaultValueP);
+            return FPSTR(_defaultValue.c_str());
+        }
+
+        // 값이 없으면 getDefaultValue() 를 반환하므로 flash 의 기본값은 RAM 으로 복사된다. RAM 을 아끼려면 printValue(), copyValue() 를 사용한다.
         const char* getValue() {
-			if(_value.length() == 0) return _defaultValue.c_str();
+            if(_value.length() == 0) return getDefaultValue();
             return _value.c_str();
         }
 
+        bool hasValue() const {
+            return _value.length() > 0;
+        }
+
         bool isNull() {
             return _isNull;
         }
 
+        uint32_t getHash() const {
+            return _hash;
+        }
+
+        uint8_t getType() const {
+            return _type;
+        }
+
+        PGM_P getChoices() const {
+            return _choicesP;
+        }
+
+        long getInt() const {
+            return _cache.intValue;
+        }
+
+        float getFloat() const {
+            return _cache.floatValue;
+        }
+
+        bool getBool() const {
+            return _cache.intValue != 0;
+        }
+
+        int getEnum() const {
+            return (int)_cache.intValue;
+        }
+
+        size_t getBlobSize() const {
+            return _type == OPTION_TYPE_BLOB ? (size_t)_cache.intValue : 0;
+        }
+
+        bool isValidValue(const char* value) const {
+            OptionValue parsed;
+            return parse(value, &parsed);
+        }
+
+        bool equalsName(const char* name) const {
+            if(_nameP != NULL) return strcmp_P(name, _nameP) == 0;
+            return strcmp(name, _name.c_str()) == 0;
+        }
+
+        bool equalsDefaultValue(const char* value) const {
+            if(_defaultValueP != NULL) return strcmp_P(value, _defaultValueP) == 0;
+            return strcmp(value, _defaultValue.c_str()) == 0;
+        }
+
+        size_t getNameLength() const {
+            if(_nameP != NULL) return strlen_P(_nameP);
+            return _name.length();
+        }
+
+        // buffer 는 getNameLength() + 1 이상이어야 한다.
+        void copyName(char* buffer) const {
+            if(_nameP != NULL) strcpy_P(buffer, _nameP);
+            else strcpy(buffer, _name.c_str());
+        }
+
+        size_t printName(Print& out) const {
+            if(_nameP != NULL) return out.print(FPSTR(_nameP));
+            return out.print(_name);
+        }
+
+        size_t printValue(Print& out) const {
+            if(_value.length() > 0) return out.print(_value);
+            if(_defaultValueP != NULL) return out.print(FPSTR(_defaultValueP));
+            return out.print(_defaultValue);
+        }
+
+        size_t printDefaultValue(Print& out) const {
+            if(_defaultValueP != NULL) return out.print(FPSTR(_defaultValueP));
+            return out.print(_defaultValue);
+        }
+
+        // 기본값을 RAM 으로 복사하지 않고 buffer 에 값을 복사한다. 반환값은 값의 길이.
+        size_t copyValue(char* buffer, size_t size) const {
+            if(size == 0) return 0;
+            if(_value.length() == 0 && _defaultValueP != NULL) {
+                strncpy_P(buffer, _defaultValueP, size - 1);
+                buffer[size - 1] = '\0';
+                return strlen_P(_defaultValueP);
+            }
+            const String& value = _value.length() > 0 ? _value : _defaultValue;
+            strncpy(buffer, value.c_str(), size - 1);
+            buffer[size - 1] = '\0';
+            return value.length();
+        }
+
         void setIsNull(bool isNull) {
             _isNull = isNull;
         }
 
         void setName(String name) {
             _name = name;
+            _nameP = NULL;
+        }
+
+        void setName_P(PGM_P name) {
+            _name = String();
+            _nameP = name;
+        }
+
+        void setHash(uint32_t hash) {
+            _hash = hash;
+        }
+
+        // choices 는 OPTION_TYPE_ENUM 에서만 사용하며, 옵션이 살아있는 동안 유효한 문자열(혹은 PROGMEM)이어야 한다.
+        void setType(uint8_t type, PGM_P choices) {
+            _type = type;
+            _choicesP = choices;
+            updateCache();
         }
 
         void setValue(String value) {
             _value = value;
+            updateCache();
+        }
+
+        void setValue(const char* value) {
+            _value = value;
+            updateCache();
+        }
+
+        void resetValue() {
+            _value = String();
+            updateCache();
         }
 
         void setDefaultValue(String defValue) {
             _defaultValue = defValue;
+            _defaultValueP = NULL;
+            updateCache();
+        }
+
+        void setDefaultValue_P(PGM_P defValue) {
+            _defaultValue = String();
+            _defaultValueP = defValue;
+            updateCache();
+        }
+
+    private:
+
+        // 값을 파싱할 수 없으면 0 (OPTION_TYPE_ENUM 은 선택지가 없다는 뜻으로 -1) 이 된다.
+        void updateCache() {
+            _cache.intValue = _type == OPTION_TYPE_ENUM ? -1 : 0;
+            if(_type == OPTION_TYPE_STRING) return;
+            const char* value = _value.length() > 0 ? _value.c_str() : _defaultValue.c_str();
+            char buffer[OPTION_PARSE_BUFFER_SIZE];
+            if(_value.length() == 0 && _defaultValueP != NULL) {
+                strncpy_P(buffer, _defaultValueP, OPTION_PARSE_BUFFER_SIZE - 1);
+                buffer[OPTION_PARSE_BUFFER_SIZE - 1] = '\0';
+                value = buffer;
+            }
+            OptionValue parsed;
+            if(parse(value, &parsed)) _cache = parsed;
+        }
+
+        bool parse(const char* value, OptionValue* out) const {
+            char* end = NULL;
+            switch(_type) {
+                case OPTION_TYPE_INT:
+                    if(*value == '\0') return false;
+                    errno = 0;
+                    out->intValue = strtol(value, &end, 10);
+                    return *end == '\0' && errno != ERANGE;
+                case OPTION_TYPE_FLOAT:
+                    if(*value == '\0') return false;
+                    out->floatValue = strtof(value, &end);
+                    return *end == '\0' && !isnan(out->floatValue) && !isinf(out->floatValue);
+                case OPTION_TYPE_BOOL:
+                    if(strcasecmp(value, "true") == 0 || strcasecmp(value, "on") == 0 || strcasecmp(value, "yes") == 0 || strcmp(value, "1") == 0) {
+                        out->intValue = 1;
+                        return true;
+                    }
+                    if(strcasecmp(value, "false") == 0 || strcasecmp(value, "off") == 0 || strcasecmp(value, "no") == 0 || strcmp(value, "0") == 0) {
+                        out->intValue = 0;
+                        return true;
+                    }
+                    return false;
+                case OPTION_TYPE_ENUM:
+                    out->intValue = findChoice(value);
+                    return out->intValue >= 0;
+                case OPTION_TYPE_BLOB:
+                    if(*value == '\0') {
+                        out->intValue = 0;
+                        return true;
+                    }
+                    if(*value < '0' || *value > '9') return false;
+                    out->intValue = strtol(value, &end, 10);
+                    if(*end != ':' || !isxdigit(end[1])) return false;
+                    strtoul(end + 1, &end, 16);
+                    return *end == '\0';
+            }
+            return true;
+        }
+
+        long findChoice(const char* value) const {
+            if(_choicesP == NULL || *value == '\0') return -1;
+            long index = 0;
+            const char* pos = value;
+            for(PGM_P choice = _choicesP;; ++choice) {
+                char ch = pgm_read_byte(choice);
+                if(ch == '|' || ch == '\0') {
+                    if(pos != NULL && *pos == '\0') return index;
+                    if(ch == '\0') return -1;
+                    pos = value;
+                    ++index;
+                } else if(pos != NULL && *pos == ch) {
+                    ++pos;
+                } else {
+                    pos = NULL;
+                }
+            }
         }
 
-};
\ No newline at end of file
+};
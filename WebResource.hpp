@@ -0,0 +1,15 @@
+#pragma once
+
+/**
+ * .res/build.js 가 Resources.hpp 에 만드는 리소스 정보. (PROGMEM 에 저장된다)
+ * content(압축하지 않은 원본)는 WIZARD_RESOURCE_GZIP_ONLY 를 정의하고 빌드하면 NULL 이다.
+ */
+struct WebResource {
+  PGM_P contentType;
+  const uint8_t* content;
+  size_t length;
+  const uint8_t* gzipContent;
+  size_t gzipLength;
+  PGM_P etag;
+  PGM_P gzipEtag;
+};
@@ -0,0 +1,246 @@
+#pragma once
+
+#include <ESP8266WiFi.h>
+
+/**
+ * 백그라운드 WiFi 스캔. (Asynchronous WiFi scan)
+ * WiFi.scanNetworks(true) 로 스캔을 시작하고 loop() 에서 완료를 확인한다.
+ * 스캔이 끝나면 결과를 복사해 두고 SDK 의 스캔 결과는 바로 해제한다.
+ * 복사한 결과는 cache TTL 동안 재사용하므로 페이지를 다시 열어도 새로 스캔하지 않는다.
+ * 같은 SSID 는 신호가 가장 강한 BSSID 하나만 남기고, 결과는 RSSI 가 강한 순서로 정렬된다.
+ * 다시 스캔하다 실패하면 이전 결과와 그 시각을 그대로 두고 lastScanFailed() 로만 알린다.
+ */
+
+#define WIFI_SCAN_CACHE_TTL 30000 //ms
+#define WIFI_SCAN_TIMEOUT 15000 //ms
+#define WIFI_SCAN_MAX_RESULTS 32
+#define WIFI_SSID_BUFFER_SIZE 33
+
+#define SCAN_STATE_IDLE 0
+#define SCAN_STATE_SCANNING 1
+#define SCAN_STATE_DONE 2
+#define SCAN_STATE_FAILED 3
+
+
+struct WiFiScanResult {
+  char ssid[WIFI_SSID_BUFFER_SIZE];
+  int32_t rssi;
+  uint8_t encryptionType;
+};
+
+
+class WiFiScanner {
+  private :
+    WiFiScanResult* _results;
+    uint8_t _count;
+    uint8_t _state;
+    unsigned long _startedMillis;
+    unsigned long _finishedMillis;
+    unsigned long _failedMillis;
+    unsigned long _cacheTTL;
+    bool _cached;
+    bool _lastScanFailed;
+
+  public :
+    WiFiScanner();
+    ~WiFiScanner();
+    WiFiScanner(const WiFiScanner&) = delete;
+    WiFiScanner& operator=(const WiFiScanner&) = delete;
+
+    void setCacheTTL(unsigned long ttl);
+    bool start(bool force = false);
+    void loop();
+    void clear();
+
+    uint8_t state() const;
+    const char* stateName() const;
+    bool isFresh() const;
+    uint8_t count() const;
+    const WiFiScanResult* get(uint8_t index) const;
+    unsigned long elapsed() const;
+    unsigned long age() const;
+    bool lastScanFailed() const;
+
+  private :
+    void fail();
+    void collect(int count);
+    int find(const char* ssid) const;
+    void sort();
+};
+
+
+WiFiScanner::WiFiScanner() : _results(NULL), _count(0), _state(SCAN_STATE_IDLE), _startedMillis(0), _finishedMillis(0), _failedMillis(0), _cacheTTL(WIFI_SCAN_CACHE_TTL), _cached(false), _lastScanFailed(false) {
+}
+
+WiFiScanner::~WiFiScanner() {
+  clear();
+}
+
+void WiFiScanner::setCacheTTL(unsigned long ttl) {
+  _cacheTTL = ttl;
+}
+
+// 캐시가 유효하면 스캔하지 않고 false 를 반환한다. force 가 true 이면 캐시를 무시한다.
+// 스캔이 실패한 뒤 cache TTL 동안은 이전 결과를 그대로 쓰므로, 상태를 확인하는 페이지가 스캔을 계속 반복하지 않는다.
+bool WiFiScanner::start(bool force) {
+  if(_state == SCAN_STATE_SCANNING) return true;
+  if(!force && isFresh()) return false;
+  if(!force && _cached && _lastScanFailed && millis() - _failedMillis < _cacheTTL) return false;
+  // AP 모드만 켜져 있으면 스캔할 수 없다.
+  if((WiFi.getMode() & WIFI_STA) == 0) WiFi.mode(WIFI_AP_STA);
+  int result = WiFi.scanNetworks(true);
+  _startedMillis = millis();
+  if(result == WIFI_SCAN_FAILED) {
+    fail();
+    return false;
+  }
+  _state = SCAN_STATE_SCANNING;
+  #ifdef _DEBUG_
+  Serial.println("WiFi scan started.");
+  #endif
+  return true;
+}
+
+void WiFiScanner::loop() {
+  if(_state != SCAN_STATE_SCANNING) return;
+  int result = WiFi.scanComplete();
+  if(result == WIFI_SCAN_RUNNING) {
+    if(millis() - _startedMillis > WIFI_SCAN_TIMEOUT) {
+      WiFi.scanDelete();
+      fail();
+    }
+    return;
+  }
+  if(result < 0) {
+    fail();
+    return;
+  }
+  collect(result);
+  WiFi.scanDelete();
+  _finishedMillis = millis();
+  _cached = true;
+  _lastScanFailed = false;
+  _state = SCAN_STATE_DONE;
+  #ifdef _DEBUG_
+  Serial.print("WiFi scan done: ");
+  Serial.println(_count);
+  #endif
+}
+
+void WiFiScanner::clear() {
+  if(_results != NULL) {
+    delete[] _results;
+    _results = NULL;
+  }
+  _count = 0;
+  _cached = false;
+  if(_state == SCAN_STATE_DONE) _state = SCAN_STATE_IDLE;
+}
+
+// 캐시된 결과가 있으면 오래되었더라도 버리지 않는다. 다음 start() 에서 TTL 이 지났으면 다시 스캔한다.
+void WiFiScanner::fail() {
+  _lastScanFailed = true;
+  _failedMillis = millis();
+  _state = _cached ? SCAN_STATE_DONE : SCAN_STATE_FAILED;
+  #ifdef _DEBUG_
+  Serial.println("WiFi scan failed.");
+  #endif
+}
+
+uint8_t WiFiScanner::state() const {
+  return _state;
+}
+
+const char* WiFiScanner::stateName() const {
+  switch(_state) {
+    case SCAN_STATE_SCANNING:
+      return "scanning";
+    case SCAN_STATE_DONE:
+      return "done";
+    case SCAN_STATE_FAILED:
+      return "failed";
+  }
+  return "idle";
+}
+
+bool WiFiScanner::isFresh() const {
+  return _state == SCAN_STATE_DONE && millis() - _finishedMillis < _cacheTTL;
+}
+
+uint8_t WiFiScanner::count() const {
+  return _count;
+}
+
+const WiFiScanResult* WiFiScanner::get(uint8_t index) const {
+  if(index >= _count) return NULL;
+  return &_results[index];
+}
+
+// 진행 중인 스캔이 시작된 뒤로 지난 시간.
+unsigned long WiFiScanner::elapsed() const {
+  if(_state != SCAN_STATE_SCANNING) return 0;
+  return millis() - _startedMillis;
+}
+
+// 캐시된 결과가 만들어진 뒤로 지난 시간.
+unsigned long WiFiScanner::age() const {
+  if(!_cached) return 0;
+  return millis() - _finishedMillis;
+}
+
+// 마지막 스캔이 실패했는지. 실패해도 이전 결과가 있으면 state() 는 SCAN_STATE_DONE 이다.
+bool WiFiScanner::lastScanFailed() const {
+  return _lastScanFailed;
+}
+
+// 결과가 WIFI_SCAN_MAX_RESULTS 보다 많으면 신호가 약한 것부터 버린다. 숨겨진 SSID 는 연결할 수 없으므로 제외한다.
+void WiFiScanner::collect(int count) {
+  clear();
+  if(count <= 0) return;
+  _results = new WiFiScanResult[count < WIFI_SCAN_MAX_RESULTS ? count : WIFI_SCAN_MAX_RESULTS];
+  for(int i = 0; i < count; ++i) {
+    String ssid = WiFi.SSID(i);
+    if(ssid.length() == 0) continue;
+    int32_t rssi = WiFi.RSSI(i);
+    int index = find(ssid.c_str());
+    if(index < 0) {
+      if(_count < WIFI_SCAN_MAX_RESULTS) {
+        index = _count++;
+      } else {
+        int weakest = 0;
+        for(int j = 1; j < _count; ++j) {
+          if(_results[j].rssi < _results[weakest].rssi) weakest = j;
+        }
+        if(_results[weakest].rssi >= rssi) continue;
+        index = weakest;
+      }
+      strncpy(_results[index].ssid, ssid.c_str(), WIFI_SSID_BUFFER_SIZE - 1);
+      _results[index].ssid[WIFI_SSID_BUFFER_SIZE - 1] = '\0';
+    } else if(_results[index].rssi >= rssi) {
+      continue;
+    }
+    _results[index].rssi = rssi;
+    _results[index].encryptionType = WiFi.encryptionType(i);
+  }
+  sort();
+}
+
+int WiFiScanner::find(const char* ssid) const {
+  for(int i = 0; i < _count; ++i) {
+    if(strcmp(_results[i].ssid, ssid) == 0) return i;
+  }
+  return -1;
+}
+
+// 결과가 많지 않으므로 삽입 정렬을 사용한다.
+void WiFiScanner::sort() {
+  for(int i = 1; i < _count; ++i) {
+    WiFiScanResult item = _results[i];
+    int j = i - 1;
+    while(j >= 0 && _results[j].rssi < item.rssi) {
+      _results[j + 1] = _results[j];
+      --j;
+    }
+    _results[j + 1] = item;
+  }
+}
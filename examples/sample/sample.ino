@@ -6,6 +6,14 @@
 PubSubClient* _mqttClinet;
 ESP8266ConfigurationWizard _ESP8266ConfigurationWizard;
 
+// id, name, default value, isNull, type, choices
+#define SAMPLE_OPTIONS(OPTION) \
+  OPTION(DeviceName, "DeviceName", "ESP8266ConfigurationWizard", false, OPTION_TYPE_STRING, "") \
+  OPTION(Key, "Key", "", false, OPTION_TYPE_STRING, "") \
+  OPTION(Taste, "Taste", "", true, OPTION_TYPE_STRING, "")
+
+DECLARE_OPTION_SCHEMA(SAMPLE_OPTION_SCHEMA, SAMPLE_OPTIONS);
+
 const char* onFilterOption(const char* name, const char* value);
 void onStatusCallback(int status); 
   
@@ -15,9 +23,7 @@ void setup() {
   Serial.begin(57600);
   
   Config* config = _ESP8266ConfigurationWizard.getConfigPt();
-  config->addOption("DeviceName","ESP8266ConfigurationWizard", false);
-  config->addOption("Key","", false);
-  config->addOption("Taste","", true);
+  config->addOptionSchema(SAMPLE_OPTION_SCHEMA);
 
 
   _ESP8266ConfigurationWizard.setOnFilterOption(onFilterOption);